@@ -0,0 +1,35 @@
+#version 100
+
+precision mediump float;
+
+// Input vertex attributes (from vertex shader)
+varying vec2 fragTexCoord;
+varying vec4 fragColor;
+
+// Input uniform values
+uniform sampler2D texture0;
+uniform vec4 colDiffuse;
+
+// NOTE: Add here your custom variables
+// NOTE: Distance change per screen pixel depends on text scale, it must be provided because
+// derivatives functions (dFdx(), dFdy()) require GL_OES_standard_derivatives extension on GLSL 100
+uniform float smoothing;
+
+float median(float r, float g, float b)
+{
+    return max(min(r, g), min(max(r, g), b));
+}
+
+void main()
+{
+    // Texel color fetching from texture sampler
+    // NOTE: Calculate alpha using multi-channel signed distance field (MSDF),
+    // median of RGB channels keeps glyphs sharp corners when upscaled
+    vec3 msd = texture2D(texture0, fragTexCoord).rgb;
+    float distanceFromOutline = median(msd.r, msd.g, msd.b) - 0.5;
+    float distanceChangePerFragment = (smoothing > 0.0)? smoothing : 1.0/16.0;
+    float alpha = smoothstep(-distanceChangePerFragment, distanceChangePerFragment, distanceFromOutline);
+
+    // Calculate final fragment color
+    gl_FragColor = vec4(fragColor.rgb, fragColor.a*alpha);
+}
@@ -0,0 +1,33 @@
+#version 330
+
+// Input vertex attributes (from vertex shader)
+in vec2 fragTexCoord;
+in vec4 fragColor;
+
+// Input uniform values
+uniform sampler2D texture0;
+uniform vec4 colDiffuse;
+
+// Output fragment color
+out vec4 finalColor;
+
+// NOTE: Add here your custom variables
+
+float median(float r, float g, float b)
+{
+    return max(min(r, g), min(max(r, g), b));
+}
+
+void main()
+{
+    // Texel color fetching from texture sampler
+    // NOTE: Calculate alpha using multi-channel signed distance field (MSDF),
+    // median of RGB channels keeps glyphs sharp corners when upscaled
+    vec3 msd = texture(texture0, fragTexCoord).rgb;
+    float distanceFromOutline = median(msd.r, msd.g, msd.b) - 0.5;
+    float distanceChangePerFragment = length(vec2(dFdx(distanceFromOutline), dFdy(distanceFromOutline)));
+    float alpha = smoothstep(-distanceChangePerFragment, distanceChangePerFragment, distanceFromOutline);
+
+    // Calculate final fragment color
+    finalColor = vec4(fragColor.rgb, fragColor.a*alpha);
+}
@@ -2,7 +2,7 @@
 *
 *   raylib [text] example - Font SDF loading
 *
-*   Example originally created with raylib 1.3, last time updated with raylib 4.0
+*   Example originally created with raylib 1.3, last time updated with raylib 5.5
 *
 *   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
 *   BSD-like license that allows static linking with closed source software
@@ -65,16 +65,35 @@ int main(void)
     fontSDF.texture = LoadTextureFromImage(atlas);
     UnloadImage(atlas);
 
+    // MSDF font generation from TTF font, glyphs distances stored in RGB channels
+    Font fontMSDF = { 0 };
+    fontMSDF.baseSize = 16;
+    fontMSDF.glyphCount = 95;
+    // Parameters > font size: 16, no glyphs array provided (0), glyphs count: 0 (defaults to 95)
+    fontMSDF.glyphs = LoadFontData(fileData, fileSize, 16, 0, 0, FONT_MSDF);
+    // Parameters > glyphs count: 95, font size: 16, glyphs padding in image: 0 px, pack method: 1 (Skyline algorythm)
+    atlas = GenImageFontAtlas(fontMSDF.glyphs, &fontMSDF.recs, 95, 16, 0, 1);
+    fontMSDF.texture = LoadTextureFromImage(atlas);
+    UnloadImage(atlas);
+
     UnloadFileData(fileData);      // Free memory from loaded file
 
     // Load SDF required shader (we use default vertex shader)
     Shader shader = LoadShader(0, TextFormat("resources/shaders/glsl%i/sdf.fs", GLSL_VERSION));
     SetTextureFilter(fontSDF.texture, TEXTURE_FILTER_BILINEAR);    // Required for SDF font
 
+    // Load MSDF required shader (we use default vertex shader)
+    Shader shaderMSDF = LoadShader(0, TextFormat("resources/shaders/glsl%i/msdf.fs", GLSL_VERSION));
+    SetTextureFilter(fontMSDF.texture, TEXTURE_FILTER_BILINEAR);   // Required for MSDF font
+
+    // NOTE: GLSL 100 shader requires distance change per screen pixel, generated MSDF distances
+    // change 32/255 per glyph pixel, GLSL 330 shader computes it with derivatives (uniform not used)
+    int smoothingLoc = GetShaderLocation(shaderMSDF, "smoothing");
+
     Vector2 fontPosition = { 40, screenHeight/2.0f - 50 };
     Vector2 textSize = { 0.0f, 0.0f };
     float fontSize = 16.0f;
-    int currentFont = 0;            // 0 - fontDefault, 1 - fontSDF
+    int currentFont = 0;            // 0 - fontDefault, 1 - fontSDF, 2 - fontMSDF
 
     SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
     //--------------------------------------------------------------------------------------
@@ -89,10 +108,15 @@ int main(void)
         if (fontSize < 6) fontSize = 6;
 
         if (IsKeyDown(KEY_SPACE)) currentFont = 1;
+        else if (IsKeyDown(KEY_M)) currentFont = 2;
         else currentFont = 0;
 
         if (currentFont == 0) textSize = MeasureTextEx(fontDefault, msg, fontSize, 0);
-        else textSize = MeasureTextEx(fontSDF, msg, fontSize, 0);
+        else if (currentFont == 1) textSize = MeasureTextEx(fontSDF, msg, fontSize, 0);
+        else textSize = MeasureTextEx(fontMSDF, msg, fontSize, 0);
+
+        float smoothing = (32.0f/255.0f)*16.0f/fontSize;
+        SetShaderValue(shaderMSDF, smoothingLoc, &smoothing, SHADER_UNIFORM_FLOAT);
 
         fontPosition.x = GetScreenWidth()/2 - textSize.x/2;
         fontPosition.y = GetScreenHeight()/2 - textSize.y/2 + 80;
@@ -113,6 +137,15 @@ int main(void)
 
                 DrawTexture(fontSDF.texture, 10, 10, BLACK);
             }
+            else if (currentFont == 2)
+            {
+                // NOTE: MSDF fonts require a custom MSDF shader to compute fragment color
+                BeginShaderMode(shaderMSDF);    // Activate MSDF font shader
+                    DrawTextEx(fontMSDF, msg, fontPosition, fontSize, 0, BLACK);
+                EndShaderMode();                // Activate our default shader for next drawings
+
+                DrawTexture(fontMSDF.texture, 10, 10, WHITE);
+            }
             else
             {
                 DrawTextEx(fontDefault, msg, fontPosition, fontSize, 0, BLACK);
@@ -120,13 +153,15 @@ int main(void)
             }
 
             if (currentFont == 1) DrawText("SDF!", 320, 20, 80, RED);
+            else if (currentFont == 2) DrawText("MSDF!", 300, 20, 80, RED);
             else DrawText("default font", 315, 40, 30, GRAY);
 
             DrawText("FONT SIZE: 16.0", GetScreenWidth() - 240, 20, 20, DARKGRAY);
             DrawText(TextFormat("RENDER SIZE: %02.02f", fontSize), GetScreenWidth() - 240, 50, 20, DARKGRAY);
             DrawText("Use MOUSE WHEEL to SCALE TEXT!", GetScreenWidth() - 240, 90, 10, DARKGRAY);
 
-            DrawText("HOLD SPACE to USE SDF FONT VERSION!", 340, GetScreenHeight() - 30, 20, MAROON);
+            DrawText("HOLD SPACE to USE SDF FONT VERSION!", 340, GetScreenHeight() - 60, 20, MAROON);
+            DrawText("HOLD M to USE MSDF FONT VERSION!", 340, GetScreenHeight() - 30, 20, MAROON);
 
         EndDrawing();
         //----------------------------------------------------------------------------------
@@ -136,8 +171,10 @@ int main(void)
     //--------------------------------------------------------------------------------------
     UnloadFont(fontDefault);    // Default font unloading
     UnloadFont(fontSDF);        // SDF font unloading
+    UnloadFont(fontMSDF);       // MSDF font unloading
 
     UnloadShader(shader);       // Unload SDF shader
+    UnloadShader(shaderMSDF);   // Unload MSDF shader
 
     CloseWindow();              // Close window and OpenGL context
     //--------------------------------------------------------------------------------------
@@ -66,6 +66,11 @@
 #define SUPPORT_COMPRESSION_API         1
 // Support automatic generated events, loading and recording of those events when required
 #define SUPPORT_AUTOMATION_EVENTS       1
+// Use SIMD intrinsics (SSE/NEON) for core and batch raymath functions (MatrixMultiply(), MatrixInvert()...), if supported by target
+#define SUPPORT_RAYMATH_SIMD            1
+// DRM platform: Queue page flips without waiting for display vertical blank on buffers swap (triple buffering)
+// Rendering is not blocked by display refresh, at the cost of one frame of additional latency
+//#define SUPPORT_DRM_TRIPLE_BUFFERING    1
 // Support custom frame control, only for advanced users
 // By default EndDrawing() does this job: draws everything + SwapScreenBuffer() + manage frame timing + PollInputEvents()
 // Enabling this flag allows manual control of the frame processes, use at your own risk
@@ -110,7 +115,7 @@
 
 #define RL_MAX_MATRIX_STACK_SIZE              32      // Maximum size of internal Matrix stack
 
-#define RL_MAX_SHADER_LOCATIONS               32      // Maximum number of shader locations supported
+#define RL_MAX_SHADER_LOCATIONS               40      // Maximum number of shader locations supported
 
 #define RL_CULL_DISTANCE_NEAR               0.01      // Default projection matrix near cull distance
 #define RL_CULL_DISTANCE_FAR              1000.0      // Default projection matrix far cull distance
@@ -203,6 +208,15 @@
 // If not defined, still some functions are supported: TextLength(), TextFormat()
 #define SUPPORT_TEXT_MANIPULATION       1
 
+// On TTF/OTF font loading [LoadFontFromMemory()], load glyphs kerning pairs, used by text layout kerning
+// NOTE: Fonts without 'kern' table are checked for GPOS kerning on every glyphs pair, slower font loading
+//#define SUPPORT_FONT_KERNING            1
+
+// On SDF font data generation [LoadFontData()], compute glyphs distance fields from glyphs rasterized bitmaps
+// using an euclidean distance transform, a lot faster than exact distances to glyphs outlines [stbtt_GetGlyphSDF()]
+// NOTE: Distances are approximated from supersampled glyphs bitmaps, generated SDF differs slightly from exact one
+//#define SUPPORT_FONT_SDF_EDT            1
+
 // On font atlas image generation [GenImageFontAtlas()], add a 3x3 pixels white rectangle
 // at the bottom-right corner of the atlas. It can be useful to for shapes drawing, to allow
 // drawing text and shapes with a single draw call [SetShapesTexture()].
@@ -225,6 +239,10 @@
 #define SUPPORT_FILEFORMAT_GLTF         1
 #define SUPPORT_FILEFORMAT_VOX          1
 #define SUPPORT_FILEFORMAT_M3D          1
+#define SUPPORT_FILEFORMAT_RMDL         1
+// Weld duplicated vertices of loaded OBJ meshes, generating indices (GenMeshIndices())
+// NOTE: OBJ faces reference separate position/normal/texcoord indices, every face corner is a vertex
+#define SUPPORT_OBJ_VERTEX_WELDING      1
 // Support procedural mesh generation functions, uses external par_shapes.h library
 // NOTE: Some generated meshes DO NOT include generated texture coordinates
 #define SUPPORT_MESH_GENERATION         1
@@ -264,6 +282,11 @@
 //------------------------------------------------------------------------------------
 // Standard file io library (stdio.h) included
 #define SUPPORT_STANDARD_FILEIO         1
+// Map files into memory (mmap) when loading resources, avoiding a full file copy (zero-copy)
+// NOTE: Only supported on POSIX systems, other platforms fallback to LoadFileData()
+#define SUPPORT_FILE_MAPPING            1
+// Pack files support, mounted packs entries are resolved by LoadFileData(), LoadFileText() and MapFileData()
+#define SUPPORT_PACK_FILES              1
 // Show TRACELOG() output messages
 // NOTE: By default LOG_DEBUG traces not shown
 #define SUPPORT_TRACELOG                1
@@ -272,6 +295,7 @@
 // utils: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TRACELOG_MSG_LENGTH       256       // Max length of one trace-log message
+#define MAX_MOUNTED_PACKS               8       // Maximum number of pack files mounted at the same time
 
 
 // Enable partial support for clipboard image, only working on SDL3 or
@@ -427,6 +427,8 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
         return (int)(out-o);
       if (len > (e - s.bitptr) || !len)
         return (int)(out-o);
+      if (len > (oe - out))
+        return -1;      // raylib: added, output buffer too small
 
       memcpy(out, s.bitptr, (size_t)len);
       s.bitptr += len, out += len;
@@ -485,11 +487,14 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
         if (sym < 256) {
           /* literal */
           if (sinfl_unlikely(out >= oe)) {
-            return (int)(out-o);
+            return -1;  // raylib: added, output buffer too small
           }
           *out++ = (unsigned char)sym;
           sym = sinfl_decode(&s, s.lits, 10);
           if (sym < 256) {
+            if (sinfl_unlikely(out >= oe)) {
+              return -1;  // raylib: added, output buffer too small
+            }
             *out++ = (unsigned char)sym;
             continue;
           }
@@ -513,6 +518,9 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
         if (sinfl_unlikely(offs > (int)(out-o))) {
           return (int)(out-o);
         }
+        if (sinfl_unlikely(len > (int)(oe-out))) {
+          return -1;  // raylib: added, output buffer too small
+        }
         out = out + len;
 
 #ifndef SINFL_NO_SIMD
@@ -22,6 +22,11 @@
 *           WARNING: Reconfiguring standard input could lead to undesired effects, like breaking other
 *           running processes orblocking the device if not restored properly. Use with care.
 *
+*       #define SUPPORT_DRM_TRIPLE_BUFFERING
+*           Page flips are queued without waiting for the display vertical blank on buffers swap,
+*           next frame is rendered while previous one is still waiting to be displayed.
+*           Rendering is not blocked by display refresh, at the cost of one frame of additional latency.
+*
 *   DEPENDENCIES:
 *       - DRM and GLM: System libraries for display initialization and configuration
 *       - gestures: Gestures system for touch-ready devices (or simulated from mouse inputs)
@@ -53,8 +58,11 @@
 #include <termios.h> // POSIX terminal control definitions - tcgetattr(), tcsetattr()
 #include <pthread.h> // POSIX threads management (inputs reading)
 #include <dirent.h>  // POSIX directory browsing
+#include <poll.h>    // POSIX poll() - Required to wait for DRM page flip events
+#include <errno.h>   // Required for: errno, EINTR
 
 #include <sys/ioctl.h>      // Required for: ioctl() - UNIX System call for device-specific input/output operations
+#include <sys/epoll.h>      // Linux: epoll_create1(), epoll_ctl(), epoll_wait() - Required to check input devices with pending events
 #include <linux/kd.h>       // Linux: KDSKBMODE, K_MEDIUMRAM constants definition
 #include <linux/input.h>    // Linux: Keycodes constants definition (KEY_A, ...)
 #include <linux/joystick.h> // Linux: Joystick support library
@@ -82,6 +90,16 @@
 
 #define DEFAULT_EVDEV_PATH       "/dev/input/"      // Path to the linux input events
 
+#define DRM_PAGE_FLIP_TIMEOUT       1000    // Maximum time to wait for a page flip event (in milliseconds)
+
+#define EVDEV_EVENTS_BATCH_SIZE       64    // Maximum number of input events read at once from an evdev device
+#define EVDEV_MAX_DEVICES     (MAX_GAMEPADS + 2) // Maximum number of evdev devices in use: keyboard, mouse and gamepads
+
+// Evdev devices identifiers, used as bit index for devices with pending events
+#define EVDEV_DEVICE_KEYBOARD          0
+#define EVDEV_DEVICE_MOUSE             1
+#define EVDEV_DEVICE_GAMEPAD           2    // First gamepad, next gamepads use consecutive ids
+
 // So actually the biggest key is KEY_CNT but we only really map the keys up to
 // KEY_ALS_TOGGLE
 #define KEYMAP_SIZE KEY_ALS_TOGGLE
@@ -98,8 +116,9 @@ typedef struct {
     int modeIndex;                      // Index of the used mode of connector->modes
     struct gbm_device *gbmDevice;       // GBM device
     struct gbm_surface *gbmSurface;     // GBM surface
-    struct gbm_bo *prevBO;              // Previous GBM buffer object (during frame swapping)
-    uint32_t prevFB;                    // Previous GBM framebufer (during frame swapping)
+    struct gbm_bo *frontBO;             // GBM buffer object currently displayed (scanned out)
+    struct gbm_bo *pendingBO;           // GBM buffer object queued for page flip, NULL if no page flip pending
+    bool pageFlip;                      // Page flips supported, if not, drmModeSetCrtc() is used to display frames
 
     EGLDisplay device;                  // Native display device (physical screen connection)
     EGLSurface surface;                 // Surface to draw on, framebuffers (connected to context)
@@ -127,6 +146,10 @@ typedef struct {
     int gamepadAbsAxisRange[MAX_GAMEPADS][MAX_GAMEPAD_AXIS][2]; // [0] = min, [1] = range value of the axis
     int gamepadAbsAxisMap[MAX_GAMEPADS][ABS_CNT]; // Maps the axes gamepads from the evdev api to a sequential one
     int gamepadCount;                   // The number of gamepads registered
+
+    // Evdev devices data
+    int epollFd;                        // Epoll file descriptor, to check evdev devices with pending events
+    unsigned int evdevReady;            // Evdev devices with pending events in current frame (bit per device id)
 } PlatformData;
 
 //----------------------------------------------------------------------------------
@@ -228,9 +251,20 @@ static void ProcessKeyboard(void);              // Process keyboard events
 
 static void InitEvdevInput(void);               // Initialize evdev inputs
 static void ConfigureEvdevDevice(char *device); // Identifies a input device and configures it for use if appropriate
+static void RegisterEvdevDevice(int fd, int id); // Register evdev device to be checked for pending events
+static unsigned int GetEvdevReadyDevices(void); // Get evdev devices with pending events (bit per device id)
+static int ReadEvdevEvents(int fd, struct input_event *events); // Read available evdev events in bulk
 static void PollKeyboardEvents(void);           // Process evdev keyboard events
 static void PollGamepadEvents(void);            // Process evdev gamepad events
 static void PollMouseEvents(void);              // Process evdev mouse events
+#if defined(SUPPORT_GESTURES_SYSTEM)
+static void ProcessTouchGesture(int touchAction); // Process gesture event for touch action
+#endif
+
+static uint32_t GetBufferFramebuffer(struct gbm_bo *bo);                    // Get DRM framebuffer for GBM buffer object (cached)
+static void DestroyBufferFramebuffer(struct gbm_bo *bo, void *data);        // Destroy DRM framebuffer cached with GBM buffer object
+static void PageFlipHandler(int fd, unsigned int frame, unsigned int sec, unsigned int usec, void *data); // Page flip completion event handler
+static void WaitPageFlip(void);                                             // Wait for pending page flip completion
 
 static int FindMatchingConnectorMode(const drmModeConnector *connector, const drmModeModeInfo *mode);                               // Search matching DRM mode in connector's mode list
 static int FindExactConnectorMode(const drmModeConnector *connector, uint width, uint height, uint fps, bool allowInterlaced);      // Search exactly matching DRM connector mode in connector's list
@@ -542,33 +576,57 @@ void DisableCursor(void)
 }
 
 // Swap back buffer with front buffer (screen drawing)
+// NOTE: Display mode is only set on first frame, next frames are presented with page flips,
+// completed on display vertical blank, framebuffers are cached per GBM buffer object
 void SwapScreenBuffer(void)
 {
     eglSwapBuffers(platform.device, platform.surface);
 
-    if (!platform.gbmSurface || (-1 == platform.fd) || !platform.connector || !platform.crtc) TRACELOG(LOG_ERROR, "DISPLAY: DRM initialization failed to swap");
+    if (!platform.gbmSurface || (-1 == platform.fd) || !platform.connector || !platform.crtc)
+    {
+        TRACELOG(LOG_ERROR, "DISPLAY: DRM initialization failed to swap");
+        return;
+    }
 
     struct gbm_bo *bo = gbm_surface_lock_front_buffer(platform.gbmSurface);
-    if (!bo) TRACELOG(LOG_ERROR, "DISPLAY: Failed GBM to lock front buffer");
+    if (!bo)
+    {
+        TRACELOG(LOG_ERROR, "DISPLAY: Failed GBM to lock front buffer");
+        return;
+    }
 
-    uint32_t fb = 0;
-    int result = drmModeAddFB(platform.fd, platform.connector->modes[platform.modeIndex].hdisplay, platform.connector->modes[platform.modeIndex].vdisplay, 24, 32, gbm_bo_get_stride(bo), gbm_bo_get_handle(bo).u32, &fb);
-    if (result != 0) TRACELOG(LOG_ERROR, "DISPLAY: drmModeAddFB() failed with result: %d", result);
+    uint32_t fb = GetBufferFramebuffer(bo);
 
-    result = drmModeSetCrtc(platform.fd, platform.crtc->crtc_id, fb, 0, 0, &platform.connector->connector_id, 1, &platform.connector->modes[platform.modeIndex]);
-    if (result != 0) TRACELOG(LOG_ERROR, "DISPLAY: drmModeSetCrtc() failed with result: %d", result);
+#if defined(SUPPORT_DRM_TRIPLE_BUFFERING)
+    // Previous frame could still be waiting to be displayed, only one page flip can be queued
+    WaitPageFlip();
+#endif
 
-    if (platform.prevFB)
+    if ((platform.frontBO != NULL) && platform.pageFlip)
     {
-        result = drmModeRmFB(platform.fd, platform.prevFB);
-        if (result != 0) TRACELOG(LOG_ERROR, "DISPLAY: drmModeRmFB() failed with result: %d", result);
+        int result = drmModePageFlip(platform.fd, platform.crtc->crtc_id, fb, DRM_MODE_PAGE_FLIP_EVENT, NULL);
+
+        if (result == 0)
+        {
+            platform.pendingBO = bo;
+
+        #if !defined(SUPPORT_DRM_TRIPLE_BUFFERING)
+            WaitPageFlip();     // Frame is displayed on return, next frame is rendered on a free buffer
+        #endif
+            return;
+        }
+
+        TRACELOG(LOG_WARNING, "DISPLAY: drmModePageFlip() failed with result: %d, using drmModeSetCrtc()", result);
+        platform.pageFlip = false;
     }
 
-    platform.prevFB = fb;
+    // Set display mode with provided framebuffer (first frame or page flip not supported)
+    int result = drmModeSetCrtc(platform.fd, platform.crtc->crtc_id, fb, 0, 0, &platform.connector->connector_id, 1, &platform.connector->modes[platform.modeIndex]);
+    if (result != 0) TRACELOG(LOG_ERROR, "DISPLAY: drmModeSetCrtc() failed with result: %d", result);
 
-    if (platform.prevBO) gbm_surface_release_buffer(platform.gbmSurface, platform.prevBO);
+    if (platform.frontBO) gbm_surface_release_buffer(platform.gbmSurface, platform.frontBO);
 
-    platform.prevBO = bo;
+    platform.frontBO = bo;
 }
 
 //----------------------------------------------------------------------------------
@@ -659,6 +717,9 @@ void PollInputEvents(void)
         CORE.Input.Keyboard.keyRepeatInFrame[i] = 0;
     }
 
+    // Check evdev devices with pending events, idle devices are not read
+    platform.evdevReady = GetEvdevReadyDevices();
+
     PollKeyboardEvents();
 
 #if defined(SUPPORT_SSH_KEYBOARD_RPI)
@@ -715,8 +776,9 @@ int InitPlatform(void)
     platform.crtc = NULL;
     platform.gbmDevice = NULL;
     platform.gbmSurface = NULL;
-    platform.prevBO = NULL;
-    platform.prevFB = 0;
+    platform.frontBO = NULL;
+    platform.pendingBO = NULL;
+    platform.pageFlip = true;
 
     // Initialize graphic device: display/window and graphic context
     //----------------------------------------------------------------------------
@@ -1078,16 +1140,13 @@ int InitPlatform(void)
 // Close platform
 void ClosePlatform(void)
 {
-    if (platform.prevFB)
-    {
-        drmModeRmFB(platform.fd, platform.prevFB);
-        platform.prevFB = 0;
-    }
+    // NOTE: Framebuffers are destroyed with GBM surface buffer objects
+    WaitPageFlip();
 
-    if (platform.prevBO)
+    if (platform.frontBO)
     {
-        gbm_surface_release_buffer(platform.gbmSurface, platform.prevBO);
-        platform.prevBO = NULL;
+        gbm_surface_release_buffer(platform.gbmSurface, platform.frontBO);
+        platform.frontBO = NULL;
     }
 
     if (platform.gbmSurface)
@@ -1162,6 +1221,12 @@ void ClosePlatform(void)
         close(platform.keyboardFd);
         platform.keyboardFd = -1;
     }
+
+    if (platform.epollFd != -1)
+    {
+        close(platform.epollFd);
+        platform.epollFd = -1;
+    }
 }
 
 #if defined(SUPPORT_SSH_KEYBOARD_RPI)
@@ -1337,6 +1402,11 @@ static void InitEvdevInput(void)
     platform.keyboardFd = -1;
     platform.mouseFd = -1;
 
+    // Initialise epoll instance to check evdev devices with pending events
+    // NOTE: If not available, all devices are read every frame
+    platform.epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (platform.epollFd == -1) TRACELOG(LOG_WARNING, "INPUT: Failed to create epoll instance, all input devices will be read");
+
     // Reset variables
     for (int i = 0; i < MAX_TOUCH_POINTS; ++i)
     {
@@ -1509,6 +1579,7 @@ static void ConfigureEvdevDevice(char *device)
         deviceKindStr = "mouse";
         if (platform.mouseFd != -1) close(platform.mouseFd);
         platform.mouseFd = fd;
+        RegisterEvdevDevice(fd, EVDEV_DEVICE_MOUSE);
 
         if (absAxisCount > 0)
         {
@@ -1526,6 +1597,7 @@ static void ConfigureEvdevDevice(char *device)
 
         platform.gamepadStreamFd[index] = fd;
         CORE.Input.Gamepad.ready[index] = true;
+        RegisterEvdevDevice(fd, EVDEV_DEVICE_GAMEPAD + index);
 
         ioctl(platform.gamepadStreamFd[index], EVIOCGNAME(64), &CORE.Input.Gamepad.name[index]);
         CORE.Input.Gamepad.axisCount[index] = absAxisCount;
@@ -1558,6 +1630,7 @@ static void ConfigureEvdevDevice(char *device)
     {
         deviceKindStr = "keyboard";
         platform.keyboardFd = fd;
+        RegisterEvdevDevice(fd, EVDEV_DEVICE_KEYBOARD);
     }
     else
     {
@@ -1568,71 +1641,120 @@ static void ConfigureEvdevDevice(char *device)
     TRACELOG(LOG_INFO, "INPUT: Initialized input device %s as %s", device, deviceKindStr);
 }
 
+// Register evdev device to be checked for pending events
+// NOTE: Closing the device file descriptor also removes it from epoll instance
+static void RegisterEvdevDevice(int fd, int id)
+{
+    if (platform.epollFd == -1) return;
+
+    struct epoll_event event = { 0 };
+    event.events = EPOLLIN;
+    event.data.u32 = id;
+
+    if (epoll_ctl(platform.epollFd, EPOLL_CTL_ADD, fd, &event) == -1) TRACELOG(LOG_WARNING, "INPUT: Failed to register input device for events checking");
+}
+
+// Get evdev devices with pending events (bit per device id)
+// NOTE: All devices are checked with one non-blocking syscall per frame
+static unsigned int GetEvdevReadyDevices(void)
+{
+    if (platform.epollFd == -1) return ~0u;    // All devices must be read
+
+    struct epoll_event events[EVDEV_MAX_DEVICES] = { 0 };
+    unsigned int ready = 0;
+
+    int count = epoll_wait(platform.epollFd, events, EVDEV_MAX_DEVICES, 0);
+    for (int i = 0; i < count; i++) ready |= (1u << events[i].data.u32);
+
+    return ready;
+}
+
+// Read available evdev events in bulk, up to EVDEV_EVENTS_BATCH_SIZE events
+// NOTE: Devices are opened in non-blocking mode, evdev read() only returns complete events
+static int ReadEvdevEvents(int fd, struct input_event *events)
+{
+    int count = 0;
+
+    ssize_t size = read(fd, events, EVDEV_EVENTS_BATCH_SIZE*sizeof(struct input_event));
+    if (size > 0) count = (int)(size/sizeof(struct input_event));
+
+    return count;
+}
+
 // Poll and process evdev keyboard events
 static void PollKeyboardEvents(void)
 {
     int fd = platform.keyboardFd;
-    if (fd == -1) return;
+    if ((fd == -1) || !(platform.evdevReady & (1u << EVDEV_DEVICE_KEYBOARD))) return;
 
-    struct input_event event = { 0 };
+    struct input_event events[EVDEV_EVENTS_BATCH_SIZE] = { 0 };
+    int eventCount = 0;
     int keycode = -1;
 
-    // Try to read data from the keyboard and only continue if successful
-    while (read(fd, &event, sizeof(event)) == (int)sizeof(event))
+    // Read data from the keyboard in batches, until all available events are processed
+    do
     {
-        // Check if the event is a key event
-        if (event.type != EV_KEY) continue;
-
-#if defined(SUPPORT_SSH_KEYBOARD_RPI)
-        // If the event was a key, we know a working keyboard is connected, so disable the SSH keyboard
-        platform.eventKeyboardMode = true;
-#endif
+        eventCount = ReadEvdevEvents(fd, events);
 
-        // Keyboard keys appear for codes 1 to 255, ignore everthing else
-        if ((event.code >= 1) && (event.code <= 255))
+        for (int e = 0; e < eventCount; e++)
         {
+            struct input_event event = events[e];
 
-            // Lookup the scancode in the keymap to get a keycode
-            keycode = linuxToRaylibMap[event.code];
+            // Check if the event is a key event
+            if (event.type != EV_KEY) continue;
 
-            // Make sure we got a valid keycode
-            if ((keycode > 0) && (keycode < MAX_KEYBOARD_KEYS))
+#if defined(SUPPORT_SSH_KEYBOARD_RPI)
+            // If the event was a key, we know a working keyboard is connected, so disable the SSH keyboard
+            platform.eventKeyboardMode = true;
+#endif
+
+            // Keyboard keys appear for codes 1 to 255, ignore everthing else
+            if ((event.code >= 1) && (event.code <= 255))
             {
 
-                // WARNING: https://www.kernel.org/doc/Documentation/input/input.txt
-                // Event interface: 'value' is the value the event carries. Either a relative change for EV_REL,
-                // absolute new value for EV_ABS (joysticks ...), or 0 for EV_KEY for release, 1 for keypress and 2 for autorepeat
-                CORE.Input.Keyboard.currentKeyState[keycode] = (event.value >= 1);
-                CORE.Input.Keyboard.keyRepeatInFrame[keycode] = (event.value == 2);
+                // Lookup the scancode in the keymap to get a keycode
+                keycode = linuxToRaylibMap[event.code];
 
-                // If the key is pressed add it to the queues
-                if (event.value == 1)
+                // Make sure we got a valid keycode
+                if ((keycode > 0) && (keycode < MAX_KEYBOARD_KEYS))
                 {
-                    if (CORE.Input.Keyboard.keyPressedQueueCount < MAX_CHAR_PRESSED_QUEUE)
-                    {
-                        CORE.Input.Keyboard.keyPressedQueue[CORE.Input.Keyboard.keyPressedQueueCount] = keycode;
-                        CORE.Input.Keyboard.keyPressedQueueCount++;
-                    }
 
-                    if (CORE.Input.Keyboard.charPressedQueueCount < MAX_CHAR_PRESSED_QUEUE)
+                    // WARNING: https://www.kernel.org/doc/Documentation/input/input.txt
+                    // Event interface: 'value' is the value the event carries. Either a relative change for EV_REL,
+                    // absolute new value for EV_ABS (joysticks ...), or 0 for EV_KEY for release, 1 for keypress and 2 for autorepeat
+                    CORE.Input.Keyboard.currentKeyState[keycode] = (event.value >= 1);
+                    CORE.Input.Keyboard.keyRepeatInFrame[keycode] = (event.value == 2);
+
+                    // If the key is pressed add it to the queues
+                    if (event.value == 1)
                     {
-                        // TODO/FIXME: This is not actually converting to unicode properly because it's not taking things like shift into account
-                        CORE.Input.Keyboard.charPressedQueue[CORE.Input.Keyboard.charPressedQueueCount] = evkeyToUnicodeLUT[event.code];
-                        CORE.Input.Keyboard.charPressedQueueCount++;
+                        if (CORE.Input.Keyboard.keyPressedQueueCount < MAX_CHAR_PRESSED_QUEUE)
+                        {
+                            CORE.Input.Keyboard.keyPressedQueue[CORE.Input.Keyboard.keyPressedQueueCount] = keycode;
+                            CORE.Input.Keyboard.keyPressedQueueCount++;
+                        }
+
+                        if (CORE.Input.Keyboard.charPressedQueueCount < MAX_CHAR_PRESSED_QUEUE)
+                        {
+                            // TODO/FIXME: This is not actually converting to unicode properly because it's not taking things like shift into account
+                            CORE.Input.Keyboard.charPressedQueue[CORE.Input.Keyboard.charPressedQueueCount] = evkeyToUnicodeLUT[event.code];
+                            CORE.Input.Keyboard.charPressedQueueCount++;
+                        }
                     }
-                }
 
-                TRACELOG(LOG_DEBUG, "INPUT: KEY_%s Keycode(linux): %4i KeyCode(raylib): %4i", (event.value == 0)? "UP  " : "DOWN", event.code, keycode);
+                    TRACELOG(LOG_DEBUG, "INPUT: KEY_%s Keycode(linux): %4i KeyCode(raylib): %4i", (event.value == 0)? "UP  " : "DOWN", event.code, keycode);
+                }
             }
         }
-    }
+    } while (eventCount == EVDEV_EVENTS_BATCH_SIZE);
 }
 
 // Poll gamepad input events
 static void PollGamepadEvents(void)
 {
-    // Read gamepad event
-    struct input_event event = { 0 };
+    // Read gamepad events
+    struct input_event events[EVDEV_EVENTS_BATCH_SIZE] = { 0 };
+    int eventCount = 0;
 
     for (int i = 0; i < platform.gamepadCount; i++)
     {
@@ -1641,210 +1763,339 @@ static void PollGamepadEvents(void)
         // Register previous gamepad states
         for (int k = 0; k < MAX_GAMEPAD_BUTTONS; k++) CORE.Input.Gamepad.previousButtonState[i][k] = CORE.Input.Gamepad.currentButtonState[i][k];
 
-        while (read(platform.gamepadStreamFd[i], &event, sizeof(event)) == (int)sizeof(event))
+        if (!(platform.evdevReady & (1u << (EVDEV_DEVICE_GAMEPAD + i)))) continue;
+
+        do
         {
-            if (event.type == EV_KEY)
+            eventCount = ReadEvdevEvents(platform.gamepadStreamFd[i], events);
+
+            for (int e = 0; e < eventCount; e++)
             {
-                if (event.code < KEYMAP_SIZE)
+                struct input_event event = events[e];
+
+                if (event.type == EV_KEY)
                 {
-                    short keycodeRaylib = linuxToRaylibMap[event.code];
+                    if (event.code < KEYMAP_SIZE)
+                    {
+                        short keycodeRaylib = linuxToRaylibMap[event.code];
 
-                    TRACELOG(LOG_DEBUG, "INPUT: Gamepad %2i: KEY_%s Keycode(linux): %4i Keycode(raylib): %4i", i, (event.value == 0)? "UP" : "DOWN", event.code, keycodeRaylib);
+                        TRACELOG(LOG_DEBUG, "INPUT: Gamepad %2i: KEY_%s Keycode(linux): %4i Keycode(raylib): %4i", i, (event.value == 0)? "UP" : "DOWN", event.code, keycodeRaylib);
 
-                    if ((keycodeRaylib != 0) && (keycodeRaylib < MAX_GAMEPAD_BUTTONS))
-                    {
-                        // 1 - button pressed, 0 - button released
-                        CORE.Input.Gamepad.currentButtonState[i][keycodeRaylib] = event.value;
+                        if ((keycodeRaylib != 0) && (keycodeRaylib < MAX_GAMEPAD_BUTTONS))
+                        {
+                            // 1 - button pressed, 0 - button released
+                            CORE.Input.Gamepad.currentButtonState[i][keycodeRaylib] = event.value;
 
-                        CORE.Input.Gamepad.lastButtonPressed = (event.value == 1)? keycodeRaylib : GAMEPAD_BUTTON_UNKNOWN;
+                            CORE.Input.Gamepad.lastButtonPressed = (event.value == 1)? keycodeRaylib : GAMEPAD_BUTTON_UNKNOWN;
+                        }
                     }
                 }
-            }
-            else if (event.type == EV_ABS)
-            {
-                if (event.code < ABS_CNT)
+                else if (event.type == EV_ABS)
                 {
-                    int axisRaylib = platform.gamepadAbsAxisMap[i][event.code];
+                    if (event.code < ABS_CNT)
+                    {
+                        int axisRaylib = platform.gamepadAbsAxisMap[i][event.code];
 
-                    TRACELOG(LOG_DEBUG, "INPUT: Gamepad %2i: Axis: %2i Value: %i", i, axisRaylib, event.value);
+                        TRACELOG(LOG_DEBUG, "INPUT: Gamepad %2i: Axis: %2i Value: %i", i, axisRaylib, event.value);
 
-                    if (axisRaylib < MAX_GAMEPAD_AXIS)
-                    {
-                        int min = platform.gamepadAbsAxisRange[i][event.code][0];
-                        int range = platform.gamepadAbsAxisRange[i][event.code][1];
+                        if (axisRaylib < MAX_GAMEPAD_AXIS)
+                        {
+                            int min = platform.gamepadAbsAxisRange[i][event.code][0];
+                            int range = platform.gamepadAbsAxisRange[i][event.code][1];
 
-                        // NOTE: Scaling of event.value to get values between -1..1
-                        CORE.Input.Gamepad.axisState[i][axisRaylib] = (2*(float)(event.value - min)/range) - 1;
+                            // NOTE: Scaling of event.value to get values between -1..1
+                            CORE.Input.Gamepad.axisState[i][axisRaylib] = (2*(float)(event.value - min)/range) - 1;
+                        }
                     }
                 }
             }
-        }
+        } while (eventCount == EVDEV_EVENTS_BATCH_SIZE);
     }
 }
 
 // Poll mouse input events
+// NOTE: Events are processed in packets (terminated by SYN_REPORT), relative motion deltas are accumulated
+// and consecutive move actions are coalesced, only one gesture move event is processed with latest positions
 static void PollMouseEvents(void)
 {
     int fd = platform.mouseFd;
-    if (fd == -1) return;
+    if ((fd == -1) || !(platform.evdevReady & (1u << EVDEV_DEVICE_MOUSE))) return;
 
-    struct input_event event = { 0 };
+    struct input_event events[EVDEV_EVENTS_BATCH_SIZE] = { 0 };
+    int eventCount = 0;
     int touchAction = -1;           // 0-TOUCH_ACTION_UP, 1-TOUCH_ACTION_DOWN, 2-TOUCH_ACTION_MOVE
+#if defined(SUPPORT_GESTURES_SYSTEM)
+    bool touchMovePending = false;  // Coalesced move action pending to be processed
+#endif
 
-    // Try to read data from the mouse/touch/gesture and only continue if successful
-    while (read(fd, &event, sizeof(event)) == (int)sizeof(event))
+    // Read data from the mouse/touch/gesture in batches, until all available events are processed
+    do
     {
-        // Relative movement parsing
-        if (event.type == EV_REL)
+        eventCount = ReadEvdevEvents(fd, events);
+
+        for (int e = 0; e < eventCount; e++)
         {
-            if (event.code == REL_X)
+            struct input_event event = events[e];
+
+            // Relative movement parsing
+            if (event.type == EV_REL)
             {
-                if (platform.cursorRelative)
+                // NOTE: In relative mode, mouse position is reset every frame, deltas are accumulated
+                if (event.code == REL_X)
                 {
-                    CORE.Input.Mouse.currentPosition.x = event.value;
-                    CORE.Input.Mouse.previousPosition.x = 0.0f;
+                    CORE.Input.Mouse.currentPosition.x += event.value;
+                    if (platform.cursorRelative) CORE.Input.Mouse.previousPosition.x = 0.0f;
+
+                    CORE.Input.Touch.position[0].x = CORE.Input.Mouse.currentPosition.x;
+                    if (touchAction == -1) touchAction = 2;    // TOUCH_ACTION_MOVE
+                }
+
+                if (event.code == REL_Y)
+                {
+                    CORE.Input.Mouse.currentPosition.y += event.value;
+                    if (platform.cursorRelative) CORE.Input.Mouse.previousPosition.y = 0.0f;
+
+                    CORE.Input.Touch.position[0].y = CORE.Input.Mouse.currentPosition.y;
+                    if (touchAction == -1) touchAction = 2;    // TOUCH_ACTION_MOVE
                 }
-                else CORE.Input.Mouse.currentPosition.x += event.value;
 
-                CORE.Input.Touch.position[0].x = CORE.Input.Mouse.currentPosition.x;
-                touchAction = 2;    // TOUCH_ACTION_MOVE
+                if (event.code == REL_WHEEL) platform.eventWheelMove.y += event.value;
             }
 
-            if (event.code == REL_Y)
+            // Absolute movement parsing
+            if (event.type == EV_ABS)
             {
-                if (platform.cursorRelative)
+                // Basic movement
+                if (event.code == ABS_X)
                 {
-                    CORE.Input.Mouse.currentPosition.y = event.value;
-                    CORE.Input.Mouse.previousPosition.y = 0.0f;
+                    CORE.Input.Mouse.currentPosition.x = (event.value - platform.absRange.x)*CORE.Window.screen.width/platform.absRange.width;    // Scale according to absRange
+                    CORE.Input.Touch.position[0].x = (event.value - platform.absRange.x)*CORE.Window.screen.width/platform.absRange.width;        // Scale according to absRange
+
+                    if (touchAction == -1) touchAction = 2;    // TOUCH_ACTION_MOVE
                 }
-                else CORE.Input.Mouse.currentPosition.y += event.value;
 
-                CORE.Input.Touch.position[0].y = CORE.Input.Mouse.currentPosition.y;
-                touchAction = 2;    // TOUCH_ACTION_MOVE
-            }
+                if (event.code == ABS_Y)
+                {
+                    CORE.Input.Mouse.currentPosition.y = (event.value - platform.absRange.y)*CORE.Window.screen.height/platform.absRange.height;  // Scale according to absRange
+                    CORE.Input.Touch.position[0].y = (event.value - platform.absRange.y)*CORE.Window.screen.height/platform.absRange.height;      // Scale according to absRange
 
-            if (event.code == REL_WHEEL) platform.eventWheelMove.y += event.value;
-        }
+                    if (touchAction == -1) touchAction = 2;    // TOUCH_ACTION_MOVE
+                }
 
-        // Absolute movement parsing
-        if (event.type == EV_ABS)
-        {
-            // Basic movement
-            if (event.code == ABS_X)
-            {
-                CORE.Input.Mouse.currentPosition.x = (event.value - platform.absRange.x)*CORE.Window.screen.width/platform.absRange.width;    // Scale according to absRange
-                CORE.Input.Touch.position[0].x = (event.value - platform.absRange.x)*CORE.Window.screen.width/platform.absRange.width;        // Scale according to absRange
+                // Multitouch movement
+                if (event.code == ABS_MT_SLOT) platform.touchSlot = event.value;   // Remember the slot number for the folowing events
 
-                touchAction = 2;    // TOUCH_ACTION_MOVE
-            }
+                if (event.code == ABS_MT_POSITION_X)
+                {
+                    if (platform.touchSlot < MAX_TOUCH_POINTS) CORE.Input.Touch.position[platform.touchSlot].x = (event.value - platform.absRange.x)*CORE.Window.screen.width/platform.absRange.width;    // Scale according to absRange
+                }
 
-            if (event.code == ABS_Y)
-            {
-                CORE.Input.Mouse.currentPosition.y = (event.value - platform.absRange.y)*CORE.Window.screen.height/platform.absRange.height;  // Scale according to absRange
-                CORE.Input.Touch.position[0].y = (event.value - platform.absRange.y)*CORE.Window.screen.height/platform.absRange.height;      // Scale according to absRange
+                if (event.code == ABS_MT_POSITION_Y)
+                {
+                    if (platform.touchSlot < MAX_TOUCH_POINTS) CORE.Input.Touch.position[platform.touchSlot].y = (event.value - platform.absRange.y)*CORE.Window.screen.height/platform.absRange.height;  // Scale according to absRange
+                }
 
-                touchAction = 2;    // TOUCH_ACTION_MOVE
-            }
+                if (event.code == ABS_MT_TRACKING_ID)
+                {
+                    if ((event.value < 0) && (platform.touchSlot < MAX_TOUCH_POINTS))
+                    {
+                        // Touch has ended for this point
+                        CORE.Input.Touch.position[platform.touchSlot].x = -1;
+                        CORE.Input.Touch.position[platform.touchSlot].y = -1;
+                    }
+                }
 
-            // Multitouch movement
-            if (event.code == ABS_MT_SLOT) platform.touchSlot = event.value;   // Remember the slot number for the folowing events
+                // Touchscreen tap
+                if (event.code == ABS_PRESSURE)
+                {
+                    int previousMouseLeftButtonState = platform.currentButtonStateEvdev[MOUSE_BUTTON_LEFT];
 
-            if (event.code == ABS_MT_POSITION_X)
-            {
-                if (platform.touchSlot < MAX_TOUCH_POINTS) CORE.Input.Touch.position[platform.touchSlot].x = (event.value - platform.absRange.x)*CORE.Window.screen.width/platform.absRange.width;    // Scale according to absRange
-            }
+                    if (!event.value && previousMouseLeftButtonState)
+                    {
+                        platform.currentButtonStateEvdev[MOUSE_BUTTON_LEFT] = 0;
+                        touchAction = 0;    // TOUCH_ACTION_UP
+                    }
+
+                    if (event.value && !previousMouseLeftButtonState)
+                    {
+                        platform.currentButtonStateEvdev[MOUSE_BUTTON_LEFT] = 1;
+                        touchAction = 1;    // TOUCH_ACTION_DOWN
+                    }
+                }
 
-            if (event.code == ABS_MT_POSITION_Y)
-            {
-                if (platform.touchSlot < MAX_TOUCH_POINTS) CORE.Input.Touch.position[platform.touchSlot].y = (event.value - platform.absRange.y)*CORE.Window.screen.height/platform.absRange.height;  // Scale according to absRange
             }
 
-            if (event.code == ABS_MT_TRACKING_ID)
+            // Button parsing
+            if (event.type == EV_KEY)
             {
-                if ((event.value < 0) && (platform.touchSlot < MAX_TOUCH_POINTS))
+                // Mouse button parsing
+                if ((event.code == BTN_TOUCH) || (event.code == BTN_LEFT))
                 {
-                    // Touch has ended for this point
-                    CORE.Input.Touch.position[platform.touchSlot].x = -1;
-                    CORE.Input.Touch.position[platform.touchSlot].y = -1;
+                    platform.currentButtonStateEvdev[MOUSE_BUTTON_LEFT] = event.value;
+
+                    if (event.value > 0) touchAction = 1;   // TOUCH_ACTION_DOWN
+                    else touchAction = 0;       // TOUCH_ACTION_UP
                 }
+
+                if (event.code == BTN_RIGHT) platform.currentButtonStateEvdev[MOUSE_BUTTON_RIGHT] = event.value;
+                if (event.code == BTN_MIDDLE) platform.currentButtonStateEvdev[MOUSE_BUTTON_MIDDLE] = event.value;
+                if (event.code == BTN_SIDE) platform.currentButtonStateEvdev[MOUSE_BUTTON_SIDE] = event.value;
+                if (event.code == BTN_EXTRA) platform.currentButtonStateEvdev[MOUSE_BUTTON_EXTRA] = event.value;
+                if (event.code == BTN_FORWARD) platform.currentButtonStateEvdev[MOUSE_BUTTON_FORWARD] = event.value;
+                if (event.code == BTN_BACK) platform.currentButtonStateEvdev[MOUSE_BUTTON_BACK] = event.value;
             }
 
-            // Touchscreen tap
-            if (event.code == ABS_PRESSURE)
+            // Events packet completed, update state from all packet events
+            // NOTE: Button actions take precedence over move action in the same packet
+            if ((event.type == EV_SYN) && (event.code == SYN_REPORT))
             {
-                int previousMouseLeftButtonState = platform.currentButtonStateEvdev[MOUSE_BUTTON_LEFT];
+                // Screen confinement
+                if (!CORE.Input.Mouse.cursorHidden)
+                {
+                    if (CORE.Input.Mouse.currentPosition.x < 0) CORE.Input.Mouse.currentPosition.x = 0;
+                    if (CORE.Input.Mouse.currentPosition.x > CORE.Window.screen.width/CORE.Input.Mouse.scale.x) CORE.Input.Mouse.currentPosition.x = CORE.Window.screen.width/CORE.Input.Mouse.scale.x;
 
-                if (!event.value && previousMouseLeftButtonState)
+                    if (CORE.Input.Mouse.currentPosition.y < 0) CORE.Input.Mouse.currentPosition.y = 0;
+                    if (CORE.Input.Mouse.currentPosition.y > CORE.Window.screen.height/CORE.Input.Mouse.scale.y) CORE.Input.Mouse.currentPosition.y = CORE.Window.screen.height/CORE.Input.Mouse.scale.y;
+                }
+
+                // Update touch point count
+                CORE.Input.Touch.pointCount = 0;
+                for (int i = 0; i < MAX_TOUCH_POINTS; i++)
                 {
-                    platform.currentButtonStateEvdev[MOUSE_BUTTON_LEFT] = 0;
-                    touchAction = 0;    // TOUCH_ACTION_UP
+                    if (CORE.Input.Touch.position[i].x >= 0) CORE.Input.Touch.pointCount++;
                 }
 
-                if (event.value && !previousMouseLeftButtonState)
+#if defined(SUPPORT_GESTURES_SYSTEM)
+                if (touchAction == 2) touchMovePending = true;
+                else if (touchAction > -1)
                 {
-                    platform.currentButtonStateEvdev[MOUSE_BUTTON_LEFT] = 1;
-                    touchAction = 1;    // TOUCH_ACTION_DOWN
+                    // Pending move action must be processed before button action
+                    if (touchMovePending) ProcessTouchGesture(2);
+                    touchMovePending = false;
+
+                    ProcessTouchGesture(touchAction);
                 }
+#endif
+                touchAction = -1;
             }
-
         }
+    } while (eventCount == EVDEV_EVENTS_BATCH_SIZE);
 
-        // Button parsing
-        if (event.type == EV_KEY)
-        {
-            // Mouse button parsing
-            if ((event.code == BTN_TOUCH) || (event.code == BTN_LEFT))
-            {
-                platform.currentButtonStateEvdev[MOUSE_BUTTON_LEFT] = event.value;
+#if defined(SUPPORT_GESTURES_SYSTEM)
+    if (touchMovePending) ProcessTouchGesture(2);   // TOUCH_ACTION_MOVE
+#endif
+}
 
-                if (event.value > 0) touchAction = 1;   // TOUCH_ACTION_DOWN
-                else touchAction = 0;       // TOUCH_ACTION_UP
-            }
+#if defined(SUPPORT_GESTURES_SYSTEM)
+// Process gesture event for touch action, using current touch points
+static void ProcessTouchGesture(int touchAction)
+{
+    GestureEvent gestureEvent = { 0 };
 
-            if (event.code == BTN_RIGHT) platform.currentButtonStateEvdev[MOUSE_BUTTON_RIGHT] = event.value;
-            if (event.code == BTN_MIDDLE) platform.currentButtonStateEvdev[MOUSE_BUTTON_MIDDLE] = event.value;
-            if (event.code == BTN_SIDE) platform.currentButtonStateEvdev[MOUSE_BUTTON_SIDE] = event.value;
-            if (event.code == BTN_EXTRA) platform.currentButtonStateEvdev[MOUSE_BUTTON_EXTRA] = event.value;
-            if (event.code == BTN_FORWARD) platform.currentButtonStateEvdev[MOUSE_BUTTON_FORWARD] = event.value;
-            if (event.code == BTN_BACK) platform.currentButtonStateEvdev[MOUSE_BUTTON_BACK] = event.value;
-        }
+    gestureEvent.touchAction = touchAction;
+    gestureEvent.pointCount = CORE.Input.Touch.pointCount;
 
-        // Screen confinement
-        if (!CORE.Input.Mouse.cursorHidden)
-        {
-            if (CORE.Input.Mouse.currentPosition.x < 0) CORE.Input.Mouse.currentPosition.x = 0;
-            if (CORE.Input.Mouse.currentPosition.x > CORE.Window.screen.width/CORE.Input.Mouse.scale.x) CORE.Input.Mouse.currentPosition.x = CORE.Window.screen.width/CORE.Input.Mouse.scale.x;
+    for (int i = 0; i < MAX_TOUCH_POINTS; i++)
+    {
+        gestureEvent.pointId[i] = i;
+        gestureEvent.position[i] = CORE.Input.Touch.position[i];
+    }
 
-            if (CORE.Input.Mouse.currentPosition.y < 0) CORE.Input.Mouse.currentPosition.y = 0;
-            if (CORE.Input.Mouse.currentPosition.y > CORE.Window.screen.height/CORE.Input.Mouse.scale.y) CORE.Input.Mouse.currentPosition.y = CORE.Window.screen.height/CORE.Input.Mouse.scale.y;
-        }
+    ProcessGestureEvent(gestureEvent);
+}
+#endif
+
+// Get DRM framebuffer for GBM buffer object
+// NOTE: GBM surface buffer objects are reused between frames, framebuffer is created on first
+// use and cached with the buffer object, it is destroyed with the buffer object
+static uint32_t GetBufferFramebuffer(struct gbm_bo *bo)
+{
+    uint32_t *fb = (uint32_t *)gbm_bo_get_user_data(bo);
+
+    if (fb == NULL)
+    {
+        fb = (uint32_t *)RL_CALLOC(1, sizeof(uint32_t));
 
-        // Update touch point count
-        CORE.Input.Touch.pointCount = 0;
-        for (int i = 0; i < MAX_TOUCH_POINTS; i++)
+        int result = drmModeAddFB(platform.fd, gbm_bo_get_width(bo), gbm_bo_get_height(bo), 24, 32, gbm_bo_get_stride(bo), gbm_bo_get_handle(bo).u32, fb);
+        if (result != 0)
         {
-            if (CORE.Input.Touch.position[i].x >= 0) CORE.Input.Touch.pointCount++;
+            TRACELOG(LOG_ERROR, "DISPLAY: drmModeAddFB() failed with result: %d", result);
+            RL_FREE(fb);
+            return 0;
         }
 
-#if defined(SUPPORT_GESTURES_SYSTEM)
-        if (touchAction > -1)
+        gbm_bo_set_user_data(bo, fb, DestroyBufferFramebuffer);
+        TRACELOG(LOG_DEBUG, "DISPLAY: Framebuffer [ID %u] created for GBM buffer object", *fb);
+    }
+
+    return *fb;
+}
+
+// Destroy DRM framebuffer cached with GBM buffer object
+static void DestroyBufferFramebuffer(struct gbm_bo *bo, void *data)
+{
+    uint32_t *fb = (uint32_t *)data;
+
+    (void)bo;
+
+    if ((fb != NULL) && (platform.fd != -1))
+    {
+        int result = drmModeRmFB(platform.fd, *fb);
+        if (result != 0) TRACELOG(LOG_ERROR, "DISPLAY: drmModeRmFB() failed with result: %d", result);
+    }
+
+    RL_FREE(fb);
+}
+
+// Page flip completion event handler
+// NOTE: Previous front buffer is not scanned out anymore, it can be reused for rendering
+static void PageFlipHandler(int fd, unsigned int frame, unsigned int sec, unsigned int usec, void *data)
+{
+    (void)fd; (void)frame; (void)sec; (void)usec; (void)data;
+
+    if (platform.frontBO) gbm_surface_release_buffer(platform.gbmSurface, platform.frontBO);
+
+    platform.frontBO = platform.pendingBO;
+    platform.pendingBO = NULL;
+}
+
+// Wait for pending page flip completion, processing DRM events
+static void WaitPageFlip(void)
+{
+    drmEventContext context = { 0 };
+    context.version = DRM_EVENT_CONTEXT_VERSION;
+    context.page_flip_handler = PageFlipHandler;
+
+    while (platform.pendingBO != NULL)
+    {
+        struct pollfd pfd = { 0 };
+        pfd.fd = platform.fd;
+        pfd.events = POLLIN;
+
+        int result = poll(&pfd, 1, DRM_PAGE_FLIP_TIMEOUT);
+
+        if (result > 0) drmHandleEvent(platform.fd, &context);
+        else if ((result < 0) && (errno == EINTR)) continue;
+        else
         {
-            GestureEvent gestureEvent = { 0 };
+            // Avoid blocking forever, queued buffer is displayed with drmModeSetCrtc() and page flipping is disabled
+            // NOTE: Front buffer could still be scanned out, it is only released once queued buffer is displayed
+            TRACELOG(LOG_WARNING, "DISPLAY: Page flip event not received, using drmModeSetCrtc()");
+            platform.pageFlip = false;
 
-            gestureEvent.touchAction = touchAction;
-            gestureEvent.pointCount = CORE.Input.Touch.pointCount;
+            uint32_t fb = GetBufferFramebuffer(platform.pendingBO);
+            result = drmModeSetCrtc(platform.fd, platform.crtc->crtc_id, fb, 0, 0, &platform.connector->connector_id, 1, &platform.connector->modes[platform.modeIndex]);
 
-            for (int i = 0; i < MAX_TOUCH_POINTS; i++)
+            if (result == 0) PageFlipHandler(platform.fd, 0, 0, 0, NULL);
+            else
             {
-                gestureEvent.pointId[i] = i;
-                gestureEvent.position[i] = CORE.Input.Touch.position[i];
+                // Scanned out buffer is unknown, previous front buffer is kept locked (never reused for rendering)
+                TRACELOG(LOG_ERROR, "DISPLAY: drmModeSetCrtc() failed with result: %d", result);
+                platform.frontBO = platform.pendingBO;
+                platform.pendingBO = NULL;
             }
-
-            ProcessGestureEvent(gestureEvent);
-
-            touchAction = -1;
         }
-#endif
     }
 }
 
@@ -43,7 +43,6 @@
 *       [rtextures] stb_image_resize2 (Sean Barret) for image resizing algorithms
 *       [rtextures] stb_perlin (Sean Barret) for Perlin Noise image generation
 *       [rtext] stb_truetype (Sean Barret) for ttf fonts loading
-*       [rtext] stb_rect_pack (Sean Barret) for rectangles packing
 *       [rmodels] par_shapes (Philip Rideout) for parametric 3d shapes generation
 *       [rmodels] tinyobj_loader_c (Syoyo Fujita) for models loading (OBJ, MTL)
 *       [rmodels] cgltf (Johannes Kuhlmann) for models loading (glTF)
@@ -312,6 +311,17 @@ typedef struct GlyphInfo {
     Image image;            // Character image data
 } GlyphInfo;
 
+// KerningPair, font kerning between two characters
+typedef struct KerningPair {
+    int first;              // First character value (Unicode)
+    int second;             // Second character value (Unicode)
+    float advance;          // Advance adjustment, in pixels at font base size
+} KerningPair;
+
+// Opaque structs declaration
+// NOTE: Actual structs are defined internally in rtext module
+typedef struct rGlyphCache rGlyphCache;
+
 // Font, font texture and GlyphInfo array data
 typedef struct Font {
     int baseSize;           // Base size (default chars height)
@@ -320,8 +330,37 @@ typedef struct Font {
     Texture2D texture;      // Texture atlas containing the glyphs
     Rectangle *recs;        // Rectangles in texture for the glyphs
     GlyphInfo *glyphs;      // Glyphs info data
+    int kerningCount;       // Number of kerning pairs
+    KerningPair *kerning;   // Kerning pairs, sorted by first and second characters (SUPPORT_FONT_KERNING)
+    rGlyphCache *cache;     // Dynamic glyphs cache (on-demand rasterization), NULL for static fonts
 } Font;
 
+// TextLine, text layout line metrics
+typedef struct TextLine {
+    int textStart;          // Line first byte position in text
+    int textLength;         // Line length in bytes (including line break and wrapped spaces)
+    int glyphStart;         // Line first glyph quad in layout
+    int glyphCount;         // Line glyphs quads count
+    float width;            // Line width
+    float offsetY;          // Line vertical offset (relative to layout position)
+} TextLine;
+
+// TextLayout, text glyphs quads and lines prepared once for repeated drawing
+typedef struct TextLayout {
+    Font font;              // Font used for layout (not owned)
+    float fontSize;         // Font size used for layout
+    float spacing;          // Characters spacing used for layout
+    float wrapWidth;        // Lines maximum width, words are wrapped to next line (0 for no wrapping)
+    bool kerning;           // Font kerning pairs applied
+    Vector2 size;           // Layout size (lines bounding box)
+    int glyphCount;         // Number of glyphs quads
+    int *codepoints;        // Glyphs codepoints
+    Rectangle *recs;        // Glyphs quads rectangles (relative to layout position)
+    Rectangle *texcoords;   // Glyphs quads texture coordinates (normalized) in font atlas
+    int lineCount;          // Number of lines
+    TextLine *lines;        // Lines metrics
+} TextLayout;
+
 // Camera, defines position/orientation in 3d space
 typedef struct Camera3D {
     Vector3 position;       // Camera position
@@ -341,6 +380,12 @@ typedef struct Camera2D {
     float zoom;             // Camera zoom (scaling), should be 1.0f by default
 } Camera2D;
 
+// BoundingBox
+typedef struct BoundingBox {
+    Vector3 min;            // Minimum vertex box-corner
+    Vector3 max;            // Maximum vertex box-corner
+} BoundingBox;
+
 // Mesh, vertex data and vao/vbo
 typedef struct Mesh {
     int vertexCount;        // Number of vertices stored in arrays
@@ -354,6 +399,7 @@ typedef struct Mesh {
     float *tangents;        // Vertex tangents (XYZW - 4 components per vertex) (shader-location = 4)
     unsigned char *colors;      // Vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
     unsigned short *indices;    // Vertex indices (in case vertex data comes indexed)
+    unsigned int *indices32;    // Vertex indices 32-bit (used instead of indices for meshes with more than 65535 vertices)
 
     // Animation vertex data
     float *animVertices;    // Animated vertex positions (after bones transformations)
@@ -363,11 +409,33 @@ typedef struct Mesh {
     Matrix *boneMatrices;   // Bones animated transformation matrices
     int boneCount;          // Number of bones
 
+    // Mesh bounds, computed on UploadMesh() (used for culling)
+    BoundingBox bounds;     // Vertex positions bounds, mesh is not culled after positions buffer update until bounds change
+    int vertexFormat;       // Vertex data format in GPU, set on UploadMeshEx() (MeshVertexFormat flags)
+    bool dynamic;           // Vertex buffers usage in GPU, set on UploadMeshEx() (frequently updated)
+    Vector4 dequantize;     // Quantized positions offset (xyz) and scale (w), set on UploadMeshEx() (MESH_FORMAT_POSITION_INT16)
+
     // OpenGL identifiers
     unsigned int vaoId;     // OpenGL Vertex Array Object id
     unsigned int *vboId;    // OpenGL Vertex Buffer Objects id (default vertex data)
 } Mesh;
 
+// InstanceBuffer, per-instance attributes data stored in GPU (VRAM)
+// NOTE: Every attribute is stored in its own region of the buffer, so it can be updated partially and independently
+typedef struct InstanceBuffer {
+    unsigned int id;                // OpenGL vertex buffer object id
+    int capacity;                   // Maximum number of instances stored
+    unsigned int attributes;        // Instance attributes stored (InstanceAttribute flags)
+} InstanceBuffer;
+
+// MeshLod, mesh levels of detail, selected by screen size
+typedef struct MeshLod {
+    int levelCount;         // Number of levels of detail
+    Mesh *meshes;           // Meshes per level, from most to least detailed (not unloaded with MeshLod)
+    float *screenSizes;     // Minimum screen size per level (bounds sphere diameter/screen height)
+    BoundingBox bounds;     // Bounds containing all levels meshes
+} MeshLod;
+
 // Shader
 typedef struct Shader {
     unsigned int id;        // Shader program id
@@ -440,11 +508,10 @@ typedef struct RayCollision {
     Vector3 normal;         // Surface normal of hit
 } RayCollision;
 
-// BoundingBox
-typedef struct BoundingBox {
-    Vector3 min;            // Minimum vertex box-corner
-    Vector3 max;            // Maximum vertex box-corner
-} BoundingBox;
+// Frustum, view volume planes (planes normals pointing inside)
+typedef struct Frustum {
+    Vector4 planes[6];      // Frustum planes (normal: xyz, distance: w): left, right, bottom, top, near, far
+} Frustum;
 
 // Wave, audio wave data
 typedef struct Wave {
@@ -518,6 +585,21 @@ typedef struct FilePathList {
     char **paths;                   // Filepaths entries
 } FilePathList;
 
+// File mapping, read-only view of file data
+typedef struct FileMapping {
+    const unsigned char *data;      // File data (read-only)
+    long long size;                 // File data size in bytes
+    void *handle;                   // File mapping handle (custom providers data)
+    int type;                       // File mapping type (internal use)
+} FileMapping;
+
+// Hash state, incremental hash computation (MD5, SHA-1)
+typedef struct HashState {
+    unsigned int hash[5];           // Hash intermediate state
+    unsigned long long length;      // Data length processed (bytes)
+    unsigned char buffer[64];       // Data block pending to be processed
+} HashState;
+
 // Automation event
 typedef struct AutomationEvent {
     unsigned int frame;             // Event frame
@@ -801,7 +883,13 @@ typedef enum {
     SHADER_LOC_MAP_BRDF,            // Shader location: sampler2d texture: brdf
     SHADER_LOC_VERTEX_BONEIDS,      // Shader location: vertex attribute: boneIds
     SHADER_LOC_VERTEX_BONEWEIGHTS,  // Shader location: vertex attribute: boneWeights
-    SHADER_LOC_BONE_MATRICES        // Shader location: array of matrices uniform: boneMatrices
+    SHADER_LOC_BONE_MATRICES,       // Shader location: array of matrices uniform: boneMatrices
+    SHADER_LOC_INSTANCE_POSITION,   // Shader location: instance attribute: position and scale (quantized transform)
+    SHADER_LOC_INSTANCE_ROTATION,   // Shader location: instance attribute: rotation quaternion (quantized transform)
+    SHADER_LOC_INSTANCE_COLOR,      // Shader location: instance attribute: color
+    SHADER_LOC_INSTANCE_TEXRECT,    // Shader location: instance attribute: texcoords rectangle
+    SHADER_LOC_INSTANCE_CUSTOM,     // Shader location: instance attribute: custom vec4 array
+    SHADER_LOC_VERTEX_DEQUANTIZE    // Shader location: vector uniform: quantized vertex position offset (xyz) and scale (w)
 } ShaderLocationIndex;
 
 #define SHADER_LOC_MAP_DIFFUSE      SHADER_LOC_MAP_ALBEDO
@@ -820,6 +908,33 @@ typedef enum {
     SHADER_UNIFORM_SAMPLER2D        // Shader uniform type: sampler2d
 } ShaderUniformDataType;
 
+// Instance buffer attributes
+// NOTE: Flags can be combined, data expected on UpdateInstanceBuffer() per instance:
+//   INSTANCE_ATTRIB_TRANSFORM: float[16] column-major matrix (MatrixToFloatV())
+//   INSTANCE_ATTRIB_TRANSFORM_QUANTIZED: float[4] position + uniform scale, short[4] normalized rotation quaternion
+//   INSTANCE_ATTRIB_COLOR: Color, INSTANCE_ATTRIB_TEXRECT: Rectangle (normalized), INSTANCE_ATTRIB_CUSTOM0/1: Vector4
+typedef enum {
+    INSTANCE_ATTRIB_TRANSFORM = 1,              // Instance attribute: transform matrix (shader location: SHADER_LOC_MATRIX_MODEL)
+    INSTANCE_ATTRIB_TRANSFORM_QUANTIZED = 2,    // Instance attribute: quantized transform, 24 bytes (SHADER_LOC_INSTANCE_POSITION, SHADER_LOC_INSTANCE_ROTATION)
+    INSTANCE_ATTRIB_COLOR = 4,                  // Instance attribute: color (SHADER_LOC_INSTANCE_COLOR)
+    INSTANCE_ATTRIB_TEXRECT = 8,                // Instance attribute: texcoords rectangle (SHADER_LOC_INSTANCE_TEXRECT)
+    INSTANCE_ATTRIB_CUSTOM0 = 16,               // Instance attribute: custom vec4 (SHADER_LOC_INSTANCE_CUSTOM)
+    INSTANCE_ATTRIB_CUSTOM1 = 32                // Instance attribute: custom vec4 (SHADER_LOC_INSTANCE_CUSTOM + 1)
+} InstanceAttribute;
+
+// Mesh vertex formats for GPU vertex buffers
+// NOTE: Flags can be combined, CPU vertex data is kept as floats, only GPU buffers use the compact layout
+//   MESH_FORMAT_POSITION_INT16: snorm16 positions relative to mesh bounds (ignored for animated meshes)
+//   MESH_FORMAT_NORMAL_INT8: snorm8 normals and tangents, MESH_FORMAT_TEXCOORD_UNORM16: unorm16 texcoords (only if in [0..1])
+typedef enum {
+    MESH_FORMAT_DEFAULT = 0,                    // Mesh vertex format: 32-bit floats for all attributes
+    MESH_FORMAT_POSITION_INT16 = 1,             // Mesh vertex format: positions as normalized short[4], dequantized by model matrix or SHADER_LOC_VERTEX_DEQUANTIZE
+    MESH_FORMAT_NORMAL_INT8 = 2,                // Mesh vertex format: normals and tangents as normalized char[4]
+    MESH_FORMAT_TEXCOORD_UNORM16 = 4,           // Mesh vertex format: texcoords as normalized unsigned short[2]
+    MESH_FORMAT_BONEWEIGHT_UNORM8 = 8,          // Mesh vertex format: bone weights as normalized unsigned char[4]
+    MESH_FORMAT_COMPACT = 15                    // Mesh vertex format: all compact layouts available
+} MeshVertexFormat;
+
 // Shader attribute data types
 typedef enum {
     SHADER_ATTRIB_FLOAT = 0,        // Shader attribute type: float
@@ -890,7 +1005,8 @@ typedef enum {
 typedef enum {
     FONT_DEFAULT = 0,               // Default font generation, anti-aliased
     FONT_BITMAP,                    // Bitmap font generation, no anti-aliasing
-    FONT_SDF                        // SDF font generation, requires external shader
+    FONT_SDF,                       // SDF font generation, requires external shader
+    FONT_MSDF                       // Multi-channel SDF font generation (RGBA), requires external shader
 } FontType;
 
 // Color blending modes (pre-defined)
@@ -950,6 +1066,8 @@ typedef unsigned char *(*LoadFileDataCallback)(const char *fileName, int *dataSi
 typedef bool (*SaveFileDataCallback)(const char *fileName, void *data, int dataSize);   // FileIO: Save binary data
 typedef char *(*LoadFileTextCallback)(const char *fileName);            // FileIO: Load text data
 typedef bool (*SaveFileTextCallback)(const char *fileName, char *text); // FileIO: Save text data
+typedef FileMapping (*MapFileDataCallback)(const char *fileName);       // FileIO: Map binary data (read-only)
+typedef void (*UnmapFileDataCallback)(FileMapping mapping);             // FileIO: Unmap binary data
 
 //------------------------------------------------------------------------------------
 // Global Variables Definition
@@ -1110,15 +1228,22 @@ RLAPI void SetLoadFileDataCallback(LoadFileDataCallback callback); // Set custom
 RLAPI void SetSaveFileDataCallback(SaveFileDataCallback callback); // Set custom file binary data saver
 RLAPI void SetLoadFileTextCallback(LoadFileTextCallback callback); // Set custom file text data loader
 RLAPI void SetSaveFileTextCallback(SaveFileTextCallback callback); // Set custom file text data saver
+RLAPI void SetMapFileDataCallback(MapFileDataCallback callback);   // Set custom file binary data mapper
+RLAPI void SetUnmapFileDataCallback(UnmapFileDataCallback callback); // Set custom file binary data unmapper
 
 // Files management functions
 RLAPI unsigned char *LoadFileData(const char *fileName, int *dataSize); // Load file data as byte array (read)
 RLAPI void UnloadFileData(unsigned char *data);                   // Unload file data allocated by LoadFileData()
+RLAPI FileMapping MapFileData(const char *fileName);              // Map file data as read-only view (memory-mapped if supported, no copy)
+RLAPI void UnmapFileData(FileMapping mapping);                    // Unmap file data mapped by MapFileData()
 RLAPI bool SaveFileData(const char *fileName, void *data, int dataSize); // Save data to file from byte array (write), returns true on success
 RLAPI bool ExportDataAsCode(const unsigned char *data, int dataSize, const char *fileName); // Export data to code (.h), returns true on success
 RLAPI char *LoadFileText(const char *fileName);                   // Load text data from file (read), returns a '\0' terminated string
 RLAPI void UnloadFileText(char *text);                            // Unload file text data allocated by LoadFileText()
 RLAPI bool SaveFileText(const char *fileName, char *text);        // Save text data to file (write), string must be '\0' terminated, returns true on success
+RLAPI bool MountPack(const char *fileName, const char *mountPath); // Mount pack file, files loaded from mountPath are resolved from pack entries
+RLAPI void UnmountPack(const char *fileName);                     // Unmount pack file
+RLAPI bool ExportPack(const char *fileName, FilePathList files, const char *basePath, bool compress); // Export files into pack file, entries named relative to basePath, returns true on success
 //------------------------------------------------------------------
 
 // File system functions
@@ -1148,11 +1273,23 @@ RLAPI long GetFileModTime(const char *fileName);                  // Get file mo
 // Compression/Encoding functionality
 RLAPI unsigned char *CompressData(const unsigned char *data, int dataSize, int *compDataSize);        // Compress data (DEFLATE algorithm), memory must be MemFree()
 RLAPI unsigned char *DecompressData(const unsigned char *compData, int compDataSize, int *dataSize);  // Decompress data (DEFLATE algorithm), memory must be MemFree()
+RLAPI int GetCompressedBlockBound(int dataSize);                                                      // Get compressed data block maximum size for data size (required block capacity)
+RLAPI int CompressDataBlock(const unsigned char *data, int dataSize, unsigned char *block, int blockCapacity); // Compress data into size-prefixed block (DEFLATE algorithm) using provided buffer, returns block size
+RLAPI int GetDecompressedBlockSize(const unsigned char *block, int blockSize);                         // Get decompressed data size for compressed data block, returns -1 if not valid
+RLAPI int DecompressDataBlock(const unsigned char *block, int blockSize, unsigned char *data, int dataCapacity, int *dataSize); // Decompress data block into provided buffer, returns block size read (0 on failure)
 RLAPI char *EncodeDataBase64(const unsigned char *data, int dataSize, int *outputSize);               // Encode data to Base64 string, memory must be MemFree()
 RLAPI unsigned char *DecodeDataBase64(const unsigned char *data, int *outputSize);                    // Decode Base64 string data, memory must be MemFree()
 RLAPI unsigned int ComputeCRC32(unsigned char *data, int dataSize);     // Compute CRC32 hash code
 RLAPI unsigned int *ComputeMD5(unsigned char *data, int dataSize);      // Compute MD5 hash code, returns static int[4] (16 bytes)
 RLAPI unsigned int *ComputeSHA1(unsigned char *data, int dataSize);      // Compute SHA1 hash code, returns static int[5] (20 bytes)
+RLAPI unsigned int UpdateCRC32(unsigned int crc, const unsigned char *data, int dataSize);// Update CRC32 hash code with data (initial crc: 0)
+RLAPI unsigned long long ComputeHash64(const unsigned char *data, int dataSize, unsigned long long seed);// Compute 64-bit hash code (xxHash64, non-cryptographic)
+RLAPI void InitHashMD5(HashState *state);                               // Init MD5 hash state
+RLAPI void UpdateHashMD5(HashState *state, const unsigned char *data, int dataSize);// Update MD5 hash state with data
+RLAPI void FinishHashMD5(HashState *state, unsigned int *hash);         // Finish MD5 hash computation, hash must be int[4] (16 bytes)
+RLAPI void InitHashSHA1(HashState *state);                              // Init SHA1 hash state
+RLAPI void UpdateHashSHA1(HashState *state, const unsigned char *data, int dataSize);// Update SHA1 hash state with data
+RLAPI void FinishHashSHA1(HashState *state, unsigned int *hash);        // Finish SHA1 hash computation, hash must be int[5] (20 bytes)
 
 
 // Automation events functionality
@@ -1475,12 +1612,16 @@ RLAPI Font LoadFont(const char *fileName);
 RLAPI Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepointCount); // Load font from file with extended parameters, use NULL for codepoints and 0 for codepointCount to load the default character set, font size is provided in pixels height
 RLAPI Font LoadFontFromImage(Image image, Color key, int firstChar);                        // Load font from Image (XNA style)
 RLAPI Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount); // Load font from memory buffer, fileType refers to extension: i.e. '.ttf'
+RLAPI Font LoadFontDynamic(const char *fileName, int fontSize, int pageSize, int maxPages);   // Load font for on-demand glyphs rasterization into atlas pages (TTF/OTF), least recently used page is reused when maxPages are full
+RLAPI Font LoadFontDynamicFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int pageSize, int maxPages); // Load dynamic font from memory buffer, fileType refers to extension: i.e. '.ttf'
 RLAPI bool IsFontValid(Font font);                                                          // Check if a font is valid (font data loaded, WARNING: GPU texture not checked)
 RLAPI GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int type); // Load font data for further use
 RLAPI Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod); // Generate image font atlas using chars info
+RLAPI int PackRectangles(Rectangle *recs, int *pages, int count, int pageWidth, int pageHeight, int padding, float *efficiency); // Pack rectangles into atlas pages (fonts, sprites), returns pages count
 RLAPI void UnloadFontData(GlyphInfo *glyphs, int glyphCount);                               // Unload font chars info data (RAM)
 RLAPI void UnloadFont(Font font);                                                           // Unload font from GPU memory (VRAM)
 RLAPI bool ExportFontAsCode(Font font, const char *fileName);                               // Export font as code file, returns true on success
+RLAPI void GetFontDynamicStats(Font font, int *glyphCount, int *pageCount, int *evictionCount); // Get dynamic font cache stats: glyphs cached, atlas pages in use and pages evicted
 
 // Text drawing functions
 RLAPI void DrawFPS(int posX, int posY);                                                     // Draw current FPS
@@ -1490,6 +1631,13 @@ RLAPI void DrawTextPro(Font font, const char *text, Vector2 position, Vector2 or
 RLAPI void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint); // Draw one character (codepoint)
 RLAPI void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Vector2 position, float fontSize, float spacing, Color tint); // Draw multiple character (codepoint)
 
+// Text layout functions (prepared text for static or repeated strings)
+RLAPI TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing); // Load text layout: decode text and compute glyphs quads once
+RLAPI TextLayout LoadTextLayoutEx(Font font, const char *text, float fontSize, float spacing, float wrapWidth, bool kerning); // Load text layout with words wrapping (wrapWidth > 0) and font kerning
+RLAPI void UpdateTextLayout(TextLayout *layout, const char *text, int textStart);           // Update text layout for text changed from textStart (bytes), previous lines are kept
+RLAPI void UnloadTextLayout(TextLayout layout);                                             // Unload text layout data
+RLAPI void DrawTextLayout(TextLayout layout, Vector2 position, Color tint);                 // Draw text layout, glyphs quads are copied to render batch
+
 // Text font info functions
 RLAPI void SetTextLineSpacing(int spacing);                                                 // Set vertical line spacing when drawing with line-breaks
 RLAPI int MeasureText(const char *text, int fontSize);                                      // Measure string width for default font
@@ -1497,6 +1645,7 @@ RLAPI Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float s
 RLAPI int GetGlyphIndex(Font font, int codepoint);                                          // Get glyph index position in font for a codepoint (unicode character), fallback to '?' if not found
 RLAPI GlyphInfo GetGlyphInfo(Font font, int codepoint);                                     // Get glyph font info data for a codepoint (unicode character), fallback to '?' if not found
 RLAPI Rectangle GetGlyphAtlasRec(Font font, int codepoint);                                 // Get glyph rectangle in font atlas for a codepoint (unicode character), fallback to '?' if not found
+RLAPI float GetGlyphKerning(Font font, int codepoint, int nextCodepoint);                   // Get kerning advance adjustment between two codepoints, in pixels at font base size
 
 // Text codepoints management functions (unicode characters)
 RLAPI char *LoadUTF8(const int *codepoints, int length);                // Load UTF-8 text encoded from codepoints array
@@ -1568,6 +1717,7 @@ RLAPI Model LoadModelFromMesh(Mesh mesh);
 RLAPI bool IsModelValid(Model model);                                                       // Check if a model is valid (loaded in GPU, VAO/VBOs)
 RLAPI void UnloadModel(Model model);                                                        // Unload model (including meshes) from memory (RAM and/or VRAM)
 RLAPI BoundingBox GetModelBoundingBox(Model model);                                         // Compute model bounding box limits (considers all meshes)
+RLAPI bool ExportModel(Model model, const char *fileName);                                  // Export model data to file (.rmdl), returns true on success
 
 // Model drawing functions
 RLAPI void DrawModel(Model model, Vector3 position, float scale, Color tint);               // Draw a model (with texture if set)
@@ -1582,16 +1732,45 @@ RLAPI void DrawBillboardRec(Camera camera, Texture2D texture, Rectangle source,
 RLAPI void DrawBillboardPro(Camera camera, Texture2D texture, Rectangle source, Vector3 position, Vector3 up, Vector2 size, Vector2 origin, float rotation, Color tint); // Draw a billboard texture defined by source and rotation
 
 // Mesh management functions
+// NOTE: Generated meshes (GenMeshSimplified(), SplitMesh(), GenMeshLod() levels) are uploaded to GPU if initialized, like GenMesh*() shapes
 RLAPI void UploadMesh(Mesh *mesh, bool dynamic);                                            // Upload mesh vertex data in GPU and provide VAO/VBO ids
+RLAPI void UploadMeshEx(Mesh *mesh, bool dynamic, int vertexFormat);                        // Upload mesh vertex data in GPU using compact vertex format (MeshVertexFormat flags)
 RLAPI void UpdateMeshBuffer(Mesh mesh, int index, const void *data, int dataSize, int offset); // Update mesh vertex data in GPU for a specific buffer index
 RLAPI void UnloadMesh(Mesh mesh);                                                           // Unload mesh data from CPU and GPU
 RLAPI void DrawMesh(Mesh mesh, Material material, Matrix transform);                        // Draw a 3d mesh with material and transform
 RLAPI void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, int instances); // Draw multiple mesh instances with material and different transforms
+RLAPI void DrawMeshInstancedBuffer(Mesh mesh, Material material, InstanceBuffer buffer, int offset, int instances); // Draw multiple mesh instances with material and instances attributes from buffer
+RLAPI void DrawMeshInstancedIndirect(Mesh mesh, Material material, InstanceBuffer buffer, unsigned int commandsId, int commandCount); // Draw multiple mesh instances with draw commands from GPU buffer (multi-draw indirect)
+RLAPI void DrawMeshLod(MeshLod lod, Material material, Matrix transform);                   // Draw mesh level of detail for transform, culled if not visible
+RLAPI int DrawMeshLodInstanced(MeshLod lod, Material material, const Matrix *transforms, int instances); // Draw mesh levels of detail for multiple instances, culled if not visible, returns instances drawn
 RLAPI BoundingBox GetMeshBoundingBox(Mesh mesh);                                            // Compute mesh bounding box limits
 RLAPI void GenMeshTangents(Mesh *mesh);                                                     // Compute mesh tangents
+RLAPI void GenMeshIndices(Mesh *mesh);                                                      // Generate mesh indices, welding duplicated vertices (32-bit indices if required), applied to loaded OBJ meshes
+RLAPI void OptimizeMesh(Mesh *mesh);                                                        // Optimize mesh triangles and vertices order (vertex cache, overdraw, vertex fetch)
+RLAPI void GetMeshCacheStats(Mesh mesh, int cacheSize, float *acmr, float *atvr);           // Get mesh vertex cache statistics: ACMR (misses per triangle), ATVR (misses per vertex)
+RLAPI Mesh GenMeshSimplified(Mesh mesh, float targetRatio, float maxError, float *error);   // Generate simplified mesh to target triangles ratio, error relative to mesh size (optional)
+RLAPI Mesh *SplitMesh(Mesh mesh, int maxVertices, int maxTriangles, int *meshCount);        // Split mesh into spatially coherent chunks with 16-bit indices and own bounds
 RLAPI bool ExportMesh(Mesh mesh, const char *fileName);                                     // Export mesh data to file, returns true on success
 RLAPI bool ExportMeshAsCode(Mesh mesh, const char *fileName);                               // Export mesh as code file (.h) defining multiple arrays of vertex attributes
 
+// Mesh culling and levels of detail functions
+RLAPI MeshLod LoadMeshLod(const Mesh *meshes, const float *screenSizes, int levelCount);    // Load mesh levels of detail (meshes from most to least detailed)
+RLAPI void UnloadMeshLod(MeshLod lod);                                                      // Unload mesh levels of detail (meshes not unloaded)
+RLAPI int GetMeshLodLevel(MeshLod lod, Matrix transform);                                   // Get mesh level of detail for transform, returns -1 if culled
+RLAPI MeshLod GenMeshLod(Mesh mesh, const float *ratios, int ratioCount, float maxError);   // Generate mesh levels of detail simplified to target ratios (generated levels must be unloaded)
+RLAPI Frustum GetCameraFrustum(void);                                                       // Get current camera view frustum (world space, BeginMode3D() required)
+RLAPI void EnableMeshCulling(void);                                                         // Enable mesh frustum culling on DrawMesh() (disabled by default)
+RLAPI void DisableMeshCulling(void);                                                        // Disable mesh frustum culling on DrawMesh()
+RLAPI void GetMeshCullingStats(int *tested, int *culled);                                   // Get meshes/instances tested and culled since last reset
+RLAPI void ResetMeshCullingStats(void);                                                     // Reset meshes/instances culling counters (i.e. once per frame)
+
+// Instance buffer management functions
+RLAPI InstanceBuffer LoadInstanceBuffer(int capacity, unsigned int attributes);             // Load instance buffer in GPU for a number of instances with attributes (InstanceAttribute flags)
+RLAPI bool IsInstanceBufferValid(InstanceBuffer buffer);                                    // Check if an instance buffer is valid (loaded in GPU)
+RLAPI void UnloadInstanceBuffer(InstanceBuffer buffer);                                     // Unload instance buffer from GPU memory (VRAM)
+RLAPI void UpdateInstanceBuffer(InstanceBuffer buffer, int attribute, const void *data, int offset, int count); // Update instance buffer attribute data for a range of instances
+RLAPI void UpdateInstanceBufferTransforms(InstanceBuffer buffer, const Matrix *transforms, int offset, int count); // Update instance buffer transforms for a range of instances (quantized if required)
+
 // Mesh generation functions
 RLAPI Mesh GenMeshPoly(int sides, float radius);                                            // Generate polygonal mesh
 RLAPI Mesh GenMeshPlane(float width, float length, int resX, int resZ);                     // Generate plane mesh (with subdivisions)
@@ -1615,6 +1794,7 @@ RLAPI void SetModelMeshMaterial(Model *model, int meshId, int materialId);
 
 // Model animations loading/unloading functions
 RLAPI ModelAnimation *LoadModelAnimations(const char *fileName, int *animCount);            // Load model animations from file
+RLAPI bool ExportModelAnimations(ModelAnimation *animations, int animCount, const char *fileName); // Export model animations data to file (.rmdl), returns true on success
 RLAPI void UpdateModelAnimation(Model model, ModelAnimation anim, int frame);               // Update model animation pose (CPU)
 RLAPI void UpdateModelAnimationBones(Model model, ModelAnimation anim, int frame);          // Update model animation mesh bone matrices (GPU skinning)
 RLAPI void UnloadModelAnimation(ModelAnimation anim);                                       // Unload animation data
@@ -1625,6 +1805,8 @@ RLAPI bool IsModelAnimationValid(Model model, ModelAnimation anim);
 RLAPI bool CheckCollisionSpheres(Vector3 center1, float radius1, Vector3 center2, float radius2);   // Check collision between two spheres
 RLAPI bool CheckCollisionBoxes(BoundingBox box1, BoundingBox box2);                                 // Check collision between two bounding boxes
 RLAPI bool CheckCollisionBoxSphere(BoundingBox box, Vector3 center, float radius);                  // Check collision between box and sphere
+RLAPI bool CheckCollisionFrustumBox(Frustum frustum, BoundingBox box);                              // Check collision between frustum and box (box inside or intersecting)
+RLAPI bool CheckCollisionFrustumSphere(Frustum frustum, Vector3 center, float radius);              // Check collision between frustum and sphere (sphere inside or intersecting)
 RLAPI RayCollision GetRayCollisionSphere(Ray ray, Vector3 center, float radius);                    // Get collision info between ray and sphere
 RLAPI RayCollision GetRayCollisionBox(Ray ray, BoundingBox box);                                    // Get collision info between ray and box
 RLAPI RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform);                       // Get collision info between ray and mesh
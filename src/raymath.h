@@ -11,7 +11,8 @@
 *       Example: In memory order, row0 is [m0 m4 m8 m12] but in semantic math row0 is [m0 m1 m2 m3]
 *     - Functions are always self-contained, no function use another raymath function inside,
 *       required code is directly re-implemented inside
-*     - Functions input parameters are always received by value (2 unavoidable exceptions)
+*     - Functions input parameters are always received by value (2 unavoidable exceptions),
+*       batch functions (*Batch) work on arrays, received by pointer, results written to out arrays
 *     - Functions use always a "result" variable for return (except C++ operators)
 *     - Functions are always defined inline
 *     - Angles are always in radians (DEG2RAD/RAD2DEG macros provided for convenience)
@@ -30,6 +31,15 @@
 *       #define RAYMATH_DISABLE_CPP_OPERATORS
 *           Disables C++ operator overloads for raymath types.
 *
+*       #define RAYMATH_SIMD
+*           Use SIMD intrinsics (SSE/NEON) implementations for some core functions (MatrixMultiply(),
+*           MatrixInvert(), MatrixTranspose(), Vector3Transform(), QuaternionTransform()) and batch functions.
+*           Same types and function signatures are kept, it can be combined with RAYMATH_STATIC_INLINE.
+*           NOTE: Intrinsics headers are only included if defined, scalar code is used otherwise
+*
+*       #define RAYMATH_DISABLE_SIMD
+*           Disables SIMD intrinsics (SSE/AVX/NEON) even if RAYMATH_SIMD is defined, scalar code is used instead.
+*
 *   LICENSE: zlib/libpng
 *
 *   Copyright (c) 2015-2024 Ramon Santamaria (@raysan5)
@@ -170,6 +180,21 @@ typedef struct float16 {
 
 #include <math.h>       // Required for: sinf(), cosf(), tan(), atan2f(), sqrtf(), floor(), fminf(), fmaxf(), fabsf()
 
+// SIMD intrinsics used by core and batch functions, depending on compilation target
+#if defined(RAYMATH_SIMD) && !defined(RAYMATH_DISABLE_SIMD) && !defined(__TINYC__)
+    #if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+        #define RAYMATH_SIMD_SSE
+        #include <xmmintrin.h>  // Required for: SSE intrinsics
+        #if defined(__AVX__)
+            #define RAYMATH_SIMD_AVX
+            #include <immintrin.h>  // Required for: AVX intrinsics
+        #endif
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+        #define RAYMATH_SIMD_NEON
+        #include <arm_neon.h>   // Required for: NEON intrinsics
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utils math
 //----------------------------------------------------------------------------------
@@ -850,6 +875,30 @@ RMAPI Vector3 Vector3Transform(Vector3 v, Matrix mat)
 {
     Vector3 result = { 0 };
 
+#if defined(RAYMATH_SIMD) && defined(RAYMATH_SIMD_SSE)
+    // NOTE: In memory, matrix row i is [m(i) m(i + 4) m(i + 8) m(i + 12)], transposed to get matrix columns
+    const float *m = (const float *)&mat;
+    __m128 c0 = _mm_loadu_ps(m);
+    __m128 c1 = _mm_loadu_ps(m + 4);
+    __m128 c2 = _mm_loadu_ps(m + 8);
+    __m128 c3 = _mm_loadu_ps(m + 12);
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+    float r[4] = { 0 };
+    _mm_storeu_ps(r, _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(v.x)), _mm_mul_ps(c1, _mm_set1_ps(v.y))), _mm_mul_ps(c2, _mm_set1_ps(v.z))), c3));
+
+    result.x = r[0];
+    result.y = r[1];
+    result.z = r[2];
+#elif defined(RAYMATH_SIMD) && defined(RAYMATH_SIMD_NEON)
+    // NOTE: Deinterleaved load: val[k] = [m(4k) m(4k + 1) m(4k + 2) m(4k + 3)] (matrix columns)
+    float32x4x4_t m = vld4q_f32((const float *)&mat);
+    float32x4_t r = vaddq_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(m.val[0], v.x), m.val[1], v.y), m.val[2], v.z), m.val[3]);
+
+    result.x = vgetq_lane_f32(r, 0);
+    result.y = vgetq_lane_f32(r, 1);
+    result.z = vgetq_lane_f32(r, 2);
+#else
     float x = v.x;
     float y = v.y;
     float z = v.z;
@@ -857,6 +906,7 @@ RMAPI Vector3 Vector3Transform(Vector3 v, Matrix mat)
     result.x = mat.m0*x + mat.m4*y + mat.m8*z + mat.m12;
     result.y = mat.m1*x + mat.m5*y + mat.m9*z + mat.m13;
     result.z = mat.m2*x + mat.m6*y + mat.m10*z + mat.m14;
+#endif
 
     return result;
 }
@@ -1489,6 +1539,28 @@ RMAPI Matrix MatrixTranspose(Matrix mat)
 {
     Matrix result = { 0 };
 
+#if defined(RAYMATH_SIMD) && defined(RAYMATH_SIMD_SSE)
+    const float *m = (const float *)&mat;
+    __m128 r0 = _mm_loadu_ps(m);
+    __m128 r1 = _mm_loadu_ps(m + 4);
+    __m128 r2 = _mm_loadu_ps(m + 8);
+    __m128 r3 = _mm_loadu_ps(m + 12);
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+    float *r = (float *)&result;
+    _mm_storeu_ps(r, r0);
+    _mm_storeu_ps(r + 4, r1);
+    _mm_storeu_ps(r + 8, r2);
+    _mm_storeu_ps(r + 12, r3);
+#elif defined(RAYMATH_SIMD) && defined(RAYMATH_SIMD_NEON)
+    float32x4x4_t m = vld4q_f32((const float *)&mat);   // Deinterleaved load, transposed rows
+
+    float *r = (float *)&result;
+    vst1q_f32(r, m.val[0]);
+    vst1q_f32(r + 4, m.val[1]);
+    vst1q_f32(r + 8, m.val[2]);
+    vst1q_f32(r + 12, m.val[3]);
+#else
     result.m0 = mat.m0;
     result.m1 = mat.m4;
     result.m2 = mat.m8;
@@ -1505,6 +1577,7 @@ RMAPI Matrix MatrixTranspose(Matrix mat)
     result.m13 = mat.m7;
     result.m14 = mat.m11;
     result.m15 = mat.m15;
+#endif
 
     return result;
 }
@@ -1514,6 +1587,63 @@ RMAPI Matrix MatrixInvert(Matrix mat)
 {
     Matrix result = { 0 };
 
+#if defined(RAYMATH_SIMD) && defined(RAYMATH_SIMD_SSE)
+    // NOTE: Same operations as scalar version, transposed rows a0..a3 are [a(i)0 a(i)1 a(i)2 a(i)3],
+    // 2x2 determinants are computed as: blo = [b00 b01 b02 b03], bhi = [b06 b07 b08 b09], bmid = [b04 b05 b10 b11]
+    const float *m = (const float *)&mat;
+    __m128 a0 = _mm_loadu_ps(m);
+    __m128 a1 = _mm_loadu_ps(m + 4);
+    __m128 a2 = _mm_loadu_ps(m + 8);
+    __m128 a3 = _mm_loadu_ps(m + 12);
+    _MM_TRANSPOSE4_PS(a0, a1, a2, a3);
+
+    __m128 blo = _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 0, 0, 0)), _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(2, 3, 2, 1))),
+                            _mm_mul_ps(_mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 3, 2, 1)), _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 0, 0, 0))));
+    __m128 bhi = _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(a2, a2, _MM_SHUFFLE(1, 0, 0, 0)), _mm_shuffle_ps(a3, a3, _MM_SHUFFLE(2, 3, 2, 1))),
+                            _mm_mul_ps(_mm_shuffle_ps(a2, a2, _MM_SHUFFLE(2, 3, 2, 1)), _mm_shuffle_ps(a3, a3, _MM_SHUFFLE(1, 0, 0, 0))));
+    __m128 bmid = _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(a0, a2, _MM_SHUFFLE(2, 1, 2, 1)), _mm_shuffle_ps(a1, a3, _MM_SHUFFLE(3, 3, 3, 3))),
+                             _mm_mul_ps(_mm_shuffle_ps(a0, a2, _MM_SHUFFLE(3, 3, 3, 3)), _mm_shuffle_ps(a1, a3, _MM_SHUFFLE(2, 1, 2, 1))));
+
+    float b[12] = { 0 };
+    _mm_storeu_ps(b, blo);
+    _mm_storeu_ps(b + 4, bmid);
+    _mm_storeu_ps(b + 8, bhi);
+
+    // Calculate the invert determinant: b00*b11 - b01*b10 + b02*b09 + b03*b08 - b04*b07 + b05*b06
+    __m128 invDet = _mm_set1_ps(1.0f/(b[0]*b[7] - b[1]*b[6] + b[2]*b[11] + b[3]*b[10] - b[4]*b[9] + b[5]*b[8]));
+
+    // Determinants used by result rows 0-1: [b11 b11 b10 b09] [b10 b08 b08 b07] [b09 b07 b06 b06]
+    __m128 t = _mm_shuffle_ps(bmid, bhi, _MM_SHUFFLE(3, 3, 2, 2));
+    __m128 u1 = _mm_shuffle_ps(bmid, t, _MM_SHUFFLE(2, 0, 3, 3));
+    __m128 u2 = _mm_shuffle_ps(_mm_shuffle_ps(bmid, bhi, _MM_SHUFFLE(2, 2, 2, 2)), bhi, _MM_SHUFFLE(1, 2, 2, 0));
+    __m128 u3 = _mm_shuffle_ps(bhi, bhi, _MM_SHUFFLE(0, 0, 1, 3));
+
+    // Determinants used by result rows 2-3: [b05 b05 b04 b03] [b04 b02 b02 b01] [b03 b01 b00 b00]
+    t = _mm_shuffle_ps(bmid, blo, _MM_SHUFFLE(3, 3, 0, 0));
+    __m128 l1 = _mm_shuffle_ps(bmid, t, _MM_SHUFFLE(2, 0, 1, 1));
+    __m128 l2 = _mm_shuffle_ps(_mm_shuffle_ps(bmid, blo, _MM_SHUFFLE(2, 2, 0, 0)), blo, _MM_SHUFFLE(1, 2, 2, 0));
+    __m128 l3 = _mm_shuffle_ps(blo, blo, _MM_SHUFFLE(0, 0, 1, 3));
+
+    // Alternate terms signs [+ - + -] and [- + - +], applied by flipping sign bit
+    __m128 signA = _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f);
+    __m128 signB = _mm_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f);
+
+    // Result rows (in memory): [m0 m4 m8 m12] from a1, [m1 m5 m9 m13] from a0, [m2 m6 m10 m14] from a3, [m3 m7 m11 m15] from a2
+    __m128 r0 = _mm_add_ps(_mm_add_ps(_mm_xor_ps(_mm_mul_ps(_mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 0, 0, 1)), u1), signA),
+        _mm_xor_ps(_mm_mul_ps(_mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 1, 2, 2)), u2), signB)), _mm_xor_ps(_mm_mul_ps(_mm_shuffle_ps(a1, a1, _MM_SHUFFLE(2, 3, 3, 3)), u3), signA));
+    __m128 r1 = _mm_add_ps(_mm_add_ps(_mm_xor_ps(_mm_mul_ps(_mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 0, 0, 1)), u1), signB),
+        _mm_xor_ps(_mm_mul_ps(_mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 1, 2, 2)), u2), signA)), _mm_xor_ps(_mm_mul_ps(_mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 3, 3, 3)), u3), signB));
+    __m128 r2 = _mm_add_ps(_mm_add_ps(_mm_xor_ps(_mm_mul_ps(_mm_shuffle_ps(a3, a3, _MM_SHUFFLE(0, 0, 0, 1)), l1), signA),
+        _mm_xor_ps(_mm_mul_ps(_mm_shuffle_ps(a3, a3, _MM_SHUFFLE(1, 1, 2, 2)), l2), signB)), _mm_xor_ps(_mm_mul_ps(_mm_shuffle_ps(a3, a3, _MM_SHUFFLE(2, 3, 3, 3)), l3), signA));
+    __m128 r3 = _mm_add_ps(_mm_add_ps(_mm_xor_ps(_mm_mul_ps(_mm_shuffle_ps(a2, a2, _MM_SHUFFLE(0, 0, 0, 1)), l1), signB),
+        _mm_xor_ps(_mm_mul_ps(_mm_shuffle_ps(a2, a2, _MM_SHUFFLE(1, 1, 2, 2)), l2), signA)), _mm_xor_ps(_mm_mul_ps(_mm_shuffle_ps(a2, a2, _MM_SHUFFLE(2, 3, 3, 3)), l3), signB));
+
+    float *r = (float *)&result;
+    _mm_storeu_ps(r, _mm_mul_ps(r0, invDet));
+    _mm_storeu_ps(r + 4, _mm_mul_ps(r1, invDet));
+    _mm_storeu_ps(r + 8, _mm_mul_ps(r2, invDet));
+    _mm_storeu_ps(r + 12, _mm_mul_ps(r3, invDet));
+#else
     // Cache the matrix values (speed optimization)
     float a00 = mat.m0, a01 = mat.m1, a02 = mat.m2, a03 = mat.m3;
     float a10 = mat.m4, a11 = mat.m5, a12 = mat.m6, a13 = mat.m7;
@@ -1552,6 +1682,7 @@ RMAPI Matrix MatrixInvert(Matrix mat)
     result.m13 = (a00*b09 - a01*b07 + a02*b06)*invDet;
     result.m14 = (-a30*b03 + a31*b01 - a32*b00)*invDet;
     result.m15 = (a20*b03 - a21*b01 + a22*b00)*invDet;
+#endif
 
     return result;
 }
@@ -1623,6 +1754,46 @@ RMAPI Matrix MatrixMultiply(Matrix left, Matrix right)
 {
     Matrix result = { 0 };
 
+#if defined(RAYMATH_SIMD) && defined(RAYMATH_SIMD_SSE)
+    // NOTE: In memory, matrix row j is [m(j) m(j + 4) m(j + 8) m(j + 12)] and
+    // result row j = sum(right[j][k]*left row k), for k = 0..3
+    const float *l = (const float *)&left;
+    const float *r = (const float *)&right;
+    float *m = (float *)&result;
+    __m128 l0 = _mm_loadu_ps(l);
+    __m128 l1 = _mm_loadu_ps(l + 4);
+    __m128 l2 = _mm_loadu_ps(l + 8);
+    __m128 l3 = _mm_loadu_ps(l + 12);
+
+    __m128 r0 = _mm_loadu_ps(r + 0);
+    __m128 r1 = _mm_loadu_ps(r + 4);
+    __m128 r2 = _mm_loadu_ps(r + 8);
+    __m128 r3 = _mm_loadu_ps(r + 12);
+
+    _mm_storeu_ps(m + 0, _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(l0, _mm_shuffle_ps(r0, r0, _MM_SHUFFLE(0, 0, 0, 0))), _mm_mul_ps(l1, _mm_shuffle_ps(r0, r0, _MM_SHUFFLE(1, 1, 1, 1)))),
+        _mm_mul_ps(l2, _mm_shuffle_ps(r0, r0, _MM_SHUFFLE(2, 2, 2, 2)))), _mm_mul_ps(l3, _mm_shuffle_ps(r0, r0, _MM_SHUFFLE(3, 3, 3, 3)))));
+    _mm_storeu_ps(m + 4, _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(l0, _mm_shuffle_ps(r1, r1, _MM_SHUFFLE(0, 0, 0, 0))), _mm_mul_ps(l1, _mm_shuffle_ps(r1, r1, _MM_SHUFFLE(1, 1, 1, 1)))),
+        _mm_mul_ps(l2, _mm_shuffle_ps(r1, r1, _MM_SHUFFLE(2, 2, 2, 2)))), _mm_mul_ps(l3, _mm_shuffle_ps(r1, r1, _MM_SHUFFLE(3, 3, 3, 3)))));
+    _mm_storeu_ps(m + 8, _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(l0, _mm_shuffle_ps(r2, r2, _MM_SHUFFLE(0, 0, 0, 0))), _mm_mul_ps(l1, _mm_shuffle_ps(r2, r2, _MM_SHUFFLE(1, 1, 1, 1)))),
+        _mm_mul_ps(l2, _mm_shuffle_ps(r2, r2, _MM_SHUFFLE(2, 2, 2, 2)))), _mm_mul_ps(l3, _mm_shuffle_ps(r2, r2, _MM_SHUFFLE(3, 3, 3, 3)))));
+    _mm_storeu_ps(m + 12, _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(l0, _mm_shuffle_ps(r3, r3, _MM_SHUFFLE(0, 0, 0, 0))), _mm_mul_ps(l1, _mm_shuffle_ps(r3, r3, _MM_SHUFFLE(1, 1, 1, 1)))),
+        _mm_mul_ps(l2, _mm_shuffle_ps(r3, r3, _MM_SHUFFLE(2, 2, 2, 2)))), _mm_mul_ps(l3, _mm_shuffle_ps(r3, r3, _MM_SHUFFLE(3, 3, 3, 3)))));
+#elif defined(RAYMATH_SIMD) && defined(RAYMATH_SIMD_NEON)
+    // NOTE: In memory, matrix row j is [m(j) m(j + 4) m(j + 8) m(j + 12)] and
+    // result row j = sum(right[j][k]*left row k), for k = 0..3
+    const float *l = (const float *)&left;
+    const float *r = (const float *)&right;
+    float *m = (float *)&result;
+    float32x4_t l0 = vld1q_f32(l);
+    float32x4_t l1 = vld1q_f32(l + 4);
+    float32x4_t l2 = vld1q_f32(l + 8);
+    float32x4_t l3 = vld1q_f32(l + 12);
+
+    vst1q_f32(m + 0, vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(l0, r[0]), l1, r[1]), l2, r[2]), l3, r[3]));
+    vst1q_f32(m + 4, vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(l0, r[4]), l1, r[5]), l2, r[6]), l3, r[7]));
+    vst1q_f32(m + 8, vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(l0, r[8]), l1, r[9]), l2, r[10]), l3, r[11]));
+    vst1q_f32(m + 12, vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(l0, r[12]), l1, r[13]), l2, r[14]), l3, r[15]));
+#else
     result.m0 = left.m0*right.m0 + left.m1*right.m4 + left.m2*right.m8 + left.m3*right.m12;
     result.m1 = left.m0*right.m1 + left.m1*right.m5 + left.m2*right.m9 + left.m3*right.m13;
     result.m2 = left.m0*right.m2 + left.m1*right.m6 + left.m2*right.m10 + left.m3*right.m14;
@@ -1639,6 +1810,7 @@ RMAPI Matrix MatrixMultiply(Matrix left, Matrix right)
     result.m13 = left.m12*right.m1 + left.m13*right.m5 + left.m14*right.m9 + left.m15*right.m13;
     result.m14 = left.m12*right.m2 + left.m13*right.m6 + left.m14*right.m10 + left.m15*right.m14;
     result.m15 = left.m12*right.m3 + left.m13*right.m7 + left.m14*right.m11 + left.m15*right.m15;
+#endif
 
     return result;
 }
@@ -2500,10 +2672,28 @@ RMAPI Quaternion QuaternionTransform(Quaternion q, Matrix mat)
 {
     Quaternion result = { 0 };
 
+#if defined(RAYMATH_SIMD) && defined(RAYMATH_SIMD_SSE)
+    // NOTE: In memory, matrix row i is [m(i) m(i + 4) m(i + 8) m(i + 12)], transposed to get matrix columns
+    const float *m = (const float *)&mat;
+    __m128 c0 = _mm_loadu_ps(m);
+    __m128 c1 = _mm_loadu_ps(m + 4);
+    __m128 c2 = _mm_loadu_ps(m + 8);
+    __m128 c3 = _mm_loadu_ps(m + 12);
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+    _mm_storeu_ps((float *)&result, _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(q.x)), _mm_mul_ps(c1, _mm_set1_ps(q.y))),
+        _mm_mul_ps(c2, _mm_set1_ps(q.z))), _mm_mul_ps(c3, _mm_set1_ps(q.w))));
+#elif defined(RAYMATH_SIMD) && defined(RAYMATH_SIMD_NEON)
+    // NOTE: Deinterleaved load: val[k] = [m(4k) m(4k + 1) m(4k + 2) m(4k + 3)] (matrix columns)
+    float32x4x4_t m = vld4q_f32((const float *)&mat);
+
+    vst1q_f32((float *)&result, vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(m.val[0], q.x), m.val[1], q.y), m.val[2], q.z), m.val[3], q.w));
+#else
     result.x = mat.m0*q.x + mat.m4*q.y + mat.m8*q.z + mat.m12*q.w;
     result.y = mat.m1*q.x + mat.m5*q.y + mat.m9*q.z + mat.m13*q.w;
     result.z = mat.m2*q.x + mat.m6*q.y + mat.m10*q.z + mat.m14*q.w;
     result.w = mat.m3*q.x + mat.m7*q.y + mat.m11*q.z + mat.m15*q.w;
+#endif
 
     return result;
 }
@@ -2588,6 +2778,359 @@ RMAPI void MatrixDecompose(Matrix mat, Vector3 *translation, Quaternion *rotatio
     }
 }
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Batch math
+//----------------------------------------------------------------------------------
+// NOTE: Batch functions process arrays of elements with same results as the equivalent
+// per-element functions, avoiding parameters copies per element and using SIMD intrinsics
+// when available (RAYMATH_SIMD), out arrays can be the same as input arrays (in-place processing)
+
+// Transform an array of Vector3 by a given Matrix
+RMAPI void Vector3TransformBatch(const Vector3 *points, int count, Matrix mat, Vector3 *outPoints)
+{
+    int i = 0;
+
+#if defined(RAYMATH_SIMD_SSE)
+    __m128 m0 = _mm_set1_ps(mat.m0), m4 = _mm_set1_ps(mat.m4), m8 = _mm_set1_ps(mat.m8), m12 = _mm_set1_ps(mat.m12);
+    __m128 m1 = _mm_set1_ps(mat.m1), m5 = _mm_set1_ps(mat.m5), m9 = _mm_set1_ps(mat.m9), m13 = _mm_set1_ps(mat.m13);
+    __m128 m2 = _mm_set1_ps(mat.m2), m6 = _mm_set1_ps(mat.m6), m10 = _mm_set1_ps(mat.m10), m14 = _mm_set1_ps(mat.m14);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        // Load 4 points: [x0 y0 z0 x1] [y1 z1 x2 y2] [z2 x3 y3 z3], deinterleaved to [x0..x3] [y0..y3] [z0..z3]
+        const float *src = (const float *)(points + i);
+        __m128 a = _mm_loadu_ps(src);
+        __m128 b = _mm_loadu_ps(src + 4);
+        __m128 c = _mm_loadu_ps(src + 8);
+
+        __m128 t = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 0, 3, 2));
+        __m128 x = _mm_shuffle_ps(a, t, _MM_SHUFFLE(3, 0, 3, 0));
+        __m128 y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        __m128 z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+
+        __m128 rx = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, x), _mm_mul_ps(m4, y)), _mm_mul_ps(m8, z)), m12);
+        __m128 ry = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m1, x), _mm_mul_ps(m5, y)), _mm_mul_ps(m9, z)), m13);
+        __m128 rz = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m2, x), _mm_mul_ps(m6, y)), _mm_mul_ps(m10, z)), m14);
+
+        // Interleave results back to [x0 y0 z0 x1] [y1 z1 x2 y2] [z2 x3 y3 z3]
+        float *dst = (float *)(outPoints + i);
+        _mm_storeu_ps(dst, _mm_shuffle_ps(_mm_unpacklo_ps(rx, ry), _mm_shuffle_ps(rz, rx, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0)));
+        _mm_storeu_ps(dst + 4, _mm_shuffle_ps(_mm_shuffle_ps(ry, rz, _MM_SHUFFLE(1, 1, 1, 1)), _mm_unpackhi_ps(rx, ry), _MM_SHUFFLE(1, 0, 2, 0)));
+        _mm_storeu_ps(dst + 8, _mm_shuffle_ps(_mm_shuffle_ps(rz, rx, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(ry, rz, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+    }
+#elif defined(RAYMATH_SIMD_NEON)
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4x3_t v = vld3q_f32((const float *)(points + i));   // Deinterleaved load: [x0..x3] [y0..y3] [z0..z3]
+        float32x4x3_t r;
+
+        r.val[0] = vaddq_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(v.val[0], mat.m0), v.val[1], mat.m4), v.val[2], mat.m8), vdupq_n_f32(mat.m12));
+        r.val[1] = vaddq_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(v.val[0], mat.m1), v.val[1], mat.m5), v.val[2], mat.m9), vdupq_n_f32(mat.m13));
+        r.val[2] = vaddq_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(v.val[0], mat.m2), v.val[1], mat.m6), v.val[2], mat.m10), vdupq_n_f32(mat.m14));
+
+        vst3q_f32((float *)(outPoints + i), r);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        float x = points[i].x;
+        float y = points[i].y;
+        float z = points[i].z;
+
+        outPoints[i].x = mat.m0*x + mat.m4*y + mat.m8*z + mat.m12;
+        outPoints[i].y = mat.m1*x + mat.m5*y + mat.m9*z + mat.m13;
+        outPoints[i].z = mat.m2*x + mat.m6*y + mat.m10*z + mat.m14;
+    }
+}
+
+// Transform an array of Vector3 by a given Matrix, vectors components provided as separate arrays (SoA)
+RMAPI void Vector3TransformBatchSoA(const float *x, const float *y, const float *z, int count, Matrix mat, float *outX, float *outY, float *outZ)
+{
+    int i = 0;
+
+#if defined(RAYMATH_SIMD_AVX)
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 vx = _mm256_loadu_ps(x + i);
+        __m256 vy = _mm256_loadu_ps(y + i);
+        __m256 vz = _mm256_loadu_ps(z + i);
+
+        __m256 rx = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(mat.m0), vx), _mm256_mul_ps(_mm256_set1_ps(mat.m4), vy)), _mm256_mul_ps(_mm256_set1_ps(mat.m8), vz)), _mm256_set1_ps(mat.m12));
+        __m256 ry = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(mat.m1), vx), _mm256_mul_ps(_mm256_set1_ps(mat.m5), vy)), _mm256_mul_ps(_mm256_set1_ps(mat.m9), vz)), _mm256_set1_ps(mat.m13));
+        __m256 rz = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(mat.m2), vx), _mm256_mul_ps(_mm256_set1_ps(mat.m6), vy)), _mm256_mul_ps(_mm256_set1_ps(mat.m10), vz)), _mm256_set1_ps(mat.m14));
+
+        _mm256_storeu_ps(outX + i, rx);
+        _mm256_storeu_ps(outY + i, ry);
+        _mm256_storeu_ps(outZ + i, rz);
+    }
+#endif
+#if defined(RAYMATH_SIMD_SSE)
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 vx = _mm_loadu_ps(x + i);
+        __m128 vy = _mm_loadu_ps(y + i);
+        __m128 vz = _mm_loadu_ps(z + i);
+
+        __m128 rx = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(mat.m0), vx), _mm_mul_ps(_mm_set1_ps(mat.m4), vy)), _mm_mul_ps(_mm_set1_ps(mat.m8), vz)), _mm_set1_ps(mat.m12));
+        __m128 ry = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(mat.m1), vx), _mm_mul_ps(_mm_set1_ps(mat.m5), vy)), _mm_mul_ps(_mm_set1_ps(mat.m9), vz)), _mm_set1_ps(mat.m13));
+        __m128 rz = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(mat.m2), vx), _mm_mul_ps(_mm_set1_ps(mat.m6), vy)), _mm_mul_ps(_mm_set1_ps(mat.m10), vz)), _mm_set1_ps(mat.m14));
+
+        _mm_storeu_ps(outX + i, rx);
+        _mm_storeu_ps(outY + i, ry);
+        _mm_storeu_ps(outZ + i, rz);
+    }
+#elif defined(RAYMATH_SIMD_NEON)
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4_t vx = vld1q_f32(x + i);
+        float32x4_t vy = vld1q_f32(y + i);
+        float32x4_t vz = vld1q_f32(z + i);
+
+        vst1q_f32(outX + i, vaddq_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(vx, mat.m0), vy, mat.m4), vz, mat.m8), vdupq_n_f32(mat.m12)));
+        vst1q_f32(outY + i, vaddq_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(vx, mat.m1), vy, mat.m5), vz, mat.m9), vdupq_n_f32(mat.m13)));
+        vst1q_f32(outZ + i, vaddq_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(vx, mat.m2), vy, mat.m6), vz, mat.m10), vdupq_n_f32(mat.m14)));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        float vx = x[i];
+        float vy = y[i];
+        float vz = z[i];
+
+        outX[i] = mat.m0*vx + mat.m4*vy + mat.m8*vz + mat.m12;
+        outY[i] = mat.m1*vx + mat.m5*vy + mat.m9*vz + mat.m13;
+        outZ[i] = mat.m2*vx + mat.m6*vy + mat.m10*vz + mat.m14;
+    }
+}
+
+// Transform an array of axis-aligned bounds (min, max) by a given Matrix,
+// results are the axis-aligned bounds enclosing the transformed boxes
+// REF: Arvo - Transforming Axis-Aligned Bounding Boxes (Graphics Gems, 1990)
+RMAPI void Vector3TransformBoundsBatch(const Vector3 *mins, const Vector3 *maxs, int count, Matrix mat, Vector3 *outMins, Vector3 *outMaxs)
+{
+    int i = 0;
+
+#if defined(RAYMATH_SIMD_SSE)
+    // Matrix elements for (x, y, z) input components, translation as starting value
+    __m128 col0 = _mm_setr_ps(mat.m0, mat.m1, mat.m2, 0.0f);
+    __m128 col1 = _mm_setr_ps(mat.m4, mat.m5, mat.m6, 0.0f);
+    __m128 col2 = _mm_setr_ps(mat.m8, mat.m9, mat.m10, 0.0f);
+    __m128 col3 = _mm_setr_ps(mat.m12, mat.m13, mat.m14, 0.0f);
+    float resultMin[4] = { 0 };
+    float resultMax[4] = { 0 };
+
+    for (; i < count; i++)
+    {
+        __m128 a0 = _mm_mul_ps(col0, _mm_set1_ps(mins[i].x)), b0 = _mm_mul_ps(col0, _mm_set1_ps(maxs[i].x));
+        __m128 a1 = _mm_mul_ps(col1, _mm_set1_ps(mins[i].y)), b1 = _mm_mul_ps(col1, _mm_set1_ps(maxs[i].y));
+        __m128 a2 = _mm_mul_ps(col2, _mm_set1_ps(mins[i].z)), b2 = _mm_mul_ps(col2, _mm_set1_ps(maxs[i].z));
+
+        __m128 rmin = _mm_add_ps(_mm_add_ps(_mm_add_ps(col3, _mm_min_ps(a0, b0)), _mm_min_ps(a1, b1)), _mm_min_ps(a2, b2));
+        __m128 rmax = _mm_add_ps(_mm_add_ps(_mm_add_ps(col3, _mm_max_ps(a0, b0)), _mm_max_ps(a1, b1)), _mm_max_ps(a2, b2));
+
+        _mm_storeu_ps(resultMin, rmin);
+        _mm_storeu_ps(resultMax, rmax);
+
+        outMins[i].x = resultMin[0]; outMins[i].y = resultMin[1]; outMins[i].z = resultMin[2];
+        outMaxs[i].x = resultMax[0]; outMaxs[i].y = resultMax[1]; outMaxs[i].z = resultMax[2];
+    }
+#elif defined(RAYMATH_SIMD_NEON)
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4x3_t vmin = vld3q_f32((const float *)(mins + i));
+        float32x4x3_t vmax = vld3q_f32((const float *)(maxs + i));
+        float32x4x3_t rmin, rmax;
+
+        // Matrix rows: output component j = sum(m[j][k]*v[k]) + t[j]
+        const float m[3][4] = {
+            { mat.m0, mat.m4, mat.m8, mat.m12 },
+            { mat.m1, mat.m5, mat.m9, mat.m13 },
+            { mat.m2, mat.m6, mat.m10, mat.m14 }
+        };
+
+        for (int j = 0; j < 3; j++)
+        {
+            rmin.val[j] = vdupq_n_f32(m[j][3]);
+            rmax.val[j] = vdupq_n_f32(m[j][3]);
+
+            for (int k = 0; k < 3; k++)
+            {
+                float32x4_t a = vmulq_n_f32(vmin.val[k], m[j][k]);
+                float32x4_t b = vmulq_n_f32(vmax.val[k], m[j][k]);
+
+                rmin.val[j] = vaddq_f32(rmin.val[j], vminq_f32(a, b));
+                rmax.val[j] = vaddq_f32(rmax.val[j], vmaxq_f32(a, b));
+            }
+        }
+
+        vst3q_f32((float *)(outMins + i), rmin);
+        vst3q_f32((float *)(outMaxs + i), rmax);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        const float m[3][4] = {
+            { mat.m0, mat.m4, mat.m8, mat.m12 },
+            { mat.m1, mat.m5, mat.m9, mat.m13 },
+            { mat.m2, mat.m6, mat.m10, mat.m14 }
+        };
+        const float min[3] = { mins[i].x, mins[i].y, mins[i].z };
+        const float max[3] = { maxs[i].x, maxs[i].y, maxs[i].z };
+        float resultMin[3] = { 0 };
+        float resultMax[3] = { 0 };
+
+        for (int j = 0; j < 3; j++)
+        {
+            resultMin[j] = m[j][3];
+            resultMax[j] = m[j][3];
+
+            for (int k = 0; k < 3; k++)
+            {
+                float a = m[j][k]*min[k];
+                float b = m[j][k]*max[k];
+
+                resultMin[j] += (a < b)? a : b;
+                resultMax[j] += (a < b)? b : a;
+            }
+        }
+
+        outMins[i].x = resultMin[0]; outMins[i].y = resultMin[1]; outMins[i].z = resultMin[2];
+        outMaxs[i].x = resultMax[0]; outMaxs[i].y = resultMax[1]; outMaxs[i].z = resultMax[2];
+    }
+}
+
+// Get matrix multiplication for arrays of matrices pairs, same as MatrixMultiply(left[i], right[i])
+RMAPI void MatrixMultiplyBatch(const Matrix *left, const Matrix *right, int count, Matrix *outMatrices)
+{
+    for (int i = 0; i < count; i++)
+    {
+        // NOTE: In memory, matrix row j is [m(j) m(j + 4) m(j + 8) m(j + 12)] and
+        // result row j = sum(right[j][k]*left row k), for k = 0..3
+        const float *l = (const float *)(left + i);
+        const float *r = (const float *)(right + i);
+        float *result = (float *)(outMatrices + i);
+
+#if defined(RAYMATH_SIMD_SSE)
+        __m128 l0 = _mm_loadu_ps(l);
+        __m128 l1 = _mm_loadu_ps(l + 4);
+        __m128 l2 = _mm_loadu_ps(l + 8);
+        __m128 l3 = _mm_loadu_ps(l + 12);
+        __m128 r0 = _mm_loadu_ps(r + 0);
+        __m128 r1 = _mm_loadu_ps(r + 4);
+        __m128 r2 = _mm_loadu_ps(r + 8);
+        __m128 r3 = _mm_loadu_ps(r + 12);
+        __m128 row0 = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(l0, _mm_shuffle_ps(r0, r0, _MM_SHUFFLE(0, 0, 0, 0))), _mm_mul_ps(l1, _mm_shuffle_ps(r0, r0, _MM_SHUFFLE(1, 1, 1, 1)))),
+            _mm_mul_ps(l2, _mm_shuffle_ps(r0, r0, _MM_SHUFFLE(2, 2, 2, 2)))), _mm_mul_ps(l3, _mm_shuffle_ps(r0, r0, _MM_SHUFFLE(3, 3, 3, 3))));
+        __m128 row1 = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(l0, _mm_shuffle_ps(r1, r1, _MM_SHUFFLE(0, 0, 0, 0))), _mm_mul_ps(l1, _mm_shuffle_ps(r1, r1, _MM_SHUFFLE(1, 1, 1, 1)))),
+            _mm_mul_ps(l2, _mm_shuffle_ps(r1, r1, _MM_SHUFFLE(2, 2, 2, 2)))), _mm_mul_ps(l3, _mm_shuffle_ps(r1, r1, _MM_SHUFFLE(3, 3, 3, 3))));
+        __m128 row2 = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(l0, _mm_shuffle_ps(r2, r2, _MM_SHUFFLE(0, 0, 0, 0))), _mm_mul_ps(l1, _mm_shuffle_ps(r2, r2, _MM_SHUFFLE(1, 1, 1, 1)))),
+            _mm_mul_ps(l2, _mm_shuffle_ps(r2, r2, _MM_SHUFFLE(2, 2, 2, 2)))), _mm_mul_ps(l3, _mm_shuffle_ps(r2, r2, _MM_SHUFFLE(3, 3, 3, 3))));
+        __m128 row3 = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(l0, _mm_shuffle_ps(r3, r3, _MM_SHUFFLE(0, 0, 0, 0))), _mm_mul_ps(l1, _mm_shuffle_ps(r3, r3, _MM_SHUFFLE(1, 1, 1, 1)))),
+            _mm_mul_ps(l2, _mm_shuffle_ps(r3, r3, _MM_SHUFFLE(2, 2, 2, 2)))), _mm_mul_ps(l3, _mm_shuffle_ps(r3, r3, _MM_SHUFFLE(3, 3, 3, 3))));
+
+        _mm_storeu_ps(result + 0, row0);
+        _mm_storeu_ps(result + 4, row1);
+        _mm_storeu_ps(result + 8, row2);
+        _mm_storeu_ps(result + 12, row3);
+#elif defined(RAYMATH_SIMD_NEON)
+        float32x4_t l0 = vld1q_f32(l);
+        float32x4_t l1 = vld1q_f32(l + 4);
+        float32x4_t l2 = vld1q_f32(l + 8);
+        float32x4_t l3 = vld1q_f32(l + 12);
+        float32x4_t row[4];
+
+        for (int j = 0; j < 4; j++)
+        {
+            row[j] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(l0, r[j*4]), l1, r[j*4 + 1]), l2, r[j*4 + 2]), l3, r[j*4 + 3]);
+        }
+
+        for (int j = 0; j < 4; j++) vst1q_f32(result + j*4, row[j]);
+#else
+        float row[16] = { 0 };
+
+        for (int j = 0; j < 4; j++)
+        {
+            for (int k = 0; k < 4; k++)
+            {
+                row[j*4 + k] = r[j*4]*l[k] + r[j*4 + 1]*l[4 + k] + r[j*4 + 2]*l[8 + k] + r[j*4 + 3]*l[12 + k];
+            }
+        }
+
+        for (int j = 0; j < 16; j++) result[j] = row[j];
+#endif
+    }
+}
+
+// Calculates spherical linear interpolation for arrays of quaternions pairs, same as QuaternionSlerp(q1[i], q2[i], amount)
+RMAPI void QuaternionSlerpBatch(const Quaternion *q1, const Quaternion *q2, int count, float amount, Quaternion *outQuaternions)
+{
+#if !defined(EPSILON)
+    #define EPSILON 0.000001f
+#endif
+
+    for (int i = 0; i < count; i++)
+    {
+        Quaternion a = q1[i];
+        Quaternion b = q2[i];
+        Quaternion result = { 0 };
+
+        float cosHalfTheta = a.x*b.x + a.y*b.y + a.z*b.z + a.w*b.w;
+
+        if (cosHalfTheta < 0)
+        {
+            b.x = -b.x; b.y = -b.y; b.z = -b.z; b.w = -b.w;
+            cosHalfTheta = -cosHalfTheta;
+        }
+
+        if (fabsf(cosHalfTheta) >= 1.0f) result = a;
+        else if (cosHalfTheta > 0.95f)
+        {
+            // QuaternionNlerp(a, b, amount)
+            result.x = a.x + amount*(b.x - a.x);
+            result.y = a.y + amount*(b.y - a.y);
+            result.z = a.z + amount*(b.z - a.z);
+            result.w = a.w + amount*(b.w - a.w);
+
+            float length = sqrtf(result.x*result.x + result.y*result.y + result.z*result.z + result.w*result.w);
+            if (length == 0.0f) length = 1.0f;
+            float ilength = 1.0f/length;
+
+            result.x *= ilength;
+            result.y *= ilength;
+            result.z *= ilength;
+            result.w *= ilength;
+        }
+        else
+        {
+            float halfTheta = acosf(cosHalfTheta);
+            float sinHalfTheta = sqrtf(1.0f - cosHalfTheta*cosHalfTheta);
+
+            if (fabsf(sinHalfTheta) < EPSILON)
+            {
+                result.x = (a.x*0.5f + b.x*0.5f);
+                result.y = (a.y*0.5f + b.y*0.5f);
+                result.z = (a.z*0.5f + b.z*0.5f);
+                result.w = (a.w*0.5f + b.w*0.5f);
+            }
+            else
+            {
+                float ratioA = sinf((1 - amount)*halfTheta)/sinHalfTheta;
+                float ratioB = sinf(amount*halfTheta)/sinHalfTheta;
+
+                result.x = (a.x*ratioA + b.x*ratioB);
+                result.y = (a.y*ratioA + b.y*ratioB);
+                result.z = (a.z*ratioA + b.z*ratioB);
+                result.w = (a.w*ratioA + b.w*ratioB);
+            }
+        }
+
+        outQuaternions[i] = result;
+    }
+}
+
 #if defined(__cplusplus) && !defined(RAYMATH_DISABLE_CPP_OPERATORS)
 
 // Optional C++ math operators
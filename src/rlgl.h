@@ -20,6 +20,14 @@
 *
 *       Internal buffer (and resources) must be manually unloaded calling rlglClose()
 *
+*       Uniform values set with rlSetUniform*() are cached by shader program and location,
+*       unchanged values are not uploaded again; if uniforms are set directly with OpenGL calls,
+*       rlResetUniformCache() must be called to keep the cache valid
+*
+*       OpenGL state changes requested through rlgl (shader program, vertex array, texture slots and
+*       bindings, blending, depth, culling and scissor) are shadowed, redundant calls are not issued;
+*       if OpenGL state is changed directly, rlResetStateCache() must be called
+*
 *   CONFIGURATION:
 *       #define GRAPHICS_API_OPENGL_11
 *       #define GRAPHICS_API_OPENGL_21
@@ -55,7 +63,9 @@
 *       #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS    4    // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
 *
 *       #define RL_MAX_MATRIX_STACK_SIZE             32    // Maximum size of internal Matrix stack
-*       #define RL_MAX_SHADER_LOCATIONS              32    // Maximum number of shader locations supported
+*       #define RL_MAX_SHADER_LOCATIONS              40    // Maximum number of shader locations supported
+*       #define RL_MAX_UNIFORM_CACHE_ENTRIES       1024    // Maximum number of uniform values cached (by shader program and location)
+*       #define RL_MAX_STATE_CACHE_TEXTURE_SLOTS     16    // Maximum number of texture slots shadowed by state cache
 *       #define RL_CULL_DISTANCE_NEAR              0.01    // Default projection matrix near cull distance
 *       #define RL_CULL_DISTANCE_FAR             1000.0    // Default projection matrix far cull distance
 *
@@ -70,6 +80,11 @@
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS      "vertexBoneIds"     // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS  "vertexBoneWeights" // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS
+*       #define RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_POSITION  "instancePosition" // Instance attribute: position and scale
+*       #define RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_ROTATION  "instanceRotation" // Instance attribute: rotation quaternion
+*       #define RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_COLOR     "instanceColor"    // Instance attribute: color
+*       #define RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_TEXRECT   "instanceTexRect"  // Instance attribute: texcoords rectangle
+*       #define RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_CUSTOM    "instanceCustom"   // Instance attribute: custom vec4 array
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW        "matView"           // view matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION  "matProjection"     // projection matrix
@@ -77,6 +92,7 @@
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_NORMAL      "matNormal"         // normal matrix (transpose(inverse(matModelView)))
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR       "colDiffuse"        // color diffuse (base tint color, multiplied by texture color)
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES  "boneMatrices"   // bone matrices
+*       #define RL_DEFAULT_SHADER_UNIFORM_NAME_VERTEX_DEQUANTIZE  "vertexDequantize" // quantized vertex position offset and scale
 *       #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0  "texture0"          // texture0 (texture slot active 0)
 *       #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE1  "texture1"          // texture1 (texture slot active 1)
 *       #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2  "texture2"          // texture2 (texture slot active 2)
@@ -229,7 +245,15 @@
 
 // Shader limits
 #ifndef RL_MAX_SHADER_LOCATIONS
-    #define RL_MAX_SHADER_LOCATIONS                 32      // Maximum number of shader locations supported
+    #define RL_MAX_SHADER_LOCATIONS                 40      // Maximum number of shader locations supported
+#endif
+#ifndef RL_MAX_UNIFORM_CACHE_ENTRIES
+    #define RL_MAX_UNIFORM_CACHE_ENTRIES          1024      // Maximum number of uniform values cached (must be power of 2)
+#endif
+
+// State cache limits
+#ifndef RL_MAX_STATE_CACHE_TEXTURE_SLOTS
+    #define RL_MAX_STATE_CACHE_TEXTURE_SLOTS        16      // Maximum number of texture slots shadowed by state cache
 #endif
 
 // Projection matrix culling
@@ -271,7 +295,11 @@
 #define RL_QUADS                                0x0007      // GL_QUADS
 
 // GL equivalent data types
+#define RL_BYTE                                 0x1400      // GL_BYTE
 #define RL_UNSIGNED_BYTE                        0x1401      // GL_UNSIGNED_BYTE
+#define RL_SHORT                                0x1402      // GL_SHORT
+#define RL_UNSIGNED_SHORT                       0x1403      // GL_UNSIGNED_SHORT
+#define RL_UNSIGNED_INT                         0x1405      // GL_UNSIGNED_INT
 #define RL_FLOAT                                0x1406      // GL_FLOAT
 
 // GL buffer usage hint
@@ -422,6 +450,24 @@ typedef struct rlRenderBatch {
     float currentDepth;         // Current depth value for next draw
 } rlRenderBatch;
 
+// Draw arrays indirect command, stored in GPU buffer
+// NOTE: Layout defined by OpenGL, buffer can be filled by compute shaders (GPU-driven drawing)
+typedef struct rlDrawArraysIndirectCommand {
+    unsigned int count;                 // Number of vertex to draw
+    unsigned int instanceCount;         // Number of instances to draw
+    unsigned int first;                 // First vertex to draw
+    unsigned int baseInstance;          // First instance attributes to use
+} rlDrawArraysIndirectCommand;
+
+// Draw elements indirect command, stored in GPU buffer
+typedef struct rlDrawElementsIndirectCommand {
+    unsigned int count;                 // Number of indices to draw
+    unsigned int instanceCount;         // Number of instances to draw
+    unsigned int firstIndex;            // First index to draw
+    int baseVertex;                     // Value added to every index
+    unsigned int baseInstance;          // First instance attributes to use
+} rlDrawElementsIndirectCommand;
+
 // OpenGL version
 typedef enum {
     RL_OPENGL_11 = 1,           // OpenGL 1.1
@@ -698,6 +744,9 @@ RLAPI void rlCheckErrors(void);                         // Check and log OpenGL
 RLAPI void rlSetBlendMode(int mode);                    // Set blending mode
 RLAPI void rlSetBlendFactors(int glSrcFactor, int glDstFactor, int glEquation); // Set blending mode factor and equation (using OpenGL factors)
 RLAPI void rlSetBlendFactorsSeparate(int glSrcRGB, int glDstRGB, int glSrcAlpha, int glDstAlpha, int glEqRGB, int glEqAlpha); // Set blending mode factors and equations separately (using OpenGL factors)
+RLAPI void rlResetStateCache(void);                     // Reset OpenGL state cache (required if OpenGL state is changed directly)
+RLAPI void rlGetStateCacheStats(unsigned int *issued, unsigned int *skipped); // Get OpenGL state calls issued and skipped (redundant) since last reset
+RLAPI void rlResetStateCacheStats(void);                // Reset OpenGL state calls counters (i.e. once per frame)
 
 //------------------------------------------------------------------------------------
 // Functions Declaration - rlgl functionality
@@ -734,6 +783,7 @@ RLAPI void rlSetTexture(unsigned int id);               // Set current texture f
 RLAPI unsigned int rlLoadVertexArray(void);             // Load vertex array (vao) if supported
 RLAPI unsigned int rlLoadVertexBuffer(const void *buffer, int size, bool dynamic); // Load a vertex buffer object
 RLAPI unsigned int rlLoadVertexBufferElement(const void *buffer, int size, bool dynamic); // Load vertex buffer elements object
+RLAPI bool rlIsVertexBufferElementUintSupported(void); // Check if 32-bit vertex buffer elements (indices) are supported
 RLAPI void rlUpdateVertexBuffer(unsigned int bufferId, const void *data, int dataSize, int offset); // Update vertex buffer object data on GPU buffer
 RLAPI void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSize, int offset); // Update vertex buffer elements data on GPU buffer
 RLAPI void rlUnloadVertexArray(unsigned int vaoId);     // Unload vertex array (vao)
@@ -745,6 +795,10 @@ RLAPI void rlDrawVertexArray(int offset, int count);    // Draw vertex array (cu
 RLAPI void rlDrawVertexArrayElements(int offset, int count, const void *buffer); // Draw vertex array elements
 RLAPI void rlDrawVertexArrayInstanced(int offset, int count, int instances); // Draw vertex array (currently active vao) with instancing
 RLAPI void rlDrawVertexArrayElementsInstanced(int offset, int count, const void *buffer, int instances); // Draw vertex array elements with instancing
+RLAPI void rlDrawVertexArrayElementsEx(int offset, int count, const void *buffer, int indexType); // Draw vertex array elements with index type (RL_UNSIGNED_SHORT or RL_UNSIGNED_INT)
+RLAPI void rlDrawVertexArrayElementsInstancedEx(int offset, int count, const void *buffer, int indexType, int instances); // Draw vertex array elements with index type and instancing
+RLAPI void rlDrawVertexArrayIndirect(unsigned int bufferId, int offset, int drawCount); // Draw vertex array with draw commands from buffer (multi-draw indirect)
+RLAPI void rlDrawVertexArrayElementsIndirect(unsigned int bufferId, int offset, int drawCount, int indexType); // Draw vertex array elements with draw commands from buffer (multi-draw indirect)
 
 // Textures management
 RLAPI unsigned int rlLoadTexture(const void *data, int width, int height, int format, int mipmapCount); // Load texture data
@@ -776,6 +830,9 @@ RLAPI void rlSetUniformMatrix(int locIndex, Matrix mat);
 RLAPI void rlSetUniformMatrices(int locIndex, const Matrix *mat, int count);    // Set shader value matrices
 RLAPI void rlSetUniformSampler(int locIndex, unsigned int textureId);           // Set shader value sampler
 RLAPI void rlSetShader(unsigned int id, int *locs);                             // Set shader currently active (id and locations)
+RLAPI void rlResetUniformCache(void);                                           // Reset uniform values cache (required if uniforms are set directly with OpenGL)
+RLAPI void rlGetUniformCacheStats(unsigned int *issued, unsigned int *skipped); // Get uniform upload calls issued and skipped (value unchanged) since last reset
+RLAPI void rlResetUniformCacheStats(void);                                      // Reset uniform upload calls counters
 
 // Compute shader management
 RLAPI unsigned int rlLoadComputeShaderProgram(unsigned int shaderId);           // Load compute shader program
@@ -905,6 +962,8 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
     #define GL_SHADING_LANGUAGE_VERSION         0x8B8C
 #endif
 
+#define RL_STATE_UNKNOWN                        0xFFFFFFFF  // State cache value not known, next state call is always issued
+
 #ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
     #define GL_COMPRESSED_RGB_S3TC_DXT1_EXT     0x83F0
 #endif
@@ -999,6 +1058,23 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
     #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS  "vertexBoneWeights" // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS
 #endif
 
+// Default shader instance attribute names, locations queried on shader loading
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_POSITION
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_POSITION "instancePosition" // Instance position and uniform scale (quantized transform)
+#endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_ROTATION
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_ROTATION "instanceRotation" // Instance rotation quaternion (quantized transform)
+#endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_COLOR
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_COLOR    "instanceColor"    // Instance color
+#endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_TEXRECT
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_TEXRECT  "instanceTexRect"  // Instance texcoords rectangle (x, y, width, height)
+#endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_CUSTOM
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_CUSTOM   "instanceCustom"   // Instance custom vec4 array
+#endif
+
 #ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_MVP
     #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
 #endif
@@ -1020,6 +1096,9 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES
     #define RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES  "boneMatrices"   // bone matrices
 #endif
+#ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_VERTEX_DEQUANTIZE
+    #define RL_DEFAULT_SHADER_UNIFORM_NAME_VERTEX_DEQUANTIZE  "vertexDequantize" // quantized vertex position offset (xyz) and scale (w)
+#endif
 #ifndef RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0
     #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0  "texture0"          // texture0 (texture slot active 0)
 #endif
@@ -1034,6 +1113,15 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Uniform value cache entry
+// NOTE: Only single values up to a 4x4 float matrix are cached, arrays are always uploaded
+typedef struct rlUniformCacheEntry {
+    unsigned int shaderId;              // Shader program id owning the uniform (0 for empty entry)
+    int locIndex;                       // Uniform location in shader program
+    int size;                           // Uniform value size in bytes
+    unsigned char value[64];            // Uniform value last uploaded
+} rlUniformCacheEntry;
+
 typedef struct rlglData {
     rlRenderBatch *currentBatch;            // Current render batch
     rlRenderBatch defaultBatch;             // Default internal render batch
@@ -1062,6 +1150,31 @@ typedef struct rlglData {
         unsigned int currentShaderId;       // Current shader id to be used on rendering (by default, defaultShaderId)
         int *currentShaderLocs;             // Current shader locations pointer to be used on rendering (by default, defaultShaderLocs)
 
+        // OpenGL state cache variables
+        // NOTE: State values are RL_STATE_UNKNOWN until first set through rlgl
+        unsigned int activeShaderId;        // Shader program currently bound (glUseProgram())
+        unsigned int activeVertexArrayId;   // Vertex array object currently bound (glBindVertexArray())
+        unsigned int activeTextureSlot;     // Texture slot currently active (glActiveTexture())
+        unsigned int boundTexture2D[RL_MAX_STATE_CACHE_TEXTURE_SLOTS];      // Texture 2D bound per texture slot
+        unsigned int boundTextureCubemap[RL_MAX_STATE_CACHE_TEXTURE_SLOTS]; // Texture cubemap bound per texture slot
+        unsigned int colorBlendEnabled;     // Color blending enabled (GL_BLEND)
+        unsigned int depthTestEnabled;      // Depth test enabled (GL_DEPTH_TEST)
+        unsigned int depthMaskEnabled;      // Depth write enabled (glDepthMask())
+        unsigned int cullFaceEnabled;       // Backface culling enabled (GL_CULL_FACE)
+        unsigned int scissorTestEnabled;    // Scissor test enabled (GL_SCISSOR_TEST)
+        unsigned int blendFactors[4];       // Blending factors set: srcRGB, dstRGB, srcAlpha, dstAlpha
+        unsigned int blendEquations[2];     // Blending equations set: RGB, alpha
+        unsigned int stateCallsIssued;      // State calls issued to OpenGL
+        unsigned int stateCallsSkipped;     // State calls skipped (redundant)
+
+        // Uniforms cache variables
+        rlUniformCacheEntry *uniformCache;  // Uniform values last uploaded, by shader program and location
+        unsigned int uniformCallsIssued;    // Uniform upload calls issued to OpenGL
+        unsigned int uniformCallsSkipped;   // Uniform upload calls skipped (value already set)
+        Matrix normalTransform;             // Transform matrix used to compute normal matrix (lazy evaluation)
+        Matrix normalMatrix;                // Normal matrix computed for normalTransform: transpose(inverse(transform))
+        bool normalMatrixReady;             // Normal matrix computed flag
+
         bool stereoRender;                  // Stereo rendering flag
         Matrix projectionStereo[2];         // VR stereo rendering eyes projection matrices
         Matrix viewOffsetStereo[2];         // VR stereo rendering eyes view offset matrices
@@ -1100,6 +1213,7 @@ typedef struct rlglData {
         bool texAnisoFilter;                // Anisotropic texture filtering support (GL_EXT_texture_filter_anisotropic)
         bool computeShader;                 // Compute shaders support (GL_ARB_compute_shader)
         bool ssbo;                          // Shader storage buffer object support (GL_ARB_shader_storage_buffer_object)
+        bool elementIndexUint;              // 32-bit vertex indices support (GL_OES_element_index_uint)
 
         float maxAnisotropyLevel;           // Maximum anisotropy level supported (minimum is 2.0f)
         int maxDepthBits;                   // Maximum bits for depth component
@@ -1139,12 +1253,19 @@ static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static void rlLoadShaderDefault(void);      // Load default shader
 static void rlUnloadShaderDefault(void);    // Unload default shader
+static bool rlCheckUniformCache(int locIndex, int count, const void *value, int size); // Check uniform value against cache, returns true if upload required
+static void rlStateActiveTexture(unsigned int slot);        // Set active texture slot (filtered by state cache)
+static void rlStateBindVertexArray(unsigned int vaoId);     // Bind vertex array object (filtered by state cache)
+static void rlStateEnable(unsigned int cap, unsigned int *current, bool enabled); // Enable/disable OpenGL capability (filtered by state cache)
+static void rlStateBlend(unsigned int srcRGB, unsigned int dstRGB, unsigned int srcAlpha, unsigned int dstAlpha, unsigned int eqRGB, unsigned int eqAlpha); // Set blending factors and equations (filtered by state cache)
+static void rlStateRemoveTexture(unsigned int id);          // Remove deleted texture from state cache bindings
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 static const char *rlGetCompressedFormatName(int format); // Get compressed format official GL identifier name
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
 static int rlGetPixelDataSize(int width, int height, int format);   // Get pixel data size in bytes (image or texture)
+static void rlStateBindTexture(unsigned int target, unsigned int id); // Bind texture to active texture slot (filtered by state cache)
 
 // Auxiliar matrix math functions
 typedef struct rl_float16 {
@@ -1680,7 +1801,7 @@ void rlSetTexture(unsigned int id)
 void rlActiveTextureSlot(int slot)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glActiveTexture(GL_TEXTURE0 + slot);
+    rlStateActiveTexture(slot);
 #endif
 }
 
@@ -1690,7 +1811,7 @@ void rlEnableTexture(unsigned int id)
 #if defined(GRAPHICS_API_OPENGL_11)
     glEnable(GL_TEXTURE_2D);
 #endif
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlStateBindTexture(GL_TEXTURE_2D, id);
 }
 
 // Disable texture
@@ -1699,14 +1820,14 @@ void rlDisableTexture(void)
 #if defined(GRAPHICS_API_OPENGL_11)
     glDisable(GL_TEXTURE_2D);
 #endif
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlStateBindTexture(GL_TEXTURE_2D, 0);
 }
 
 // Enable texture cubemap
 void rlEnableTextureCubemap(unsigned int id)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+    rlStateBindTexture(GL_TEXTURE_CUBE_MAP, id);
 #endif
 }
 
@@ -1714,14 +1835,14 @@ void rlEnableTextureCubemap(unsigned int id)
 void rlDisableTextureCubemap(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+    rlStateBindTexture(GL_TEXTURE_CUBE_MAP, 0);
 #endif
 }
 
 // Set texture parameters (wrap mode/filter mode)
 void rlTextureParameters(unsigned int id, int param, int value)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlStateBindTexture(GL_TEXTURE_2D, id);
 
 #if !defined(GRAPHICS_API_OPENGL_11)
     // Reset anisotropy filter, in case it was set
@@ -1763,14 +1884,14 @@ void rlTextureParameters(unsigned int id, int param, int value)
         default: break;
     }
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlStateBindTexture(GL_TEXTURE_2D, 0);
 }
 
 // Set cubemap parameters (wrap mode/filter mode)
 void rlCubemapParameters(unsigned int id, int param, int value)
 {
 #if !defined(GRAPHICS_API_OPENGL_11)
-    glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+    rlStateBindTexture(GL_TEXTURE_CUBE_MAP, id);
 
     // Reset anisotropy filter, in case it was set
     glTexParameterf(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAX_ANISOTROPY_EXT, 1.0f);
@@ -1806,7 +1927,7 @@ void rlCubemapParameters(unsigned int id, int param, int value)
         default: break;
     }
 
-    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+    rlStateBindTexture(GL_TEXTURE_CUBE_MAP, 0);
 #endif
 }
 
@@ -1814,7 +1935,13 @@ void rlCubemapParameters(unsigned int id, int param, int value)
 void rlEnableShader(unsigned int id)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
-    glUseProgram(id);
+    if (RLGL.State.activeShaderId != id)
+    {
+        glUseProgram(id);
+        RLGL.State.activeShaderId = id;
+        RLGL.State.stateCallsIssued++;
+    }
+    else RLGL.State.stateCallsSkipped++;
 #endif
 }
 
@@ -1822,7 +1949,13 @@ void rlEnableShader(unsigned int id)
 void rlDisableShader(void)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
-    glUseProgram(0);
+    if (RLGL.State.activeShaderId != 0)
+    {
+        glUseProgram(0);
+        RLGL.State.activeShaderId = 0;
+        RLGL.State.stateCallsIssued++;
+    }
+    else RLGL.State.stateCallsSkipped++;
 #endif
 }
 
@@ -1920,6 +2053,51 @@ void rlActiveDrawBuffers(int count)
 // General render state configuration
 //----------------------------------------------------------------------------------
 
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// NOTE: Render state changes are filtered by state cache
+
+// Enable color blending
+void rlEnableColorBlend(void) { rlStateEnable(GL_BLEND, &RLGL.State.colorBlendEnabled, true); }
+
+// Disable color blending
+void rlDisableColorBlend(void) { rlStateEnable(GL_BLEND, &RLGL.State.colorBlendEnabled, false); }
+
+// Enable depth test
+void rlEnableDepthTest(void) { rlStateEnable(GL_DEPTH_TEST, &RLGL.State.depthTestEnabled, true); }
+
+// Disable depth test
+void rlDisableDepthTest(void) { rlStateEnable(GL_DEPTH_TEST, &RLGL.State.depthTestEnabled, false); }
+
+// Enable depth write
+void rlEnableDepthMask(void)
+{
+    if (RLGL.State.depthMaskEnabled != 1)
+    {
+        glDepthMask(GL_TRUE);
+        RLGL.State.depthMaskEnabled = 1;
+        RLGL.State.stateCallsIssued++;
+    }
+    else RLGL.State.stateCallsSkipped++;
+}
+
+// Disable depth write
+void rlDisableDepthMask(void)
+{
+    if (RLGL.State.depthMaskEnabled != 0)
+    {
+        glDepthMask(GL_FALSE);
+        RLGL.State.depthMaskEnabled = 0;
+        RLGL.State.stateCallsIssued++;
+    }
+    else RLGL.State.stateCallsSkipped++;
+}
+
+// Enable backface culling
+void rlEnableBackfaceCulling(void) { rlStateEnable(GL_CULL_FACE, &RLGL.State.cullFaceEnabled, true); }
+
+// Disable backface culling
+void rlDisableBackfaceCulling(void) { rlStateEnable(GL_CULL_FACE, &RLGL.State.cullFaceEnabled, false); }
+#else
 // Enable color blending
 void rlEnableColorBlend(void) { glEnable(GL_BLEND); }
 
@@ -1943,6 +2121,7 @@ void rlEnableBackfaceCulling(void) { glEnable(GL_CULL_FACE); }
 
 // Disable backface culling
 void rlDisableBackfaceCulling(void) { glDisable(GL_CULL_FACE); }
+#endif
 
 // Set color mask active for screen read/draw
 void rlColorMask(bool r, bool g, bool b, bool a) { glColorMask(r, g, b, a); }
@@ -1958,11 +2137,19 @@ void rlSetCullFace(int mode)
     }
 }
 
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Enable scissor test
+void rlEnableScissorTest(void) { rlStateEnable(GL_SCISSOR_TEST, &RLGL.State.scissorTestEnabled, true); }
+
+// Disable scissor test
+void rlDisableScissorTest(void) { rlStateEnable(GL_SCISSOR_TEST, &RLGL.State.scissorTestEnabled, false); }
+#else
 // Enable scissor test
 void rlEnableScissorTest(void) { glEnable(GL_SCISSOR_TEST); }
 
 // Disable scissor test
 void rlDisableScissorTest(void) { glDisable(GL_SCISSOR_TEST); }
+#endif
 
 // Scissor test
 void rlScissor(int x, int y, int width, int height) { glScissor(x, y, width, height); }
@@ -2101,23 +2288,23 @@ void rlSetBlendMode(int mode)
 
         switch (mode)
         {
-            case RL_BLEND_ALPHA: glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_ADDITIVE: glBlendFunc(GL_SRC_ALPHA, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_MULTIPLIED: glBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_ADD_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_SUBTRACT_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_SUBTRACT); break;
-            case RL_BLEND_ALPHA_PREMULTIPLY: glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
+            // NOTE: Blending factors and equations are filtered by state cache
+            case RL_BLEND_ALPHA: rlStateBlend(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_FUNC_ADD, GL_FUNC_ADD); break;
+            case RL_BLEND_ADDITIVE: rlStateBlend(GL_SRC_ALPHA, GL_ONE, GL_SRC_ALPHA, GL_ONE, GL_FUNC_ADD, GL_FUNC_ADD); break;
+            case RL_BLEND_MULTIPLIED: rlStateBlend(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA, GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA, GL_FUNC_ADD, GL_FUNC_ADD); break;
+            case RL_BLEND_ADD_COLORS: rlStateBlend(GL_ONE, GL_ONE, GL_ONE, GL_ONE, GL_FUNC_ADD, GL_FUNC_ADD); break;
+            case RL_BLEND_SUBTRACT_COLORS: rlStateBlend(GL_ONE, GL_ONE, GL_ONE, GL_ONE, GL_FUNC_SUBTRACT, GL_FUNC_SUBTRACT); break;
+            case RL_BLEND_ALPHA_PREMULTIPLY: rlStateBlend(GL_ONE, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA, GL_FUNC_ADD, GL_FUNC_ADD); break;
             case RL_BLEND_CUSTOM:
             {
                 // NOTE: Using GL blend src/dst factors and GL equation configured with rlSetBlendFactors()
-                glBlendFunc(RLGL.State.glBlendSrcFactor, RLGL.State.glBlendDstFactor); glBlendEquation(RLGL.State.glBlendEquation);
+                rlStateBlend(RLGL.State.glBlendSrcFactor, RLGL.State.glBlendDstFactor, RLGL.State.glBlendSrcFactor, RLGL.State.glBlendDstFactor, RLGL.State.glBlendEquation, RLGL.State.glBlendEquation);
 
             } break;
             case RL_BLEND_CUSTOM_SEPARATE:
             {
                 // NOTE: Using GL blend src/dst factors and GL equation configured with rlSetBlendFactorsSeparate()
-                glBlendFuncSeparate(RLGL.State.glBlendSrcFactorRGB, RLGL.State.glBlendDestFactorRGB, RLGL.State.glBlendSrcFactorAlpha, RLGL.State.glBlendDestFactorAlpha);
-                glBlendEquationSeparate(RLGL.State.glBlendEquationRGB, RLGL.State.glBlendEquationAlpha);
+                rlStateBlend(RLGL.State.glBlendSrcFactorRGB, RLGL.State.glBlendDestFactorRGB, RLGL.State.glBlendSrcFactorAlpha, RLGL.State.glBlendDestFactorAlpha, RLGL.State.glBlendEquationRGB, RLGL.State.glBlendEquationAlpha);
 
             } break;
             default: break;
@@ -2129,6 +2316,56 @@ void rlSetBlendMode(int mode)
 #endif
 }
 
+// Reset OpenGL state cache
+// NOTE: All state is set as unknown, next state calls are issued to OpenGL
+void rlResetStateCache(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.activeShaderId = RL_STATE_UNKNOWN;
+    RLGL.State.activeVertexArrayId = RL_STATE_UNKNOWN;
+    RLGL.State.activeTextureSlot = RL_STATE_UNKNOWN;
+
+    for (int i = 0; i < RL_MAX_STATE_CACHE_TEXTURE_SLOTS; i++)
+    {
+        RLGL.State.boundTexture2D[i] = RL_STATE_UNKNOWN;
+        RLGL.State.boundTextureCubemap[i] = RL_STATE_UNKNOWN;
+    }
+
+    RLGL.State.colorBlendEnabled = RL_STATE_UNKNOWN;
+    RLGL.State.depthTestEnabled = RL_STATE_UNKNOWN;
+    RLGL.State.depthMaskEnabled = RL_STATE_UNKNOWN;
+    RLGL.State.cullFaceEnabled = RL_STATE_UNKNOWN;
+    RLGL.State.scissorTestEnabled = RL_STATE_UNKNOWN;
+
+    for (int i = 0; i < 4; i++) RLGL.State.blendFactors[i] = RL_STATE_UNKNOWN;
+    for (int i = 0; i < 2; i++) RLGL.State.blendEquations[i] = RL_STATE_UNKNOWN;
+
+    // Blending mode must be set again, blending factors are not known
+    RLGL.State.currentBlendMode = -1;
+#endif
+}
+
+// Get OpenGL state calls issued and skipped (redundant) since last reset
+void rlGetStateCacheStats(unsigned int *issued, unsigned int *skipped)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (issued != NULL) *issued = RLGL.State.stateCallsIssued;
+    if (skipped != NULL) *skipped = RLGL.State.stateCallsSkipped;
+#else
+    if (issued != NULL) *issued = 0;
+    if (skipped != NULL) *skipped = 0;
+#endif
+}
+
+// Reset OpenGL state calls counters
+void rlResetStateCacheStats(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.stateCallsIssued = 0;
+    RLGL.State.stateCallsSkipped = 0;
+#endif
+}
+
 // Set blending mode factor and equation
 void rlSetBlendFactors(int glSrcFactor, int glDstFactor, int glEquation)
 {
@@ -2252,6 +2489,10 @@ void rlglInit(int width, int height)
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Init state cache, OpenGL context state is unknown at this point
+    rlResetStateCache();
+    rlResetStateCacheStats();
+
     // Init default white texture
     unsigned char pixels[4] = { 255, 255, 255, 255 };   // 1 pixel RGBA (4 bytes)
     RLGL.State.defaultTextureId = rlLoadTexture(pixels, 1, 1, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
@@ -2265,6 +2506,10 @@ void rlglInit(int width, int height)
     RLGL.State.currentShaderId = RLGL.State.defaultShaderId;
     RLGL.State.currentShaderLocs = RLGL.State.defaultShaderLocs;
 
+    // Init uniform values cache
+    RLGL.State.uniformCache = (rlUniformCacheEntry *)RL_CALLOC(RL_MAX_UNIFORM_CACHE_ENTRIES, sizeof(rlUniformCacheEntry));
+    RLGL.State.normalMatrixReady = false;
+
     // Init default vertex arrays buffers
     // Simulate that the default shader has the location RL_SHADER_LOC_VERTEX_NORMAL to bind the normal buffer for the default render batch
     RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL] = RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL;
@@ -2286,17 +2531,22 @@ void rlglInit(int width, int height)
     //----------------------------------------------------------
     // Init state: Depth test
     glDepthFunc(GL_LEQUAL);                                 // Type of depth testing to apply
-    glDisable(GL_DEPTH_TEST);                               // Disable depth testing for 2D (only used for 3D)
+    rlDisableDepthTest();                                   // Disable depth testing for 2D (only used for 3D)
 
     // Init state: Blending mode
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlStateBlend(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_FUNC_ADD, GL_FUNC_ADD); // Color blending function (how colors are mixed)
+    RLGL.State.currentBlendMode = RL_BLEND_ALPHA;
+#else
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);      // Color blending function (how colors are mixed)
-    glEnable(GL_BLEND);                                     // Enable color blending (required to work with transparencies)
+#endif
+    rlEnableColorBlend();                                   // Enable color blending (required to work with transparencies)
 
     // Init state: Culling
     // NOTE: All shapes/models triangles are drawn CCW
     glCullFace(GL_BACK);                                    // Cull the back face (default)
     glFrontFace(GL_CCW);                                    // Front face are defined counter clockwise (default)
-    glEnable(GL_CULL_FACE);                                 // Enable backface culling
+    rlEnableBackfaceCulling();                              // Enable backface culling
 
     // Init state: Cubemap seamless
 #if defined(GRAPHICS_API_OPENGL_33)
@@ -2333,7 +2583,11 @@ void rlglClose(void)
     rlUnloadShaderDefault();          // Unload default shader
 
     glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
+    rlStateRemoveTexture(RLGL.State.defaultTextureId);
     TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Default texture unloaded successfully", RLGL.State.defaultTextureId);
+
+    RL_FREE(RLGL.State.uniformCache);   // Unload uniform values cache
+    RLGL.State.uniformCache = NULL;
 #endif
 }
 
@@ -2370,6 +2624,7 @@ void rlLoadExtensions(void *loader)
     RLGL.ExtSupported.maxDepthBits = 32;
     RLGL.ExtSupported.texAnisoFilter = GLAD_GL_EXT_texture_filter_anisotropic;
     RLGL.ExtSupported.texMirrorClamp = GLAD_GL_EXT_texture_mirror_clamp;
+    RLGL.ExtSupported.elementIndexUint = true;
 #else
     // Register supported extensions flags
     // OpenGL 3.3 extensions supported by default (core)
@@ -2382,6 +2637,7 @@ void rlLoadExtensions(void *loader)
     RLGL.ExtSupported.maxDepthBits = 32;
     RLGL.ExtSupported.texAnisoFilter = true;
     RLGL.ExtSupported.texMirrorClamp = true;
+    RLGL.ExtSupported.elementIndexUint = true;
 #endif
 
     // Optional OpenGL 3.3 extensions
@@ -2408,6 +2664,7 @@ void rlLoadExtensions(void *loader)
     RLGL.ExtSupported.maxDepthBits = 24;
     RLGL.ExtSupported.texAnisoFilter = true;
     RLGL.ExtSupported.texMirrorClamp = true;
+    RLGL.ExtSupported.elementIndexUint = true;
     // TODO: Check for additional OpenGL ES 3.0 supported extensions:
     //RLGL.ExtSupported.texCompDXT = true;
     //RLGL.ExtSupported.texCompETC1 = true;
@@ -2519,6 +2776,9 @@ void rlLoadExtensions(void *loader)
         // NOTE: Only check on OpenGL ES, OpenGL 3.3 has NPOT textures full support as core feature
         if (strcmp(extList[i], (const char *)"GL_OES_texture_npot") == 0) RLGL.ExtSupported.texNPOT = true;
 
+        // Check 32-bit vertex indices support
+        if (strcmp(extList[i], (const char *)"GL_OES_element_index_uint") == 0) RLGL.ExtSupported.elementIndexUint = true;
+
         // Check texture float support
         if (strcmp(extList[i], (const char *)"GL_OES_texture_float") == 0) RLGL.ExtSupported.texFloat32 = true;
         if (strcmp(extList[i], (const char *)"GL_OES_texture_half_float") == 0) RLGL.ExtSupported.texFloat16 = true;
@@ -2779,7 +3039,7 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         {
             // Initialize Quads VAO
             glGenVertexArrays(1, &batch.vertexBuffer[i].vaoId);
-            glBindVertexArray(batch.vertexBuffer[i].vaoId);
+            rlStateBindVertexArray(batch.vertexBuffer[i].vaoId);
         }
 
         // Quads - Vertex buffers binding and attributes enable
@@ -2825,7 +3085,7 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
     TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
 
     // Unbind the current VAO
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    if (RLGL.ExtSupported.vao) rlStateBindVertexArray(0);
     //--------------------------------------------------------------------------------------------
 
     // Init draw calls tracking system
@@ -2867,12 +3127,12 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         // Unbind VAO attribs data
         if (RLGL.ExtSupported.vao)
         {
-            glBindVertexArray(batch.vertexBuffer[i].vaoId);
+            rlStateBindVertexArray(batch.vertexBuffer[i].vaoId);
             glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
             glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
             glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
             glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
-            glBindVertexArray(0);
+            rlStateBindVertexArray(0);
         }
 
         // Delete VBOs from GPU (VRAM)
@@ -2911,7 +3171,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     if (RLGL.State.vertexCounter > 0)
     {
         // Activate elements VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+        if (RLGL.ExtSupported.vao) rlStateBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
 
         // Vertex positions buffer
         glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
@@ -2948,8 +3208,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         // }
         // glUnmapBuffer(GL_ARRAY_BUFFER);
 
-        // Unbind the current VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+        // NOTE: Current VAO is kept bound, it is used again for drawing just after
     }
     //------------------------------------------------------------------------------------------------------------
 
@@ -2978,15 +3237,16 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         if (RLGL.State.vertexCounter > 0)
         {
             // Set current shader and upload current MVP matrix
-            glUseProgram(RLGL.State.currentShaderId);
+            // NOTE: Uniform values are checked against uniforms cache, unchanged values are not uploaded
+            rlEnableShader(RLGL.State.currentShaderId);
 
             // Create modelview-projection matrix and upload to shader
             Matrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
-            glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP], 1, false, rlMatrixToFloat(matMVP));
+            rlSetUniformMatrix(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP], matMVP);
 
             if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_PROJECTION] != -1)
             {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_PROJECTION], 1, false, rlMatrixToFloat(RLGL.State.projection));
+                rlSetUniformMatrix(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_PROJECTION], RLGL.State.projection);
             }
 
             // WARNING: For the following setup of the view, model, and normal matrices, it is expected that
@@ -2994,20 +3254,28 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
 
             if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_VIEW] != -1)
             {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_VIEW], 1, false, rlMatrixToFloat(RLGL.State.modelview));
+                rlSetUniformMatrix(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_VIEW], RLGL.State.modelview);
             }
 
             if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MODEL] != -1)
             {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MODEL], 1, false, rlMatrixToFloat(RLGL.State.transform));
+                rlSetUniformMatrix(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MODEL], RLGL.State.transform);
             }
 
             if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_NORMAL] != -1)
             {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_NORMAL], 1, false, rlMatrixToFloat(rlMatrixTranspose(rlMatrixInvert(RLGL.State.transform))));
+                // Normal matrix is only computed again when transform matrix changes
+                if (!RLGL.State.normalMatrixReady || (memcmp(&RLGL.State.normalTransform, &RLGL.State.transform, sizeof(Matrix)) != 0))
+                {
+                    RLGL.State.normalTransform = RLGL.State.transform;
+                    RLGL.State.normalMatrix = rlMatrixTranspose(rlMatrixInvert(RLGL.State.transform));
+                    RLGL.State.normalMatrixReady = true;
+                }
+
+                rlSetUniformMatrix(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_NORMAL], RLGL.State.normalMatrix);
             }
 
-            if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+            if (RLGL.ExtSupported.vao) rlStateBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
             else
             {
                 // Bind vertex attrib: position (shader-location = 0)
@@ -3034,8 +3302,10 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             }
 
             // Setup some default shader values
-            glUniform4f(RLGL.State.currentShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
-            glUniform1i(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], 0);  // Active default sampler2D: texture0
+            float colorDiffuse[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+            int samplerDiffuse = 0;     // Active default sampler2D: texture0
+            rlSetUniform(RLGL.State.currentShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], colorDiffuse, RL_SHADER_UNIFORM_VEC4, 1);
+            rlSetUniform(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], &samplerDiffuse, RL_SHADER_UNIFORM_SAMPLER2D, 1);
 
             // Activate additional sampler textures
             // Those additional textures will be common for all draw calls of the batch
@@ -3043,19 +3313,19 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             {
                 if (RLGL.State.activeTextureId[i] > 0)
                 {
-                    glActiveTexture(GL_TEXTURE0 + 1 + i);
-                    glBindTexture(GL_TEXTURE_2D, RLGL.State.activeTextureId[i]);
+                    rlStateActiveTexture(1 + i);
+                    rlStateBindTexture(GL_TEXTURE_2D, RLGL.State.activeTextureId[i]);
                 }
             }
 
             // Activate default sampler2D texture0 (one texture is always active for default batch shader)
             // NOTE: Batch system accumulates calls by texture0 changes, additional textures are enabled for all the draw calls
-            glActiveTexture(GL_TEXTURE0);
+            rlStateActiveTexture(0);
 
             for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
             {
                 // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
-                glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+                rlStateBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
 
                 if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
                 else
@@ -3080,12 +3350,12 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
             }
 
-            glBindTexture(GL_TEXTURE_2D, 0);    // Unbind textures
+            rlStateBindTexture(GL_TEXTURE_2D, 0);    // Unbind textures
         }
 
-        if (RLGL.ExtSupported.vao) glBindVertexArray(0); // Unbind VAO
+        if (RLGL.ExtSupported.vao) rlStateBindVertexArray(0); // Unbind VAO
 
-        glUseProgram(0);    // Unbind shader program
+        rlDisableShader();  // Unbind shader program
     }
 
     // Restore viewport to default measures
@@ -3178,7 +3448,7 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
 {
     unsigned int id = 0;
 
-    glBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
+    rlStateBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
 
     // Check texture format support by OpenGL 1.1 (compressed textures not supported)
 #if defined(GRAPHICS_API_OPENGL_11)
@@ -3225,7 +3495,7 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
 
     glGenTextures(1, &id);              // Generate texture id
 
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlStateBindTexture(GL_TEXTURE_2D, id);
 
     int mipWidth = width;
     int mipHeight = height;
@@ -3318,7 +3588,7 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
     // NOTE: If mipmaps were not in data, they are not generated automatically
 
     // Unbind current texture
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlStateBindTexture(GL_TEXTURE_2D, 0);
 
     if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Texture loaded successfully (%ix%i | %s | %i mipmaps)", id, width, height, rlGetPixelFormatName(format), mipmapCount);
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load texture");
@@ -3354,7 +3624,7 @@ unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
     if (!useRenderBuffer && RLGL.ExtSupported.texDepth)
     {
         glGenTextures(1, &id);
-        glBindTexture(GL_TEXTURE_2D, id);
+        rlStateBindTexture(GL_TEXTURE_2D, id);
         glTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
 
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
@@ -3362,7 +3632,7 @@ unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
-        glBindTexture(GL_TEXTURE_2D, 0);
+        rlStateBindTexture(GL_TEXTURE_2D, 0);
 
         TRACELOG(RL_LOG_INFO, "TEXTURE: Depth texture loaded successfully");
     }
@@ -3400,7 +3670,7 @@ unsigned int rlLoadTextureCubemap(const void *data, int size, int format, int mi
     unsigned int dataSize = rlGetPixelDataSize(size, size, format);
 
     glGenTextures(1, &id);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+    rlStateBindTexture(GL_TEXTURE_CUBE_MAP, id);
 
     unsigned int glInternalFormat, glFormat, glType;
     rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
@@ -3471,7 +3741,7 @@ unsigned int rlLoadTextureCubemap(const void *data, int size, int format, int mi
     glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);  // Flag not supported on OpenGL ES 2.0
 #endif
 
-    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+    rlStateBindTexture(GL_TEXTURE_CUBE_MAP, 0);
 #endif
 
     if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Cubemap texture loaded successfully (%ix%i)", id, size, size);
@@ -3484,7 +3754,7 @@ unsigned int rlLoadTextureCubemap(const void *data, int size, int format, int mi
 // NOTE: We don't know safely if internal texture format is the expected one...
 void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlStateBindTexture(GL_TEXTURE_2D, id);
 
     unsigned int glInternalFormat, glFormat, glType;
     rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
@@ -3573,6 +3843,9 @@ void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned
 void rlUnloadTexture(unsigned int id)
 {
     glDeleteTextures(1, &id);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlStateRemoveTexture(id);
+#endif
 }
 
 // Generate mipmap data for selected texture
@@ -3580,7 +3853,7 @@ void rlUnloadTexture(unsigned int id)
 void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlStateBindTexture(GL_TEXTURE_2D, id);
 
     // Check if texture is power-of-two (POT)
     bool texIsPOT = false;
@@ -3601,7 +3874,7 @@ void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int
     }
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to generate mipmaps", id);
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlStateBindTexture(GL_TEXTURE_2D, 0);
 #else
     TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] GPU mipmap generation not supported", id);
 #endif
@@ -3613,7 +3886,7 @@ void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
     void *pixels = NULL;
 
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlStateBindTexture(GL_TEXTURE_2D, id);
 
     // NOTE: Using texture id, we can retrieve some texture info (but not on OpenGL ES 2.0)
     // Possible texture info: GL_TEXTURE_RED_SIZE, GL_TEXTURE_GREEN_SIZE, GL_TEXTURE_BLUE_SIZE, GL_TEXTURE_ALPHA_SIZE
@@ -3639,7 +3912,7 @@ void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
     }
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Data retrieval not suported for pixel format (%i)", id, format);
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlStateBindTexture(GL_TEXTURE_2D, 0);
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_ES2)
@@ -3653,7 +3926,7 @@ void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
     unsigned int fboId = rlLoadFramebuffer();
 
     glBindFramebuffer(GL_FRAMEBUFFER, fboId);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlStateBindTexture(GL_TEXTURE_2D, 0);
 
     // Attach our texture to FBO
     glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id, 0);
@@ -3807,7 +4080,11 @@ void rlUnloadFramebuffer(unsigned int id)
 
     unsigned int depthIdU = (unsigned int)depthId;
     if (depthType == GL_RENDERBUFFER) glDeleteRenderbuffers(1, &depthIdU);
-    else if (depthType == GL_TEXTURE) glDeleteTextures(1, &depthIdU);
+    else if (depthType == GL_TEXTURE)
+    {
+        glDeleteTextures(1, &depthIdU);
+        rlStateRemoveTexture(depthIdU);
+    }
 
     // NOTE: If a texture object is deleted while its image is attached to the *currently bound* framebuffer,
     // the texture image is automatically detached from the currently bound framebuffer
@@ -3849,6 +4126,17 @@ unsigned int rlLoadVertexBufferElement(const void *buffer, int size, bool dynami
     return id;
 }
 
+// Check if 32-bit vertex buffer elements (indices) are supported
+// NOTE: OpenGL ES2 requires extension GL_OES_element_index_uint
+bool rlIsVertexBufferElementUintSupported(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    return RLGL.ExtSupported.elementIndexUint;
+#else
+    return true;
+#endif
+}
+
 // Enable vertex buffer (VBO)
 void rlEnableVertexBuffer(unsigned int id)
 {
@@ -3908,7 +4196,7 @@ bool rlEnableVertexArray(unsigned int vaoId)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (RLGL.ExtSupported.vao)
     {
-        glBindVertexArray(vaoId);
+        rlStateBindVertexArray(vaoId);
         result = true;
     }
 #endif
@@ -3919,7 +4207,7 @@ bool rlEnableVertexArray(unsigned int vaoId)
 void rlDisableVertexArray(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    if (RLGL.ExtSupported.vao) rlStateBindVertexArray(0);
 #endif
 }
 
@@ -3948,11 +4236,22 @@ void rlDrawVertexArray(int offset, int count)
 // Draw vertex array elements
 void rlDrawVertexArrayElements(int offset, int count, const void *buffer)
 {
+    rlDrawVertexArrayElementsEx(offset, count, buffer, RL_UNSIGNED_SHORT);
+}
+
+// Draw vertex array elements with index type
+// NOTE: RL_UNSIGNED_INT indices require OpenGL ES2 extension GL_OES_element_index_uint
+void rlDrawVertexArrayElementsEx(int offset, int count, const void *buffer, int indexType)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((indexType == RL_UNSIGNED_INT) && !RLGL.ExtSupported.elementIndexUint) return;
+#endif
+
     // NOTE: Added pointer math separately from function to avoid UBSAN complaining
-    unsigned short *bufferPtr = (unsigned short *)buffer;
-    if (offset > 0) bufferPtr += offset;
+    unsigned char *bufferPtr = (unsigned char *)buffer;
+    if (offset > 0) bufferPtr += offset*((indexType == RL_UNSIGNED_INT)? sizeof(unsigned int) : sizeof(unsigned short));
 
-    glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)bufferPtr);
+    glDrawElements(GL_TRIANGLES, count, indexType, (const void *)bufferPtr);
 }
 
 // Draw vertex array instanced
@@ -3965,13 +4264,47 @@ void rlDrawVertexArrayInstanced(int offset, int count, int instances)
 
 // Draw vertex array elements instanced
 void rlDrawVertexArrayElementsInstanced(int offset, int count, const void *buffer, int instances)
+{
+    rlDrawVertexArrayElementsInstancedEx(offset, count, buffer, RL_UNSIGNED_SHORT, instances);
+}
+
+// Draw vertex array elements instanced with index type
+void rlDrawVertexArrayElementsInstancedEx(int offset, int count, const void *buffer, int indexType, int instances)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((indexType == RL_UNSIGNED_INT) && !RLGL.ExtSupported.elementIndexUint) return;
+
     // NOTE: Added pointer math separately from function to avoid UBSAN complaining
-    unsigned short *bufferPtr = (unsigned short *)buffer;
-    if (offset > 0) bufferPtr += offset;
+    unsigned char *bufferPtr = (unsigned char *)buffer;
+    if (offset > 0) bufferPtr += offset*((indexType == RL_UNSIGNED_INT)? sizeof(unsigned int) : sizeof(unsigned short));
 
-    glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)bufferPtr, instances);
+    glDrawElementsInstanced(GL_TRIANGLES, count, indexType, (const void *)bufferPtr, instances);
+#endif
+}
+
+// Draw vertex array with draw commands from buffer (multi-draw indirect)
+// NOTE: Buffer contains rlDrawArraysIndirectCommand items, offset is the first command to draw
+void rlDrawVertexArrayIndirect(unsigned int bufferId, int offset, int drawCount)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, bufferId);
+    glMultiDrawArraysIndirect(GL_TRIANGLES, (const void *)((size_t)offset*sizeof(rlDrawArraysIndirectCommand)), drawCount, 0);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+#else
+    TRACELOG(RL_LOG_WARNING, "GL: Multi-draw indirect not enabled. Define GRAPHICS_API_OPENGL_43");
+#endif
+}
+
+// Draw vertex array elements with draw commands from buffer (multi-draw indirect)
+// NOTE: Buffer contains rlDrawElementsIndirectCommand items, offset is the first command to draw
+void rlDrawVertexArrayElementsIndirect(unsigned int bufferId, int offset, int drawCount, int indexType)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, bufferId);
+    glMultiDrawElementsIndirect(GL_TRIANGLES, indexType, (const void *)((size_t)offset*sizeof(rlDrawElementsIndirectCommand)), drawCount, 0);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+#else
+    TRACELOG(RL_LOG_WARNING, "GL: Multi-draw indirect not enabled. Define GRAPHICS_API_OPENGL_43");
 #endif
 }
 
@@ -4039,7 +4372,7 @@ void rlUnloadVertexArray(unsigned int vaoId)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (RLGL.ExtSupported.vao)
     {
-        glBindVertexArray(0);
+        rlStateBindVertexArray(0);
         glDeleteVertexArrays(1, &vaoId);
         TRACELOG(RL_LOG_INFO, "VAO: [ID %i] Unloaded vertex array data from VRAM (GPU)", vaoId);
     }
@@ -4269,6 +4602,18 @@ void rlUnloadShaderProgram(unsigned int id)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glDeleteProgram(id);
 
+    // NOTE: A program deleted while in use stays bound until replaced, binding considered unknown
+    if (RLGL.State.activeShaderId == id) RLGL.State.activeShaderId = RL_STATE_UNKNOWN;
+
+    // Remove program uniform values from cache, program id could be reused by OpenGL
+    if (RLGL.State.uniformCache != NULL)
+    {
+        for (int i = 0; i < RL_MAX_UNIFORM_CACHE_ENTRIES; i++)
+        {
+            if (RLGL.State.uniformCache[i].shaderId == id) RLGL.State.uniformCache[i].shaderId = 0;
+        }
+    }
+
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Unloaded shader program data from VRAM (GPU)", id);
 #endif
 }
@@ -4303,6 +4648,28 @@ int rlGetLocationAttrib(unsigned int shaderId, const char *attribName)
 void rlSetUniform(int locIndex, const void *value, int uniformType, int count)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Get uniform value size to check uniforms cache
+    int size = 0;
+    switch (uniformType)
+    {
+        case RL_SHADER_UNIFORM_FLOAT:
+        case RL_SHADER_UNIFORM_INT:
+        case RL_SHADER_UNIFORM_UINT:
+        case RL_SHADER_UNIFORM_SAMPLER2D: size = 4*count; break;
+        case RL_SHADER_UNIFORM_VEC2:
+        case RL_SHADER_UNIFORM_IVEC2:
+        case RL_SHADER_UNIFORM_UIVEC2: size = 8*count; break;
+        case RL_SHADER_UNIFORM_VEC3:
+        case RL_SHADER_UNIFORM_IVEC3:
+        case RL_SHADER_UNIFORM_UIVEC3: size = 12*count; break;
+        case RL_SHADER_UNIFORM_VEC4:
+        case RL_SHADER_UNIFORM_IVEC4:
+        case RL_SHADER_UNIFORM_UIVEC4: size = 16*count; break;
+        default: break;
+    }
+
+    if ((size > 0) && !rlCheckUniformCache(locIndex, count, value, size)) return;
+
     switch (uniformType)
     {
         case RL_SHADER_UNIFORM_FLOAT: glUniform1fv(locIndex, count, (float *)value); break;
@@ -4346,19 +4713,19 @@ void rlSetVertexAttributeDefault(int locIndex, const void *value, int attribType
 void rlSetUniformMatrix(int locIndex, Matrix mat)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    float matfloat[16] = {
-        mat.m0, mat.m1, mat.m2, mat.m3,
-        mat.m4, mat.m5, mat.m6, mat.m7,
-        mat.m8, mat.m9, mat.m10, mat.m11,
-        mat.m12, mat.m13, mat.m14, mat.m15
-    };
-    glUniformMatrix4fv(locIndex, 1, false, matfloat);
+    rl_float16 matfloat = rlMatrixToFloatV(mat);
+
+    if (rlCheckUniformCache(locIndex, 1, matfloat.v, sizeof(matfloat.v))) glUniformMatrix4fv(locIndex, 1, false, matfloat.v);
 #endif
 }
 
 // Set shader value uniform matrix
 void rlSetUniformMatrices(int locIndex, const Matrix *matrices, int count)
 {
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: Matrices arrays are not cached (size 0), just registered as uploaded
+    rlCheckUniformCache(locIndex, count, matrices, 0);
+#endif
 #if defined(GRAPHICS_API_OPENGL_33)
     glUniformMatrix4fv(locIndex, count, true, (const float *)matrices);
 #elif defined(GRAPHICS_API_OPENGL_ES2)
@@ -4377,7 +4744,8 @@ void rlSetUniformSampler(int locIndex, unsigned int textureId)
     {
         if (RLGL.State.activeTextureId[i] == textureId)
         {
-            glUniform1i(locIndex, 1 + i);
+            int slot = 1 + i;
+            rlSetUniform(locIndex, &slot, RL_SHADER_UNIFORM_SAMPLER2D, 1);
             return;
         }
     }
@@ -4388,7 +4756,8 @@ void rlSetUniformSampler(int locIndex, unsigned int textureId)
     {
         if (RLGL.State.activeTextureId[i] == 0)
         {
-            glUniform1i(locIndex, 1 + i);              // Activate new texture unit
+            int slot = 1 + i;
+            rlSetUniform(locIndex, &slot, RL_SHADER_UNIFORM_SAMPLER2D, 1);    // Activate new texture unit
             RLGL.State.activeTextureId[i] = textureId; // Save texture id for binding on drawing
             break;
         }
@@ -4409,6 +4778,37 @@ void rlSetShader(unsigned int id, int *locs)
 #endif
 }
 
+// Reset uniform values cache
+// NOTE: Required if uniform values are set directly with OpenGL calls
+void rlResetUniformCache(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.uniformCache != NULL) memset(RLGL.State.uniformCache, 0, RL_MAX_UNIFORM_CACHE_ENTRIES*sizeof(rlUniformCacheEntry));
+    RLGL.State.normalMatrixReady = false;
+#endif
+}
+
+// Get uniform upload calls issued and skipped (value unchanged) since last reset
+void rlGetUniformCacheStats(unsigned int *issued, unsigned int *skipped)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (issued != NULL) *issued = RLGL.State.uniformCallsIssued;
+    if (skipped != NULL) *skipped = RLGL.State.uniformCallsSkipped;
+#else
+    if (issued != NULL) *issued = 0;
+    if (skipped != NULL) *skipped = 0;
+#endif
+}
+
+// Reset uniform upload calls counters
+void rlResetUniformCacheStats(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.uniformCallsIssued = 0;
+    RLGL.State.uniformCallsSkipped = 0;
+#endif
+}
+
 // Load compute shader program
 unsigned int rlLoadComputeShaderProgram(unsigned int shaderId)
 {
@@ -4704,7 +5104,7 @@ void rlLoadDrawQuad(void)
 
     // Gen VAO to contain VBO
     glGenVertexArrays(1, &quadVAO);
-    glBindVertexArray(quadVAO);
+    rlStateBindVertexArray(quadVAO);
 
     // Gen and fill vertex buffer (VBO)
     glGenBuffers(1, &quadVBO);
@@ -4718,9 +5118,9 @@ void rlLoadDrawQuad(void)
     glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, 2, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void *)(3*sizeof(float))); // Texcoords
 
     // Draw quad
-    glBindVertexArray(quadVAO);
+    rlStateBindVertexArray(quadVAO);
     glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-    glBindVertexArray(0);
+    rlStateBindVertexArray(0);
 
     // Delete buffers (VBO and VAO)
     glDeleteBuffers(1, &quadVBO);
@@ -4777,7 +5177,7 @@ void rlLoadDrawCube(void)
 
     // Gen VAO to contain VBO
     glGenVertexArrays(1, &cubeVAO);
-    glBindVertexArray(cubeVAO);
+    rlStateBindVertexArray(cubeVAO);
 
     // Gen and fill vertex buffer (VBO)
     glGenBuffers(1, &cubeVBO);
@@ -4785,7 +5185,7 @@ void rlLoadDrawCube(void)
     glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
     // Bind vertex attributes (position, normals, texcoords)
-    glBindVertexArray(cubeVAO);
+    rlStateBindVertexArray(cubeVAO);
     glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
     glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)0); // Positions
     glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
@@ -4793,12 +5193,12 @@ void rlLoadDrawCube(void)
     glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
     glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, 2, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)(6*sizeof(float))); // Texcoords
     glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    rlStateBindVertexArray(0);
 
     // Draw cube
-    glBindVertexArray(cubeVAO);
+    rlStateBindVertexArray(cubeVAO);
     glDrawArrays(GL_TRIANGLES, 0, 36);
-    glBindVertexArray(0);
+    rlStateBindVertexArray(0);
 
     // Delete VBO and VAO
     glDeleteBuffers(1, &cubeVBO);
@@ -4979,7 +5379,7 @@ static void rlLoadShaderDefault(void)
 // NOTE: Unloads: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
 static void rlUnloadShaderDefault(void)
 {
-    glUseProgram(0);
+    rlDisableShader();
 
     glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultVShaderId);
     glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultFShaderId);
@@ -4993,6 +5393,143 @@ static void rlUnloadShaderDefault(void)
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
 }
 
+// Check uniform value against uniforms cache for the shader program currently bound
+// NOTE: Returns true if value must be uploaded, cache is updated with the new value,
+// values bigger than cache entry size are never cached (use size = 0 to force upload),
+// arrays (count > 1) are never cached, their elements locations [locIndex, locIndex + count) are invalidated
+static bool rlCheckUniformCache(int locIndex, int count, const void *value, int size)
+{
+    // OpenGL silently ignores uploads to invalid locations, not counted as skipped by cache
+    if (locIndex < 0) return false;
+
+    bool upload = true;
+
+    if ((RLGL.State.uniformCache != NULL) && (RLGL.State.activeShaderId != 0) && (RLGL.State.activeShaderId != RL_STATE_UNKNOWN))
+    {
+        if (count > 1) size = 0;
+        else count = 1;
+
+        for (int k = 0; k < count; k++)
+        {
+            unsigned int hash = (RLGL.State.activeShaderId*2654435761u) ^ ((unsigned int)(locIndex + k)*40503u);
+            rlUniformCacheEntry *entry = NULL;
+            rlUniformCacheEntry *emptyEntry = NULL;
+
+            // Look for uniform entry in a small probing window, no tombstones required on removal
+            for (int i = 0; i < 8; i++)
+            {
+                rlUniformCacheEntry *current = &RLGL.State.uniformCache[(hash + i)&(RL_MAX_UNIFORM_CACHE_ENTRIES - 1)];
+
+                if ((current->shaderId == RLGL.State.activeShaderId) && (current->locIndex == (locIndex + k)))
+                {
+                    entry = current;
+                    break;
+                }
+                else if ((emptyEntry == NULL) && (current->shaderId == 0)) emptyEntry = current;
+            }
+
+            if ((size > 0) && (size <= (int)sizeof(entry->value)))
+            {
+                if (entry != NULL) upload = ((entry->size != size) || (memcmp(entry->value, value, size) != 0));
+                else entry = (emptyEntry != NULL)? emptyEntry : &RLGL.State.uniformCache[hash&(RL_MAX_UNIFORM_CACHE_ENTRIES - 1)];
+
+                if (upload)
+                {
+                    entry->shaderId = RLGL.State.activeShaderId;
+                    entry->locIndex = locIndex;
+                    entry->size = size;
+                    memcpy(entry->value, value, size);
+                }
+            }
+            else if (entry != NULL) entry->shaderId = 0;    // Value not cacheable, remove previous one
+        }
+    }
+
+    if (upload) RLGL.State.uniformCallsIssued++;
+    else RLGL.State.uniformCallsSkipped++;
+
+    return upload;
+}
+
+// Set active texture slot, redundant calls are filtered by state cache
+static void rlStateActiveTexture(unsigned int slot)
+{
+    if (RLGL.State.activeTextureSlot != slot)
+    {
+        glActiveTexture(GL_TEXTURE0 + slot);
+        RLGL.State.activeTextureSlot = slot;
+        RLGL.State.stateCallsIssued++;
+    }
+    else RLGL.State.stateCallsSkipped++;
+}
+
+// Bind vertex array object, redundant calls are filtered by state cache
+static void rlStateBindVertexArray(unsigned int vaoId)
+{
+    if (RLGL.State.activeVertexArrayId != vaoId)
+    {
+        glBindVertexArray(vaoId);
+        RLGL.State.activeVertexArrayId = vaoId;
+        RLGL.State.stateCallsIssued++;
+    }
+    else RLGL.State.stateCallsSkipped++;
+}
+
+// Enable/disable OpenGL capability, redundant calls are filtered by state cache
+static void rlStateEnable(unsigned int cap, unsigned int *current, bool enabled)
+{
+    if (*current != (unsigned int)enabled)
+    {
+        if (enabled) glEnable(cap);
+        else glDisable(cap);
+
+        *current = (unsigned int)enabled;
+        RLGL.State.stateCallsIssued++;
+    }
+    else RLGL.State.stateCallsSkipped++;
+}
+
+// Set blending factors and equations, redundant calls are filtered by state cache
+// NOTE: Separate functions are only used when RGB and alpha values differ
+static void rlStateBlend(unsigned int srcRGB, unsigned int dstRGB, unsigned int srcAlpha, unsigned int dstAlpha, unsigned int eqRGB, unsigned int eqAlpha)
+{
+    if ((RLGL.State.blendFactors[0] != srcRGB) || (RLGL.State.blendFactors[1] != dstRGB) ||
+        (RLGL.State.blendFactors[2] != srcAlpha) || (RLGL.State.blendFactors[3] != dstAlpha))
+    {
+        if ((srcRGB == srcAlpha) && (dstRGB == dstAlpha)) glBlendFunc(srcRGB, dstRGB);
+        else glBlendFuncSeparate(srcRGB, dstRGB, srcAlpha, dstAlpha);
+
+        RLGL.State.blendFactors[0] = srcRGB;
+        RLGL.State.blendFactors[1] = dstRGB;
+        RLGL.State.blendFactors[2] = srcAlpha;
+        RLGL.State.blendFactors[3] = dstAlpha;
+        RLGL.State.stateCallsIssued++;
+    }
+    else RLGL.State.stateCallsSkipped++;
+
+    if ((RLGL.State.blendEquations[0] != eqRGB) || (RLGL.State.blendEquations[1] != eqAlpha))
+    {
+        if (eqRGB == eqAlpha) glBlendEquation(eqRGB);
+        else glBlendEquationSeparate(eqRGB, eqAlpha);
+
+        RLGL.State.blendEquations[0] = eqRGB;
+        RLGL.State.blendEquations[1] = eqAlpha;
+        RLGL.State.stateCallsIssued++;
+    }
+    else RLGL.State.stateCallsSkipped++;
+}
+
+// Remove deleted texture from state cache bindings
+// NOTE: OpenGL reverts to texture 0 the bindings of a deleted texture
+static void rlStateRemoveTexture(unsigned int id)
+{
+    for (int i = 0; i < RL_MAX_STATE_CACHE_TEXTURE_SLOTS; i++)
+    {
+        if (RLGL.State.boundTexture2D[i] == id) RLGL.State.boundTexture2D[i] = 0;
+        if (RLGL.State.boundTextureCubemap[i] == id) RLGL.State.boundTextureCubemap[i] = 0;
+    }
+}
+
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 // Get compressed format official GL identifier name
 static const char *rlGetCompressedFormatName(int format)
@@ -5121,6 +5658,34 @@ static int rlGetPixelDataSize(int width, int height, int format)
     return dataSize;
 }
 
+// Bind texture to active texture slot, redundant calls are filtered by state cache
+// NOTE: State cache is only available for OpenGL 3.3+ and ES2, OpenGL 1.1 always binds
+static void rlStateBindTexture(unsigned int target, unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    unsigned int *bound = NULL;
+
+    if (RLGL.State.activeTextureSlot < RL_MAX_STATE_CACHE_TEXTURE_SLOTS)
+    {
+        if (target == GL_TEXTURE_2D) bound = &RLGL.State.boundTexture2D[RLGL.State.activeTextureSlot];
+        else if (target == GL_TEXTURE_CUBE_MAP) bound = &RLGL.State.boundTextureCubemap[RLGL.State.activeTextureSlot];
+    }
+
+    if ((bound != NULL) && (*bound == id))
+    {
+        RLGL.State.stateCallsSkipped++;
+        return;
+    }
+
+    glBindTexture(target, id);
+
+    if (bound != NULL) *bound = id;
+    RLGL.State.stateCallsIssued++;
+#else
+    glBindTexture(target, id);
+#endif
+}
+
 // Auxiliar math functions
 
 // Get float array of matrix data
@@ -12,7 +12,14 @@
 *       #define SUPPORT_FILEFORMAT_GLTF
 *       #define SUPPORT_FILEFORMAT_VOX
 *       #define SUPPORT_FILEFORMAT_M3D
+*       #define SUPPORT_FILEFORMAT_RMDL
 *           Selected desired fileformats to be supported for model data loading.
+*           NOTE: rMDL is raylib binary model format, exported with ExportModel()
+*
+*       #define SUPPORT_OBJ_VERTEX_WELDING
+*           Weld duplicated vertices of loaded OBJ meshes, indices are generated with GenMeshIndices()
+*           NOTE: Loaded OBJ meshes are indexed and vertices order changes, vertexCount is reduced
+*           NOTE: Meshes over 65535 vertices are not welded if 32-bit indices are not supported (OpenGL ES 2.0)
 *
 *       #define SUPPORT_MESH_GENERATION
 *           Support procedural mesh generation functions, uses external par_shapes.h library
@@ -51,6 +58,9 @@
 
 #include "utils.h"          // Required for: TRACELOG(), LoadFileData(), LoadFileText(), SaveFileText()
 #include "rlgl.h"           // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2
+#if defined(SUPPORT_RAYMATH_SIMD)
+    #define RAYMATH_SIMD
+#endif
 #include "raymath.h"        // Required for: Vector3, Quaternion and Matrix functionality
 
 #include <stdio.h>          // Required for: sprintf()
@@ -133,15 +143,85 @@
     #define MAX_MESH_VERTEX_BUFFERS  9    // Maximum vertex buffers (VBO) per mesh
 #endif
 
+#define INSTANCE_ATTRIB_LAST    INSTANCE_ATTRIB_CUSTOM1     // Last instance attribute flag supported
+
+#ifndef MESH_OPTIMIZE_CACHE_SIZE
+    #define MESH_OPTIMIZE_CACHE_SIZE      32    // Vertex cache size considered for mesh optimization
+#endif
+#ifndef MESH_OPTIMIZE_CLUSTER_SIZE
+    #define MESH_OPTIMIZE_CLUSTER_SIZE    64    // Minimum triangles per cluster for overdraw optimization
+#endif
+#ifndef MESH_SIMPLIFY_BORDER_WEIGHT
+    #define MESH_SIMPLIFY_BORDER_WEIGHT 10.0f   // Open borders quadrics weight for mesh simplification
+#endif
+#ifndef MESH_LOD_SCREEN_ERROR
+    #define MESH_LOD_SCREEN_ERROR    0.001f     // Maximum simplification error on screen (relative to screen height) for LOD selection
+#endif
+
+// rMDL binary model file format
+// NOTE: Data is stored little-endian, chunks and arrays are aligned to 16 bytes
+//   File header (16 bytes): "rMDL", version, chunks count, reserved
+//   Chunk header (16 bytes): chunk type (FourCC), reserved, chunk data size (64-bit)
+#define RMDL_FILE_VERSION        100
+#define RMDL_HEADER_SIZE          16
+#define RMDL_CHUNK_HEADER_SIZE    16
+#define RMDL_ALIGN(size)        (((size) + 15) & ~15)
+
+// rMDL mesh chunk attributes flags
+#define RMDL_MESH_VERTICES       0x0001
+#define RMDL_MESH_TEXCOORDS      0x0002
+#define RMDL_MESH_TEXCOORDS2     0x0004
+#define RMDL_MESH_NORMALS        0x0008
+#define RMDL_MESH_TANGENTS       0x0010
+#define RMDL_MESH_COLORS         0x0020
+#define RMDL_MESH_INDICES        0x0040
+#define RMDL_MESH_INDICES32      0x0080
+#define RMDL_MESH_BONEIDS        0x0100
+#define RMDL_MESH_BONEWEIGHTS    0x0200
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Mesh triangles cluster, used for overdraw optimization
+typedef struct MeshCluster {
+    int start;                  // Cluster first triangle
+    int count;                  // Cluster triangles count
+    float key;                  // Cluster sorting key
+} MeshCluster;
+
+// Mesh edge collapse, used for mesh simplification
+typedef struct MeshCollapse {
+    int source;                 // Collapsed position
+    int target;                 // Target position
+    float error;                // Collapse error
+} MeshCollapse;
+
+// Mesh with updated vertex positions buffer, its cached bounds could be outdated
+// NOTE: Mesh is identified by its positions buffer, UpdateMeshBuffer() receives mesh by value
+typedef struct MeshBoundsOutdated {
+    unsigned int vboId;         // Mesh vertex positions buffer id
+    BoundingBox bounds;         // Mesh bounds when positions buffer was updated
+} MeshBoundsOutdated;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// ...
+extern bool isGpuReady;
+static bool meshCulling = false;            // Mesh frustum culling enabled on DrawMesh()
+static int meshCullingTested = 0;           // Meshes/instances tested for culling since last reset
+static int meshCullingCulled = 0;           // Meshes/instances culled since last reset
+static MeshBoundsOutdated *meshBoundsOutdated = NULL; // Meshes with outdated bounds, not culled until bounds change
+static int meshBoundsOutdatedCount = 0;     // Meshes with outdated bounds count
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static Matrix matNormalModel = { 0 };       // Model matrix used to compute the cached normal matrix
+static Matrix matNormalCached = { 0 };      // Normal matrix cached: transpose(inverse(matNormalModel))
+static bool matNormalReady = false;         // Normal matrix cached flag
+
+static InstanceBuffer instanceBufferDefault = { 0 }; // Instance buffer used by DrawMeshInstanced(), grows as required
+#endif
+
+extern void UnloadInstanceBufferDefault(void);  // Unload DrawMeshInstanced() instance buffer (called on CloseWindow())
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
@@ -164,9 +244,47 @@ static Model LoadVOX(const char *filename);     // Load VOX mesh data
 static Model LoadM3D(const char *filename);     // Load M3D mesh data
 static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animCount);   // Load M3D animation data
 #endif
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+static Model LoadRMDL(const char *fileName);    // Load rMDL mesh data
+static ModelAnimation *LoadModelAnimationsRMDL(const char *fileName, int *animCount);  // Load rMDL animation data
+static int GetRMDLChunkSize(FileMapping mapping, long long offset);     // Get rMDL chunk data size at file offset, -1 if not valid
+static bool LoadRMDLData(const unsigned char *chunk, int chunkSize, int *chunkOffset, void *data, size_t dataSize); // Load data from rMDL chunk
+static void *LoadRMDLArray(const unsigned char *chunk, int chunkSize, int *chunkOffset, int count, int elementSize); // Load array from rMDL chunk (allocated)
+static void WriteRMDLHeader(unsigned char *fileData, int chunkCount);   // Write rMDL file header
+static void WriteRMDLChunkHeader(unsigned char *fileData, int offset, const char *type, int chunkSize); // Write rMDL chunk header
+static int WriteRMDLData(unsigned char *fileData, int offset, const void *data, int dataSize); // Write data into rMDL buffer, returns next aligned offset
+#endif
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
 static void ProcessMaterialsOBJ(Material *rayMaterials, tinyobj_material_t *materials, int materialCount);  // Process obj materials
 #endif
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static Matrix GetMatrixNormal(Matrix matModel); // Get normal matrix for model matrix (cached while model matrix does not change)
+static void DrawMeshInstancedCommon(Mesh mesh, Material material, InstanceBuffer buffer, int offset, int count, unsigned int commandsId); // Draw mesh instances from instance buffer
+static void SetInstanceBufferAttributes(InstanceBuffer buffer, Shader shader, int offset, bool enable); // Set instance buffer attributes for shader locations
+static int GetMeshVertexAttributeFormat(int attribute, int vertexFormat, int *compSize, int *type, bool *normalized); // Get mesh vertex attribute format, returns size per vertex
+static void SetMeshVertexAttribute(int location, int attribute, int vertexFormat); // Set mesh vertex attribute format for shader location
+static void *LoadMeshVertexDataCompact(const Mesh *mesh, int attribute, int vertexFormat); // Load mesh vertex attribute data in compact format (NULL if not required)
+static Vector4 GetMeshDequantize(Mesh mesh);    // Get mesh positions dequantization offset (xyz) and scale (w)
+#endif
+static int GetInstanceAttributeSize(unsigned int attribute); // Get instance attribute data size (per instance)
+static Frustum GetMatrixFrustum(Matrix mat);    // Get frustum planes from (model-)view-projection matrix
+static bool IsBoundingBoxValid(BoundingBox box); // Check if bounding box has been computed (zero box is not)
+static void SetMeshBoundsOutdated(Mesh mesh);   // Set mesh bounds as outdated, vertex positions buffer updated
+static bool IsMeshBoundsOutdated(Mesh mesh);    // Check if mesh bounds are outdated (not recomputed since positions update)
+static void RemoveMeshBoundsOutdated(unsigned int vboId); // Remove mesh from outdated bounds list
+static int GetMeshLodLevelEx(MeshLod lod, Matrix transform, Frustum frustum, Matrix matView, Matrix matProjection, bool cull); // Get mesh level of detail for transform
+static int GetInstanceAttributeOffset(InstanceBuffer buffer, unsigned int attribute); // Get instance attribute region offset in buffer
+static unsigned int GetMeshIndex(const Mesh *mesh, int index); // Get mesh vertex index (16-bit or 32-bit indices)
+static int OptimizeVertexCache(unsigned int *indices, int indexCount, int vertexCount, int *clusters); // Optimize triangles order for vertex cache, returns clusters count
+static void OptimizeOverdraw(unsigned int *indices, int indexCount, const float *vertices, const int *clusters, int clusterCount); // Optimize triangles clusters order to reduce overdraw
+static int CompareMeshClusters(const void *a, const void *b); // Compare mesh clusters for sorting (qsort)
+static void RemapMeshVertices(Mesh *mesh, const int *remap); // Remap mesh vertices data to new positions
+static void ReloadMeshBuffers(Mesh *mesh);      // Reload mesh vertex buffers in GPU (if uploaded)
+static int RemoveDegenerateTriangles(unsigned int *indices, int triangleCount, const int *positionIds); // Remove degenerate triangles, returns triangles count
+static int GetEdgeTrianglesCount(const unsigned int *indices, const int *positionIds, const int *adjacency, const int *adjacencyOffsets, int a, int b); // Get triangles sharing edge
+static void AddPlaneQuadric(float *quadric, Vector3 normal, float distance, float weight); // Add weighted plane to quadric
+static float GetQuadricError(const float *quadricA, const float *quadricB, Vector3 position); // Get position error for sum of quadrics
+static int CompareMeshCollapses(const void *a, const void *b); // Compare mesh collapses for sorting (qsort)
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -1106,6 +1224,9 @@ Model LoadModel(const char *fileName)
 #if defined(SUPPORT_FILEFORMAT_M3D)
     if (IsFileExtension(fileName, ".m3d")) model = LoadM3D(fileName);
 #endif
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+    if (IsFileExtension(fileName, ".rmdl")) model = LoadRMDL(fileName);
+#endif
 
     // Make sure model transform is set to identity matrix!
     model.transform = MatrixIdentity();
@@ -1176,7 +1297,7 @@ bool IsModelValid(Model model)
         if ((model.meshes[i].colors != NULL) && (model.meshes[i].vboId[3] == 0)) { result = false; break; }  // Vertex colors buffer not uploaded to GPU
         if ((model.meshes[i].tangents != NULL) && (model.meshes[i].vboId[4] == 0)) { result = false; break; }  // Vertex tangents buffer not uploaded to GPU
         if ((model.meshes[i].texcoords2 != NULL) && (model.meshes[i].vboId[5] == 0)) { result = false; break; }  // Vertex texcoords2 buffer not uploaded to GPU
-        if ((model.meshes[i].indices != NULL) && (model.meshes[i].vboId[6] == 0)) { result = false; break; }  // Vertex indices buffer not uploaded to GPU
+        if (((model.meshes[i].indices != NULL) || (model.meshes[i].indices32 != NULL)) && (model.meshes[i].vboId[6] == 0)) { result = false; break; }  // Vertex indices buffer not uploaded to GPU
         if ((model.meshes[i].boneIds != NULL) && (model.meshes[i].vboId[7] == 0)) { result = false; break; }  // Vertex boneIds buffer not uploaded to GPU
         if ((model.meshes[i].boneWeights != NULL) && (model.meshes[i].vboId[8] == 0)) { result = false; break; }  // Vertex boneWeights buffer not uploaded to GPU
 
@@ -1248,8 +1369,122 @@ BoundingBox GetModelBoundingBox(Model model)
     return bounds;
 }
 
+// Export model data to file (.rmdl), meshes, materials and skeleton
+// NOTE: rMDL is a binary format storing vertex data as GPU-ready arrays, loading requires no parsing
+bool ExportModel(Model model, const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+    if (IsFileExtension(fileName, ".rmdl"))
+    {
+        unsigned char *fileData = NULL;
+        int dataSize = 0;
+
+        // NOTE: Data is written in two passes, first one only computes the required data size
+        for (int pass = 0; pass < 2; pass++)
+        {
+            if (pass == 1) fileData = (unsigned char *)RL_CALLOC(dataSize, 1);
+
+            int offset = RMDL_HEADER_SIZE;
+            int chunkCount = 0;
+
+            // Model chunk: counts, meshes materials and skeleton
+            int chunkOffset = offset;
+            int modelInfo[4] = { model.meshCount, model.materialCount, model.boneCount, 0 };
+            offset = WriteRMDLData(fileData, offset + RMDL_CHUNK_HEADER_SIZE, modelInfo, sizeof(modelInfo));
+            offset = WriteRMDLData(fileData, offset, model.meshMaterial, model.meshCount*sizeof(int));
+            offset = WriteRMDLData(fileData, offset, model.bones, model.boneCount*sizeof(BoneInfo));
+            offset = WriteRMDLData(fileData, offset, model.bindPose, model.boneCount*sizeof(Transform));
+            WriteRMDLChunkHeader(fileData, chunkOffset, "MODL", offset - chunkOffset);
+            chunkCount++;
+
+            // Materials chunk: maps colors and values, material parameters
+            // NOTE: Shaders and textures are not exported, they are GPU resources
+            if (model.materialCount > 0)
+            {
+                chunkOffset = offset;
+                int materialsInfo[4] = { model.materialCount, MAX_MATERIAL_MAPS, 0, 0 };
+                offset = WriteRMDLData(fileData, offset + RMDL_CHUNK_HEADER_SIZE, materialsInfo, sizeof(materialsInfo));
+
+                for (int i = 0; i < model.materialCount; i++)
+                {
+                    unsigned char materialData[4*sizeof(float) + MAX_MATERIAL_MAPS*8] = { 0 };
+
+                    memcpy(materialData, model.materials[i].params, 4*sizeof(float));
+                    for (int m = 0; (m < MAX_MATERIAL_MAPS) && (model.materials[i].maps != NULL); m++)
+                    {
+                        memcpy(materialData + 4*sizeof(float) + m*8, &model.materials[i].maps[m].color, 4);
+                        memcpy(materialData + 4*sizeof(float) + m*8 + 4, &model.materials[i].maps[m].value, 4);
+                    }
+
+                    offset = WriteRMDLData(fileData, offset, materialData, sizeof(materialData));
+                }
+
+                WriteRMDLChunkHeader(fileData, chunkOffset, "MATL", offset - chunkOffset);
+                chunkCount++;
+            }
+
+            // Mesh chunks: one chunk per mesh, vertex attributes stored as independent arrays
+            for (int i = 0; i < model.meshCount; i++)
+            {
+                Mesh mesh = model.meshes[i];
+                int attributes = 0;
+
+                if (mesh.vertices != NULL) attributes |= RMDL_MESH_VERTICES;
+                if (mesh.texcoords != NULL) attributes |= RMDL_MESH_TEXCOORDS;
+                if (mesh.texcoords2 != NULL) attributes |= RMDL_MESH_TEXCOORDS2;
+                if (mesh.normals != NULL) attributes |= RMDL_MESH_NORMALS;
+                if (mesh.tangents != NULL) attributes |= RMDL_MESH_TANGENTS;
+                if (mesh.colors != NULL) attributes |= RMDL_MESH_COLORS;
+                if (mesh.indices != NULL) attributes |= RMDL_MESH_INDICES;
+                else if (mesh.indices32 != NULL) attributes |= RMDL_MESH_INDICES32;
+                if (mesh.boneIds != NULL) attributes |= RMDL_MESH_BONEIDS;
+                if (mesh.boneWeights != NULL) attributes |= RMDL_MESH_BONEWEIGHTS;
+
+                chunkOffset = offset;
+                int meshInfo[4] = { mesh.vertexCount, mesh.triangleCount, attributes, mesh.boneCount };
+                offset = WriteRMDLData(fileData, offset + RMDL_CHUNK_HEADER_SIZE, meshInfo, sizeof(meshInfo));
+                offset = WriteRMDLData(fileData, offset, &mesh.bounds, sizeof(BoundingBox));
+                offset = WriteRMDLData(fileData, offset, mesh.vertices, (mesh.vertices != NULL)? mesh.vertexCount*3*sizeof(float) : 0);
+                offset = WriteRMDLData(fileData, offset, mesh.texcoords, (mesh.texcoords != NULL)? mesh.vertexCount*2*sizeof(float) : 0);
+                offset = WriteRMDLData(fileData, offset, mesh.texcoords2, (mesh.texcoords2 != NULL)? mesh.vertexCount*2*sizeof(float) : 0);
+                offset = WriteRMDLData(fileData, offset, mesh.normals, (mesh.normals != NULL)? mesh.vertexCount*3*sizeof(float) : 0);
+                offset = WriteRMDLData(fileData, offset, mesh.tangents, (mesh.tangents != NULL)? mesh.vertexCount*4*sizeof(float) : 0);
+                offset = WriteRMDLData(fileData, offset, mesh.colors, (mesh.colors != NULL)? mesh.vertexCount*4*sizeof(unsigned char) : 0);
+                if (attributes & RMDL_MESH_INDICES) offset = WriteRMDLData(fileData, offset, mesh.indices, mesh.triangleCount*3*sizeof(unsigned short));
+                if (attributes & RMDL_MESH_INDICES32) offset = WriteRMDLData(fileData, offset, mesh.indices32, mesh.triangleCount*3*sizeof(unsigned int));
+                offset = WriteRMDLData(fileData, offset, mesh.boneIds, (mesh.boneIds != NULL)? mesh.vertexCount*4*sizeof(unsigned char) : 0);
+                offset = WriteRMDLData(fileData, offset, mesh.boneWeights, (mesh.boneWeights != NULL)? mesh.vertexCount*4*sizeof(float) : 0);
+                WriteRMDLChunkHeader(fileData, chunkOffset, "MESH", offset - chunkOffset);
+                chunkCount++;
+            }
+
+            WriteRMDLHeader(fileData, chunkCount);
+            dataSize = offset;
+        }
+
+        success = SaveFileData(fileName, fileData, dataSize);
+
+        RL_FREE(fileData);
+    }
+#endif
+
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Model exported successfully", fileName);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export model", fileName);
+
+    return success;
+}
+
 // Upload vertex data into a VAO (if supported) and VBO
 void UploadMesh(Mesh *mesh, bool dynamic)
+{
+    UploadMeshEx(mesh, dynamic, MESH_FORMAT_DEFAULT);
+}
+
+// Upload mesh vertex data into GPU using compact vertex format
+// NOTE: Mesh vertex data in RAM is not modified, UpdateMeshBuffer() data must match the GPU format
+void UploadMeshEx(Mesh *mesh, bool dynamic, int vertexFormat)
 {
     if (mesh->vaoId > 0)
     {
@@ -1259,6 +1494,12 @@ void UploadMesh(Mesh *mesh, bool dynamic)
     }
 
     mesh->vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VERTEX_BUFFERS, sizeof(unsigned int));
+    mesh->dynamic = dynamic;
+
+    // Compute mesh bounds, cached for culling
+    mesh->bounds = GetMeshBoundingBox(*mesh);
+    mesh->vertexFormat = MESH_FORMAT_DEFAULT;
+    mesh->dequantize = (Vector4){ 0.0f, 0.0f, 0.0f, 1.0f };
 
     mesh->vaoId = 0;        // Vertex Array Object
     mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION] = 0;     // Vertex buffer: positions
@@ -1275,6 +1516,42 @@ void UploadMesh(Mesh *mesh, bool dynamic)
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Check compact vertex formats supported by mesh data
+    // NOTE: Animated meshes update positions and normals from CPU as floats and
+    // GPU skinning transforms positions before model matrix, so they are not quantized
+    if ((mesh->animVertices != NULL) || (mesh->boneIds != NULL)) vertexFormat &= ~MESH_FORMAT_POSITION_INT16;
+    if (mesh->animNormals != NULL) vertexFormat &= ~MESH_FORMAT_NORMAL_INT8;
+    if (vertexFormat & MESH_FORMAT_TEXCOORD_UNORM16)
+    {
+        // Texture coordinates out of [0..1] range (tiling) can not be normalized
+        for (int i = 0; i < mesh->vertexCount*2; i++)
+        {
+            if (((mesh->texcoords != NULL) && ((mesh->texcoords[i] < 0.0f) || (mesh->texcoords[i] > 1.0f))) ||
+                ((mesh->texcoords2 != NULL) && ((mesh->texcoords2[i] < 0.0f) || (mesh->texcoords2[i] > 1.0f))))
+            {
+                vertexFormat &= ~MESH_FORMAT_TEXCOORD_UNORM16;
+                break;
+            }
+        }
+    }
+
+    mesh->vertexFormat = vertexFormat;
+
+    if (vertexFormat & MESH_FORMAT_POSITION_INT16)
+    {
+        // Quantized positions are relative to mesh bounds center, scaled by largest bounds half extent
+        // NOTE: Dequantization is kept on its own field, mesh bounds could be modified by user
+        Vector3 center = Vector3Scale(Vector3Add(mesh->bounds.min, mesh->bounds.max), 0.5f);
+        Vector3 extent = Vector3Scale(Vector3Subtract(mesh->bounds.max, mesh->bounds.min), 0.5f);
+        float scale = fmaxf(extent.x, fmaxf(extent.y, extent.z));
+
+        mesh->dequantize = (Vector4){ center.x, center.y, center.z, (scale > 0.0f)? scale : 1.0f };
+    }
+
+    // Vertex attributes data sizes, used for GPU memory report
+    int vertexSize = 0;
+    int vertexSizeFloat = 0;
+
     mesh->vaoId = rlLoadVertexArray();
     rlEnableVertexArray(mesh->vaoId);
 
@@ -1282,14 +1559,25 @@ void UploadMesh(Mesh *mesh, bool dynamic)
 
     // Enable vertex attributes: position (shader-location = 0)
     void *vertices = (mesh->animVertices != NULL)? mesh->animVertices : mesh->vertices;
-    mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION] = rlLoadVertexBuffer(vertices, mesh->vertexCount*3*sizeof(float), dynamic);
-    rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, 3, RL_FLOAT, 0, 0, 0);
+    void *data = LoadMeshVertexDataCompact(mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, vertexFormat);
+    int size = GetMeshVertexAttributeFormat(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, vertexFormat, NULL, NULL, NULL);
+    mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION] = rlLoadVertexBuffer((data != NULL)? data : vertices, mesh->vertexCount*size, dynamic);
+    RemoveMeshBoundsOutdated(mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION]);  // Buffer id could be reused
+    SetMeshVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, vertexFormat);
     rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
+    vertexSize += size;
+    vertexSizeFloat += 3*sizeof(float);
+    RL_FREE(data);
 
     // Enable vertex attributes: texcoords (shader-location = 1)
-    mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD] = rlLoadVertexBuffer(mesh->texcoords, mesh->vertexCount*2*sizeof(float), dynamic);
-    rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, 2, RL_FLOAT, 0, 0, 0);
+    data = LoadMeshVertexDataCompact(mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, vertexFormat);
+    size = GetMeshVertexAttributeFormat(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, vertexFormat, NULL, NULL, NULL);
+    mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD] = rlLoadVertexBuffer((data != NULL)? data : mesh->texcoords, mesh->vertexCount*size, dynamic);
+    SetMeshVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, vertexFormat);
     rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
+    vertexSize += size;
+    vertexSizeFloat += 2*sizeof(float);
+    RL_FREE(data);
 
     // WARNING: When setting default vertex attribute values, the values for each generic vertex attribute
     // is part of current state, and it is maintained even if a different program object is used
@@ -1298,9 +1586,14 @@ void UploadMesh(Mesh *mesh, bool dynamic)
     {
         // Enable vertex attributes: normals (shader-location = 2)
         void *normals = (mesh->animNormals != NULL)? mesh->animNormals : mesh->normals;
-        mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL] = rlLoadVertexBuffer(normals, mesh->vertexCount*3*sizeof(float), dynamic);
-        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, 3, RL_FLOAT, 0, 0, 0);
+        data = LoadMeshVertexDataCompact(mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, vertexFormat);
+        size = GetMeshVertexAttributeFormat(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, vertexFormat, NULL, NULL, NULL);
+        mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL] = rlLoadVertexBuffer((data != NULL)? data : normals, mesh->vertexCount*size, dynamic);
+        SetMeshVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, vertexFormat);
         rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
+        vertexSize += size;
+        vertexSizeFloat += 3*sizeof(float);
+        RL_FREE(data);
     }
     else
     {
@@ -1317,6 +1610,8 @@ void UploadMesh(Mesh *mesh, bool dynamic)
         mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR] = rlLoadVertexBuffer(mesh->colors, mesh->vertexCount*4*sizeof(unsigned char), dynamic);
         rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, 4, RL_UNSIGNED_BYTE, 1, 0, 0);
         rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
+        vertexSize += 4*sizeof(unsigned char);
+        vertexSizeFloat += 4*sizeof(unsigned char);
     }
     else
     {
@@ -1330,9 +1625,14 @@ void UploadMesh(Mesh *mesh, bool dynamic)
     if (mesh->tangents != NULL)
     {
         // Enable vertex attribute: tangent (shader-location = 4)
-        mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT] = rlLoadVertexBuffer(mesh->tangents, mesh->vertexCount*4*sizeof(float), dynamic);
-        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, 4, RL_FLOAT, 0, 0, 0);
+        data = LoadMeshVertexDataCompact(mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, vertexFormat);
+        size = GetMeshVertexAttributeFormat(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, vertexFormat, NULL, NULL, NULL);
+        mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT] = rlLoadVertexBuffer((data != NULL)? data : mesh->tangents, mesh->vertexCount*size, dynamic);
+        SetMeshVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, vertexFormat);
         rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT);
+        vertexSize += size;
+        vertexSizeFloat += 4*sizeof(float);
+        RL_FREE(data);
     }
     else
     {
@@ -1346,9 +1646,14 @@ void UploadMesh(Mesh *mesh, bool dynamic)
     if (mesh->texcoords2 != NULL)
     {
         // Enable vertex attribute: texcoord2 (shader-location = 5)
-        mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2] = rlLoadVertexBuffer(mesh->texcoords2, mesh->vertexCount*2*sizeof(float), dynamic);
-        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, 2, RL_FLOAT, 0, 0, 0);
+        data = LoadMeshVertexDataCompact(mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, vertexFormat);
+        size = GetMeshVertexAttributeFormat(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, vertexFormat, NULL, NULL, NULL);
+        mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2] = rlLoadVertexBuffer((data != NULL)? data : mesh->texcoords2, mesh->vertexCount*size, dynamic);
+        SetMeshVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, vertexFormat);
         rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2);
+        vertexSize += size;
+        vertexSizeFloat += 2*sizeof(float);
+        RL_FREE(data);
     }
     else
     {
@@ -1366,6 +1671,8 @@ void UploadMesh(Mesh *mesh, bool dynamic)
         mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS] = rlLoadVertexBuffer(mesh->boneIds, mesh->vertexCount*4*sizeof(unsigned char), dynamic);
         rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS, 4, RL_UNSIGNED_BYTE, 0, 0, 0);
         rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS);
+        vertexSize += 4*sizeof(unsigned char);
+        vertexSizeFloat += 4*sizeof(unsigned char);
     }
     else
     {
@@ -1379,9 +1686,14 @@ void UploadMesh(Mesh *mesh, bool dynamic)
     if (mesh->boneWeights != NULL)
     {
         // Enable vertex attribute: boneWeights (shader-location = 8)
-        mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS] = rlLoadVertexBuffer(mesh->boneWeights, mesh->vertexCount*4*sizeof(float), dynamic);
-        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS, 4, RL_FLOAT, 0, 0, 0);
+        data = LoadMeshVertexDataCompact(mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS, vertexFormat);
+        size = GetMeshVertexAttributeFormat(RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS, vertexFormat, NULL, NULL, NULL);
+        mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS] = rlLoadVertexBuffer((data != NULL)? data : mesh->boneWeights, mesh->vertexCount*size, dynamic);
+        SetMeshVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS, RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS, vertexFormat);
         rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS);
+        vertexSize += size;
+        vertexSizeFloat += 4*sizeof(float);
+        RL_FREE(data);
     }
     else
     {
@@ -1393,7 +1705,29 @@ void UploadMesh(Mesh *mesh, bool dynamic)
     }
 #endif
 
-    if (mesh->indices != NULL)
+    if ((mesh->indices32 != NULL) && !rlIsVertexBufferElementUintSupported())
+    {
+        // 32-bit indices require OpenGL ES2 extension GL_OES_element_index_uint,
+        // they are converted to 16-bit indices if all vertices are in range
+        if (mesh->vertexCount <= 65536)
+        {
+            RL_FREE(mesh->indices);
+            mesh->indices = (unsigned short *)RL_MALLOC(mesh->triangleCount*3*sizeof(unsigned short));
+            for (int i = 0; i < mesh->triangleCount*3; i++) mesh->indices[i] = (unsigned short)mesh->indices32[i];
+
+            RL_FREE(mesh->indices32);
+            mesh->indices32 = NULL;
+
+            TRACELOG(LOG_INFO, "VBO: Mesh 32-bit indices converted to 16-bit, 32-bit indices not supported");
+        }
+        else TRACELOG(LOG_WARNING, "VBO: Mesh 32-bit indices not supported (GL_OES_element_index_uint), mesh will not be drawn, use SplitMesh()");
+    }
+
+    if (mesh->indices32 != NULL)
+    {
+        mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES] = rlLoadVertexBufferElement(mesh->indices32, mesh->triangleCount*3*sizeof(unsigned int), dynamic);
+    }
+    else if (mesh->indices != NULL)
     {
         mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES] = rlLoadVertexBufferElement(mesh->indices, mesh->triangleCount*3*sizeof(unsigned short), dynamic);
     }
@@ -1401,6 +1735,12 @@ void UploadMesh(Mesh *mesh, bool dynamic)
     if (mesh->vaoId > 0) TRACELOG(LOG_INFO, "VAO: [ID %i] Mesh uploaded successfully to VRAM (GPU)", mesh->vaoId);
     else TRACELOG(LOG_INFO, "VBO: Mesh uploaded successfully to VRAM (GPU)");
 
+    if (vertexFormat != MESH_FORMAT_DEFAULT)
+    {
+        TRACELOG(LOG_INFO, "VBO: Mesh compact vertex format: %i bytes per vertex (%i bytes as float), %i KB saved",
+            vertexSize, vertexSizeFloat, (vertexSizeFloat - vertexSize)*mesh->vertexCount/1024);
+    }
+
     rlDisableVertexArray();
 #endif
 }
@@ -1409,11 +1749,32 @@ void UploadMesh(Mesh *mesh, bool dynamic)
 void UpdateMeshBuffer(Mesh mesh, int index, const void *data, int dataSize, int offset)
 {
     rlUpdateVertexBuffer(mesh.vboId[index], data, dataSize, offset);
+
+    // Vertex positions changed, cached bounds can not be used for culling until they are recomputed
+    if (index == RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION) SetMeshBoundsOutdated(mesh);
 }
 
 // Draw a 3d mesh with material and transform
 void DrawMesh(Mesh mesh, Material material, Matrix transform)
 {
+    // Check mesh bounds against current camera frustum (if mesh culling enabled)
+    // NOTE: Frustum planes are extracted from model-view-projection matrix, so they are in mesh local space
+    // and mesh bounds do not need to be transformed, stereo rendering is not culled
+    // NOTE: Animated meshes and meshes with updated vertex positions buffer are not culled, bounds could be outdated
+    if (meshCulling && IsBoundingBoxValid(mesh.bounds) && !rlIsStereoRenderEnabled() && (mesh.boneWeights == NULL) && !IsMeshBoundsOutdated(mesh))
+    {
+        Matrix matModelView = MatrixMultiply(MatrixMultiply(transform, rlGetMatrixTransform()), rlGetMatrixModelview());
+        Frustum frustum = GetMatrixFrustum(MatrixMultiply(matModelView, rlGetMatrixProjection()));
+
+        meshCullingTested++;
+
+        if (!CheckCollisionFrustumBox(frustum, mesh.bounds))
+        {
+            meshCullingCulled++;
+            return;
+        }
+    }
+
 #if defined(GRAPHICS_API_OPENGL_11)
     #define GL_VERTEX_ARRAY         0x8074
     #define GL_NORMAL_ARRAY         0x8075
@@ -1434,7 +1795,8 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
                    material.maps[MATERIAL_MAP_DIFFUSE].color.b,
                    material.maps[MATERIAL_MAP_DIFFUSE].color.a);
 
-        if (mesh.indices != NULL) rlDrawVertexArrayElements(0, mesh.triangleCount*3, mesh.indices);
+        if (mesh.indices32 != NULL) rlDrawVertexArrayElementsEx(0, mesh.triangleCount*3, mesh.indices32, RL_UNSIGNED_INT);
+        else if (mesh.indices != NULL) rlDrawVertexArrayElements(0, mesh.triangleCount*3, mesh.indices);
         else rlDrawVertexArray(0, mesh.vertexCount);
     rlPopMatrix();
 
@@ -1497,14 +1859,26 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
     //    rlGetMatrixTransform(): rlgl internal transform matrix due to push/pop matrix stack
     matModel = MatrixMultiply(transform, rlGetMatrixTransform());
 
+    // Quantized vertex positions are dequantized by shader (if location available) or by model matrix
+    // NOTE: Dequantization uses a uniform scale, normal matrix is not affected
+    Matrix matModelMesh = matModel;
+    Vector4 dequantize = GetMeshDequantize(mesh);
+
+    if (material.shader.locs[SHADER_LOC_VERTEX_DEQUANTIZE] != -1) rlSetUniform(material.shader.locs[SHADER_LOC_VERTEX_DEQUANTIZE], &dequantize, SHADER_UNIFORM_VEC4, 1);
+    else if (mesh.vertexFormat & MESH_FORMAT_POSITION_INT16)
+    {
+        matModelMesh = MatrixMultiply(MatrixMultiply(MatrixScale(dequantize.w, dequantize.w, dequantize.w),
+            MatrixTranslate(dequantize.x, dequantize.y, dequantize.z)), matModel);
+    }
+
     // Model transformation matrix is sent to shader uniform location: SHADER_LOC_MATRIX_MODEL
-    if (material.shader.locs[SHADER_LOC_MATRIX_MODEL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MODEL], matModel);
+    if (material.shader.locs[SHADER_LOC_MATRIX_MODEL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MODEL], matModelMesh);
 
     // Get model-view matrix
-    matModelView = MatrixMultiply(matModel, matView);
+    matModelView = MatrixMultiply(matModelMesh, matView);
 
     // Upload model normal matrix (if locations available)
-    if (material.shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_NORMAL], MatrixTranspose(MatrixInvert(matModel)));
+    if (material.shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_NORMAL], GetMatrixNormal(matModel));
 
 #ifdef RL_SUPPORT_MESH_GPU_SKINNING
     // Upload Bone Transforms
@@ -1541,19 +1915,19 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
     {
         // Bind mesh VBO data: vertex position (shader-location = 0)
         rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION]);
-        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_POSITION], 3, RL_FLOAT, 0, 0, 0);
+        SetMeshVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_POSITION], RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, mesh.vertexFormat);
         rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_POSITION]);
 
         // Bind mesh VBO data: vertex texcoords (shader-location = 1)
         rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD]);
-        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01], 2, RL_FLOAT, 0, 0, 0);
+        SetMeshVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01], RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, mesh.vertexFormat);
         rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01]);
 
         if (material.shader.locs[SHADER_LOC_VERTEX_NORMAL] != -1)
         {
             // Bind mesh VBO data: vertex normals (shader-location = 2)
             rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_NORMAL], 3, RL_FLOAT, 0, 0, 0);
+            SetMeshVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_NORMAL], RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, mesh.vertexFormat);
             rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_NORMAL]);
         }
 
@@ -1580,7 +1954,7 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
         if (material.shader.locs[SHADER_LOC_VERTEX_TANGENT] != -1)
         {
             rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TANGENT], 4, RL_FLOAT, 0, 0, 0);
+            SetMeshVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TANGENT], RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, mesh.vertexFormat);
             rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TANGENT]);
         }
 
@@ -1588,7 +1962,7 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
         if (material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02] != -1)
         {
             rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02], 2, RL_FLOAT, 0, 0, 0);
+            SetMeshVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02], RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, mesh.vertexFormat);
             rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02]);
         }
 
@@ -1605,12 +1979,12 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
         if (material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS] != -1)
         {
             rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS], 4, RL_FLOAT, 0, 0, 0);
+            SetMeshVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS], RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS, mesh.vertexFormat);
             rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS]);
         }
 #endif
 
-        if (mesh.indices != NULL) rlEnableVertexBufferElement(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES]);
+        if ((mesh.indices != NULL) || (mesh.indices32 != NULL)) rlEnableVertexBufferElement(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES]);
     }
 
     int eyeCount = 1;
@@ -1632,7 +2006,8 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
         rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MVP], matModelViewProjection);
 
         // Draw mesh
-        if (mesh.indices != NULL) rlDrawVertexArrayElements(0, mesh.triangleCount*3, 0);
+        if (mesh.indices32 != NULL) rlDrawVertexArrayElementsEx(0, mesh.triangleCount*3, 0, RL_UNSIGNED_INT);
+        else if (mesh.indices != NULL) rlDrawVertexArrayElements(0, mesh.triangleCount*3, 0);
         else rlDrawVertexArray(0, mesh.vertexCount);
     }
 
@@ -1652,6 +2027,8 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
         }
     }
 
+    rlActiveTextureSlot(0);     // Restore default texture slot
+
     // Disable all possible vertex array objects (or VBOs)
     rlDisableVertexArray();
     rlDisableVertexBuffer();
@@ -1667,13 +2044,222 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
 }
 
 // Draw multiple mesh instances with material and different transforms
+// NOTE: Transforms are uploaded to an internal instance buffer, reused between calls and only
+// reloaded when more capacity is required, use DrawMeshInstancedBuffer() for custom instance attributes
 void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, int instances)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Instancing required variables
-    float16 *instanceTransforms = NULL;
-    unsigned int instancesVboId = 0;
+    if ((transforms == NULL) || (instances <= 0)) return;
+
+    if (instanceBufferDefault.capacity < instances)
+    {
+        // Capacity is doubled to avoid reloading buffer on small instances count increments
+        int capacity = (instances > 2*instanceBufferDefault.capacity)? instances : 2*instanceBufferDefault.capacity;
+
+        UnloadInstanceBuffer(instanceBufferDefault);
+        instanceBufferDefault = LoadInstanceBuffer(capacity, INSTANCE_ATTRIB_TRANSFORM);
+    }
+
+    if (instanceBufferDefault.id > 0)
+    {
+        UpdateInstanceBufferTransforms(instanceBufferDefault, transforms, 0, instances);
+        DrawMeshInstancedBuffer(mesh, material, instanceBufferDefault, 0, instances);
+    }
+#endif
+}
+
+// Unload internal instance buffer used by DrawMeshInstanced()
+// NOTE: Called on CloseWindow(), buffer is loaded again on next DrawMeshInstanced()
+extern void UnloadInstanceBufferDefault(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    UnloadInstanceBuffer(instanceBufferDefault);
+    instanceBufferDefault = (InstanceBuffer){ 0 };
+#endif
+}
+
+// Draw multiple mesh instances with material and instances attributes from buffer
+void DrawMeshInstancedBuffer(Mesh mesh, Material material, InstanceBuffer buffer, int offset, int instances)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((offset < 0) || (instances <= 0) || ((offset + instances) > buffer.capacity)) return;
+
+    DrawMeshInstancedCommon(mesh, material, buffer, offset, instances, 0);
+#endif
+}
+
+// Draw multiple mesh instances with draw commands from GPU buffer (multi-draw indirect)
+// NOTE: Commands buffer (i.e. SSBO written by compute shader) contains commandCount items of 5 unsigned int:
+// { count, instanceCount, firstIndex, baseVertex, baseInstance }, for non-indexed meshes 4 unsigned int:
+// { count, instanceCount, first, baseInstance }, baseInstance selects the buffer instances used
+void DrawMeshInstancedIndirect(Mesh mesh, Material material, InstanceBuffer buffer, unsigned int commandsId, int commandCount)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    if ((commandsId == 0) || (commandCount <= 0)) return;
+
+    DrawMeshInstancedCommon(mesh, material, buffer, 0, commandCount, commandsId);
+#else
+    TRACELOG(LOG_WARNING, "MESH: Multi-draw indirect not enabled. Define GRAPHICS_API_OPENGL_43");
+#endif
+}
+
+// Draw mesh level of detail for transform, culled if not visible
+void DrawMeshLod(MeshLod lod, Material material, Matrix transform)
+{
+    int level = GetMeshLodLevel(lod, transform);
+
+    if (level >= 0)
+    {
+        // Mesh already culled, avoid testing it again
+        bool culling = meshCulling;
+        meshCulling = false;
+        DrawMesh(lod.meshes[level], material, transform);
+        meshCulling = culling;
+    }
+}
 
+// Draw mesh levels of detail for multiple instances, culled if not visible
+// NOTE: Visible instances are grouped by level of detail, one instanced draw call per level
+int DrawMeshLodInstanced(MeshLod lod, Material material, const Matrix *transforms, int instances)
+{
+    int drawCount = 0;
+
+    if ((lod.levelCount <= 0) || (transforms == NULL) || (instances <= 0)) return drawCount;
+
+    Matrix matView = MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview());
+    Matrix matProjection = rlGetMatrixProjection();
+    Frustum frustum = GetMatrixFrustum(MatrixMultiply(matView, matProjection));
+    bool cull = !rlIsStereoRenderEnabled();
+
+    int *levels = (int *)RL_MALLOC(instances*sizeof(int));
+    int *levelCounts = (int *)RL_CALLOC(lod.levelCount*2, sizeof(int));
+    int *levelOffsets = levelCounts + lod.levelCount;
+
+    // Cull instances and select level of detail
+    for (int i = 0; i < instances; i++)
+    {
+        levels[i] = GetMeshLodLevelEx(lod, transforms[i], frustum, matView, matProjection, cull);
+        if (levels[i] >= 0)
+        {
+            levelCounts[levels[i]]++;
+            drawCount++;
+        }
+    }
+
+    if (drawCount > 0)
+    {
+        Matrix *visibleTransforms = (Matrix *)RL_MALLOC(drawCount*sizeof(Matrix));
+
+        for (int i = 1; i < lod.levelCount; i++) levelOffsets[i] = levelOffsets[i - 1] + levelCounts[i - 1];
+
+        // Group visible instances transforms by level
+        for (int i = 0; i < instances; i++)
+        {
+            if (levels[i] >= 0) visibleTransforms[levelOffsets[levels[i]]++] = transforms[i];
+        }
+
+        for (int i = 0, offset = 0; i < lod.levelCount; i++)
+        {
+            if (levelCounts[i] > 0) DrawMeshInstanced(lod.meshes[i], material, visibleTransforms + offset, levelCounts[i]);
+            offset += levelCounts[i];
+        }
+
+        RL_FREE(visibleTransforms);
+    }
+
+    RL_FREE(levelCounts);
+    RL_FREE(levels);
+
+    return drawCount;
+}
+
+// Load mesh levels of detail (meshes from most to least detailed)
+// NOTE: Screen sizes must be decreasing, level selected is the first one with screen size lower than
+// bounds sphere projected diameter relative to screen height, smaller instances are culled
+MeshLod LoadMeshLod(const Mesh *meshes, const float *screenSizes, int levelCount)
+{
+    MeshLod lod = { 0 };
+
+    if ((meshes == NULL) || (levelCount <= 0)) return lod;
+
+    lod.levelCount = levelCount;
+    lod.meshes = (Mesh *)RL_MALLOC(levelCount*sizeof(Mesh));
+    lod.screenSizes = (float *)RL_CALLOC(levelCount, sizeof(float));
+
+    memcpy(lod.meshes, meshes, levelCount*sizeof(Mesh));
+    if (screenSizes != NULL) memcpy(lod.screenSizes, screenSizes, levelCount*sizeof(float));
+
+    // Compute bounds containing all levels
+    lod.bounds = GetMeshBoundingBox(meshes[0]);
+    for (int i = 1; i < levelCount; i++)
+    {
+        BoundingBox bounds = GetMeshBoundingBox(meshes[i]);
+        lod.bounds.min = Vector3Min(lod.bounds.min, bounds.min);
+        lod.bounds.max = Vector3Max(lod.bounds.max, bounds.max);
+    }
+
+    return lod;
+}
+
+// Unload mesh levels of detail (meshes not unloaded)
+void UnloadMeshLod(MeshLod lod)
+{
+    RL_FREE(lod.meshes);
+    RL_FREE(lod.screenSizes);
+}
+
+// Get mesh level of detail for transform, returns -1 if culled
+// NOTE: Current camera (BeginMode3D()) is considered
+int GetMeshLodLevel(MeshLod lod, Matrix transform)
+{
+    if (lod.levelCount <= 0) return -1;
+
+    Matrix matView = MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview());
+    Matrix matProjection = rlGetMatrixProjection();
+    Frustum frustum = GetMatrixFrustum(MatrixMultiply(matView, matProjection));
+
+    return GetMeshLodLevelEx(lod, transform, frustum, matView, matProjection, !rlIsStereoRenderEnabled());
+}
+
+// Get current camera view frustum (world space)
+// NOTE: BeginMode3D() required to get current camera view and projection matrices
+Frustum GetCameraFrustum(void)
+{
+    return GetMatrixFrustum(MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection()));
+}
+
+// Enable mesh frustum culling on DrawMesh()
+// NOTE: Mesh bounds do not consider animation, animated meshes could be culled when visible
+void EnableMeshCulling(void)
+{
+    meshCulling = true;
+}
+
+// Disable mesh frustum culling on DrawMesh()
+void DisableMeshCulling(void)
+{
+    meshCulling = false;
+}
+
+// Get meshes/instances tested and culled since last reset
+void GetMeshCullingStats(int *tested, int *culled)
+{
+    if (tested != NULL) *tested = meshCullingTested;
+    if (culled != NULL) *culled = meshCullingCulled;
+}
+
+// Reset meshes/instances culling counters
+void ResetMeshCullingStats(void)
+{
+    meshCullingTested = 0;
+    meshCullingCulled = 0;
+}
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Draw multiple mesh instances, using instances attributes from buffer
+// NOTE: If commandsId is provided, draw commands are read from GPU buffer and count is the number of commands
+static void DrawMeshInstancedCommon(Mesh mesh, Material material, InstanceBuffer buffer, int offset, int count, unsigned int commandsId)
+{
     // Bind shader program
     rlEnableShader(material.shader.id);
 
@@ -1719,38 +2305,27 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
     if (material.shader.locs[SHADER_LOC_MATRIX_VIEW] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_VIEW], matView);
     if (material.shader.locs[SHADER_LOC_MATRIX_PROJECTION] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_PROJECTION], matProjection);
 
-    // Create instances buffer
-    instanceTransforms = (float16 *)RL_MALLOC(instances*sizeof(float16));
-
-    // Fill buffer with instances transformations as float16 arrays
-    for (int i = 0; i < instances; i++) instanceTransforms[i] = MatrixToFloatV(transforms[i]);
-
-    // Enable mesh VAO to attach new buffer
-    rlEnableVertexArray(mesh.vaoId);
-
-    // This could alternatively use a static VBO and either glMapBuffer() or glBufferSubData()
-    // It isn't clear which would be reliably faster in all cases and on all platforms,
-    // anecdotally glMapBuffer() seems very slow (syncs) while glBufferSubData() seems
-    // no faster, since we're transferring all the transform matrices anyway
-    instancesVboId = rlLoadVertexBuffer(instanceTransforms, instances*sizeof(float16), false);
+    // Accumulate internal matrix transform (push/pop) and view matrix
+    // NOTE: In this case, model instance transformation must be computed in the shader
+    matModelView = MatrixMultiply(rlGetMatrixTransform(), matView);
 
-    // Instances transformation matrices are send to shader attribute location: SHADER_LOC_MATRIX_MODEL
-    for (unsigned int i = 0; i < 4; i++)
+    // Quantized vertex positions must be dequantized by shader, before instance transformation
+    if (material.shader.locs[SHADER_LOC_VERTEX_DEQUANTIZE] != -1)
     {
-        rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i);
-        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i, 4, RL_FLOAT, 0, sizeof(Matrix), i*sizeof(Vector4));
-        rlSetVertexAttributeDivisor(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i, 1);
+        Vector4 dequantize = GetMeshDequantize(mesh);
+        rlSetUniform(material.shader.locs[SHADER_LOC_VERTEX_DEQUANTIZE], &dequantize, SHADER_UNIFORM_VEC4, 1);
     }
+    else if (mesh.vertexFormat & MESH_FORMAT_POSITION_INT16)
+    {
+        // NOTE: Warning only logged once, instanced meshes are usually drawn every frame
+        static bool dequantizeWarning = false;
 
-    rlDisableVertexBuffer();
-    rlDisableVertexArray();
-
-    // Accumulate internal matrix transform (push/pop) and view matrix
-    // NOTE: In this case, model instance transformation must be computed in the shader
-    matModelView = MatrixMultiply(rlGetMatrixTransform(), matView);
+        if (!dequantizeWarning) TRACELOG(LOG_WARNING, "MESH: Quantized positions require shader uniform: vertexDequantize");
+        dequantizeWarning = true;
+    }
 
     // Upload model normal matrix (if locations available)
-    if (material.shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_NORMAL], MatrixTranspose(MatrixInvert(matModel)));
+    if (material.shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_NORMAL], GetMatrixNormal(matModel));
 
 #ifdef RL_SUPPORT_MESH_GPU_SKINNING
     // Upload Bone Transforms
@@ -1786,19 +2361,19 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
     {
         // Bind mesh VBO data: vertex position (shader-location = 0)
         rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION]);
-        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_POSITION], 3, RL_FLOAT, 0, 0, 0);
+        SetMeshVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_POSITION], RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, mesh.vertexFormat);
         rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_POSITION]);
 
         // Bind mesh VBO data: vertex texcoords (shader-location = 1)
         rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD]);
-        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01], 2, RL_FLOAT, 0, 0, 0);
+        SetMeshVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01], RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, mesh.vertexFormat);
         rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01]);
 
         if (material.shader.locs[SHADER_LOC_VERTEX_NORMAL] != -1)
         {
             // Bind mesh VBO data: vertex normals (shader-location = 2)
             rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_NORMAL], 3, RL_FLOAT, 0, 0, 0);
+            SetMeshVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_NORMAL], RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, mesh.vertexFormat);
             rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_NORMAL]);
         }
 
@@ -1825,7 +2400,7 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
         if (material.shader.locs[SHADER_LOC_VERTEX_TANGENT] != -1)
         {
             rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TANGENT], 4, RL_FLOAT, 0, 0, 0);
+            SetMeshVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TANGENT], RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, mesh.vertexFormat);
             rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TANGENT]);
         }
 
@@ -1833,7 +2408,7 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
         if (material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02] != -1)
         {
             rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02], 2, RL_FLOAT, 0, 0, 0);
+            SetMeshVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02], RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, mesh.vertexFormat);
             rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02]);
         }
 
@@ -1850,14 +2425,17 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
         if (material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS] != -1)
         {
             rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS], 4, RL_FLOAT, 0, 0, 0);
+            SetMeshVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS], RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS, mesh.vertexFormat);
             rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS]);
         }
 #endif
 
-        if (mesh.indices != NULL) rlEnableVertexBufferElement(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES]);
+        if ((mesh.indices != NULL) || (mesh.indices32 != NULL)) rlEnableVertexBufferElement(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES]);
     }
 
+    // Bind instances attributes, starting at required instance
+    SetInstanceBufferAttributes(buffer, material.shader, offset, true);
+
     int eyeCount = 1;
     if (rlIsStereoRenderEnabled()) eyeCount = 2;
 
@@ -1877,10 +2455,23 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
         rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MVP], matModelViewProjection);
 
         // Draw mesh instanced
-        if (mesh.indices != NULL) rlDrawVertexArrayElementsInstanced(0, mesh.triangleCount*3, 0, instances);
-        else rlDrawVertexArrayInstanced(0, mesh.vertexCount, instances);
+        if (commandsId > 0)
+        {
+            if (mesh.indices32 != NULL) rlDrawVertexArrayElementsIndirect(commandsId, 0, count, RL_UNSIGNED_INT);
+            else if (mesh.indices != NULL) rlDrawVertexArrayElementsIndirect(commandsId, 0, count, RL_UNSIGNED_SHORT);
+            else rlDrawVertexArrayIndirect(commandsId, 0, count);
+        }
+        else
+        {
+            if (mesh.indices32 != NULL) rlDrawVertexArrayElementsInstancedEx(0, mesh.triangleCount*3, 0, RL_UNSIGNED_INT, count);
+            else if (mesh.indices != NULL) rlDrawVertexArrayElementsInstanced(0, mesh.triangleCount*3, 0, count);
+            else rlDrawVertexArrayInstanced(0, mesh.vertexCount, count);
+        }
     }
 
+    // Unbind instances attributes, mesh could be drawn later without instancing
+    SetInstanceBufferAttributes(buffer, material.shader, offset, false);
+
     // Unbind all bound texture maps
     for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
     {
@@ -1897,6 +2488,8 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
         }
     }
 
+    rlActiveTextureSlot(0);     // Restore default texture slot
+
     // Disable all possible vertex array objects (or VBOs)
     rlDisableVertexArray();
     rlDisableVertexBuffer();
@@ -1904,57 +2497,178 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
 
     // Disable shader program
     rlDisableShader();
-
-    // Remove instance transforms buffer
-    rlUnloadVertexBuffer(instancesVboId);
-    RL_FREE(instanceTransforms);
-#endif
 }
+#endif
 
-// Unload mesh from memory (RAM and VRAM)
-void UnloadMesh(Mesh mesh)
+// Load instance buffer in GPU for a number of instances with attributes (InstanceAttribute flags)
+InstanceBuffer LoadInstanceBuffer(int capacity, unsigned int attributes)
 {
-    // Unload rlgl mesh vboId data
-    rlUnloadVertexArray(mesh.vaoId);
+    InstanceBuffer buffer = { 0 };
 
-    if (mesh.vboId != NULL) for (int i = 0; i < MAX_MESH_VERTEX_BUFFERS; i++) rlUnloadVertexBuffer(mesh.vboId[i]);
-    RL_FREE(mesh.vboId);
+    attributes &= (INSTANCE_ATTRIB_LAST << 1) - 1;
 
-    RL_FREE(mesh.vertices);
-    RL_FREE(mesh.texcoords);
-    RL_FREE(mesh.normals);
-    RL_FREE(mesh.colors);
-    RL_FREE(mesh.tangents);
-    RL_FREE(mesh.texcoords2);
-    RL_FREE(mesh.indices);
+    if ((capacity <= 0) || (attributes == 0))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Failed to load instance buffer, invalid capacity or attributes");
+        return buffer;
+    }
 
-    RL_FREE(mesh.animVertices);
-    RL_FREE(mesh.animNormals);
-    RL_FREE(mesh.boneWeights);
-    RL_FREE(mesh.boneIds);
-    RL_FREE(mesh.boneMatrices);
-}
+    int size = 0;
+    for (unsigned int attrib = INSTANCE_ATTRIB_TRANSFORM; attrib <= INSTANCE_ATTRIB_LAST; attrib <<= 1)
+    {
+        if (attributes & attrib) size += capacity*GetInstanceAttributeSize(attrib);
+    }
 
-// Export mesh data to file
-bool ExportMesh(Mesh mesh, const char *fileName)
-{
-    bool success = false;
+    // NOTE: Buffer data is not initialized, it must be filled with UpdateInstanceBuffer()
+    buffer.id = rlLoadVertexBuffer(NULL, size, true);
+    rlDisableVertexBuffer();
 
-    if (IsFileExtension(fileName, ".obj"))
+    if (buffer.id > 0)
     {
-        // Estimated data size, it should be enough...
-        int dataSize = mesh.vertexCount*(int)strlen("v 0000.00f 0000.00f 0000.00f") +
-                       mesh.vertexCount*(int)strlen("vt 0.000f 0.00f") +
-                       mesh.vertexCount*(int)strlen("vn 0.000f 0.00f 0.00f") +
-                       mesh.triangleCount*(int)strlen("f 00000/00000/00000 00000/00000/00000 00000/00000/00000");
+        buffer.capacity = capacity;
+        buffer.attributes = attributes;
 
-        // NOTE: Text data buffer size is estimated considering mesh data size
-        char *txtData = (char *)RL_CALLOC(dataSize*2 + 2000, sizeof(char));
+        TRACELOG(LOG_DEBUG, "VBO: [ID %i] Instance buffer loaded successfully (%i instances, %i bytes)", buffer.id, capacity, size);
+    }
+    else TRACELOG(LOG_WARNING, "VBO: Failed to load instance buffer");
 
-        int byteCount = 0;
-        byteCount += sprintf(txtData + byteCount, "# //////////////////////////////////////////////////////////////////////////////////\n");
-        byteCount += sprintf(txtData + byteCount, "# //                                                                              //\n");
-        byteCount += sprintf(txtData + byteCount, "# // rMeshOBJ exporter v1.0 - Mesh exported as triangle faces and not optimized   //\n");
+    return buffer;
+}
+
+// Check if an instance buffer is valid (loaded in GPU)
+bool IsInstanceBufferValid(InstanceBuffer buffer)
+{
+    return ((buffer.id > 0) && (buffer.capacity > 0) && (buffer.attributes > 0));
+}
+
+// Unload instance buffer from GPU memory (VRAM)
+void UnloadInstanceBuffer(InstanceBuffer buffer)
+{
+    if (buffer.id > 0) rlUnloadVertexBuffer(buffer.id);
+}
+
+// Update instance buffer attribute data for a range of instances
+// NOTE: Only the attribute region range is uploaded, other attributes and instances are not modified
+void UpdateInstanceBuffer(InstanceBuffer buffer, int attribute, const void *data, int offset, int count)
+{
+    if ((buffer.id == 0) || (data == NULL)) return;
+
+    if (((buffer.attributes & attribute) == 0) || ((attribute & (attribute - 1)) != 0))
+    {
+        TRACELOG(LOG_WARNING, "VBO: [ID %i] Instance buffer attribute not available for update", buffer.id);
+        return;
+    }
+
+    if ((offset < 0) || (count <= 0) || ((offset + count) > buffer.capacity))
+    {
+        TRACELOG(LOG_WARNING, "VBO: [ID %i] Instance buffer update out of bounds", buffer.id);
+        return;
+    }
+
+    int size = GetInstanceAttributeSize(attribute);
+    rlUpdateVertexBuffer(buffer.id, data, count*size, GetInstanceAttributeOffset(buffer, attribute) + offset*size);
+}
+
+// Update instance buffer transforms for a range of instances (quantized if required)
+// NOTE: Quantized transforms only support uniform scale, scale is computed from first matrix column
+void UpdateInstanceBufferTransforms(InstanceBuffer buffer, const Matrix *transforms, int offset, int count)
+{
+    if ((transforms == NULL) || (count <= 0)) return;
+
+    if (buffer.attributes & INSTANCE_ATTRIB_TRANSFORM)
+    {
+        float16 *data = (float16 *)RL_MALLOC(count*sizeof(float16));
+
+        // Fill buffer with instances transformations as float16 arrays
+        for (int i = 0; i < count; i++) data[i] = MatrixToFloatV(transforms[i]);
+
+        UpdateInstanceBuffer(buffer, INSTANCE_ATTRIB_TRANSFORM, data, offset, count);
+        RL_FREE(data);
+    }
+
+    if (buffer.attributes & INSTANCE_ATTRIB_TRANSFORM_QUANTIZED)
+    {
+        int size = GetInstanceAttributeSize(INSTANCE_ATTRIB_TRANSFORM_QUANTIZED);
+        unsigned char *data = (unsigned char *)RL_MALLOC(count*size);
+
+        for (int i = 0; i < count; i++)
+        {
+            Matrix mat = transforms[i];
+            float scale = sqrtf(mat.m0*mat.m0 + mat.m1*mat.m1 + mat.m2*mat.m2);
+            float position[4] = { mat.m12, mat.m13, mat.m14, scale };
+
+            // Remove scale from rotation matrix, translation is not considered
+            if (scale > 0.0f)
+            {
+                float invScale = 1.0f/scale;
+                mat.m0 *= invScale; mat.m1 *= invScale; mat.m2 *= invScale;
+                mat.m4 *= invScale; mat.m5 *= invScale; mat.m6 *= invScale;
+                mat.m8 *= invScale; mat.m9 *= invScale; mat.m10 *= invScale;
+            }
+
+            Quaternion q = QuaternionNormalize(QuaternionFromMatrix(mat));
+            short rotation[4] = {
+                (short)roundf(Clamp(q.x, -1.0f, 1.0f)*32767.0f),
+                (short)roundf(Clamp(q.y, -1.0f, 1.0f)*32767.0f),
+                (short)roundf(Clamp(q.z, -1.0f, 1.0f)*32767.0f),
+                (short)roundf(Clamp(q.w, -1.0f, 1.0f)*32767.0f)
+            };
+
+            memcpy(data + i*size, position, sizeof(position));
+            memcpy(data + i*size + sizeof(position), rotation, sizeof(rotation));
+        }
+
+        UpdateInstanceBuffer(buffer, INSTANCE_ATTRIB_TRANSFORM_QUANTIZED, data, offset, count);
+        RL_FREE(data);
+    }
+}
+
+// Unload mesh from memory (RAM and VRAM)
+void UnloadMesh(Mesh mesh)
+{
+    // Unload rlgl mesh vboId data
+    rlUnloadVertexArray(mesh.vaoId);
+
+    if (mesh.vboId != NULL) RemoveMeshBoundsOutdated(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION]);
+    if (mesh.vboId != NULL) for (int i = 0; i < MAX_MESH_VERTEX_BUFFERS; i++) rlUnloadVertexBuffer(mesh.vboId[i]);
+    RL_FREE(mesh.vboId);
+
+    RL_FREE(mesh.vertices);
+    RL_FREE(mesh.texcoords);
+    RL_FREE(mesh.normals);
+    RL_FREE(mesh.colors);
+    RL_FREE(mesh.tangents);
+    RL_FREE(mesh.texcoords2);
+    RL_FREE(mesh.indices);
+    RL_FREE(mesh.indices32);
+
+    RL_FREE(mesh.animVertices);
+    RL_FREE(mesh.animNormals);
+    RL_FREE(mesh.boneWeights);
+    RL_FREE(mesh.boneIds);
+    RL_FREE(mesh.boneMatrices);
+}
+
+// Export mesh data to file
+bool ExportMesh(Mesh mesh, const char *fileName)
+{
+    bool success = false;
+
+    if (IsFileExtension(fileName, ".obj"))
+    {
+        // Estimated data size, it should be enough...
+        int dataSize = mesh.vertexCount*(int)strlen("v 0000.00f 0000.00f 0000.00f") +
+                       mesh.vertexCount*(int)strlen("vt 0.000f 0.00f") +
+                       mesh.vertexCount*(int)strlen("vn 0.000f 0.00f 0.00f") +
+                       mesh.triangleCount*(int)strlen("f 00000/00000/00000 00000/00000/00000 00000/00000/00000");
+
+        // NOTE: Text data buffer size is estimated considering mesh data size
+        char *txtData = (char *)RL_CALLOC(dataSize*2 + 2000, sizeof(char));
+
+        int byteCount = 0;
+        byteCount += sprintf(txtData + byteCount, "# //////////////////////////////////////////////////////////////////////////////////\n");
+        byteCount += sprintf(txtData + byteCount, "# //                                                                              //\n");
+        byteCount += sprintf(txtData + byteCount, "# // rMeshOBJ exporter v1.0 - Mesh exported as triangle faces and not optimized   //\n");
         byteCount += sprintf(txtData + byteCount, "# //                                                                              //\n");
         byteCount += sprintf(txtData + byteCount, "# // more info and bugs-report:  github.com/raysan5/raylib                        //\n");
         byteCount += sprintf(txtData + byteCount, "# // feedback and support:       ray[at]raylib.com                                //\n");
@@ -1982,14 +2696,15 @@ bool ExportMesh(Mesh mesh, const char *fileName)
             byteCount += sprintf(txtData + byteCount, "vn %.3f %.3f %.3f\n", mesh.normals[v], mesh.normals[v + 1], mesh.normals[v + 2]);
         }
 
-        if (mesh.indices != NULL)
+        if ((mesh.indices != NULL) || (mesh.indices32 != NULL))
         {
             for (int i = 0, v = 0; i < mesh.triangleCount; i++, v += 3)
             {
-                byteCount += sprintf(txtData + byteCount, "f %i/%i/%i %i/%i/%i %i/%i/%i\n",
-                    mesh.indices[v] + 1, mesh.indices[v] + 1, mesh.indices[v] + 1,
-                    mesh.indices[v + 1] + 1, mesh.indices[v + 1] + 1, mesh.indices[v + 1] + 1,
-                    mesh.indices[v + 2] + 1, mesh.indices[v + 2] + 1, mesh.indices[v + 2] + 1);
+                unsigned int i0 = GetMeshIndex(&mesh, v) + 1;
+                unsigned int i1 = GetMeshIndex(&mesh, v + 1) + 1;
+                unsigned int i2 = GetMeshIndex(&mesh, v + 2) + 1;
+
+                byteCount += sprintf(txtData + byteCount, "f %u/%u/%u %u/%u/%u %u/%u/%u\n", i0, i0, i0, i1, i1, i1, i2, i2, i2);
             }
         }
         else
@@ -2007,6 +2722,17 @@ bool ExportMesh(Mesh mesh, const char *fileName)
 
         RL_FREE(txtData);
     }
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+    else if (IsFileExtension(fileName, ".rmdl"))
+    {
+        // Export mesh as a single-mesh model, no materials
+        Model model = { 0 };
+        model.meshCount = 1;
+        model.meshes = &mesh;
+
+        success = ExportModel(model, fileName);
+    }
+#endif
     else if (IsFileExtension(fileName, ".raw"))
     {
         // TODO: Support additional file formats to export mesh vertex data
@@ -2099,6 +2825,12 @@ bool ExportMeshAsCode(Mesh mesh, const char *fileName)
         for (int i = 0; i < mesh.triangleCount*3 - 1; i++) byteCount += sprintf(txtData + byteCount, ((i%TEXT_BYTES_PER_LINE == 0)? "%i,\n" : "%i, "), mesh.indices[i]);
         byteCount += sprintf(txtData + byteCount, "%i };\n", mesh.indices[mesh.triangleCount*3 - 1]);
     }
+    else if (mesh.indices32 != NULL)    // Vertex indices (3 index per triangle - unsigned int)
+    {
+        byteCount += sprintf(txtData + byteCount, "static unsigned int %s_INDEX_DATA[%i] = { ", varFileName, mesh.triangleCount*3);
+        for (int i = 0; i < mesh.triangleCount*3 - 1; i++) byteCount += sprintf(txtData + byteCount, ((i%TEXT_BYTES_PER_LINE == 0)? "%u,\n" : "%u, "), mesh.indices32[i]);
+        byteCount += sprintf(txtData + byteCount, "%u };\n", mesh.indices32[mesh.triangleCount*3 - 1]);
+    }
     //-----------------------------------------------------------------------------------------
 
     // NOTE: Text data size exported is determined by '\0' (NULL) character
@@ -2258,10 +2990,66 @@ ModelAnimation *LoadModelAnimations(const char *fileName, int *animCount)
 #if defined(SUPPORT_FILEFORMAT_GLTF)
     if (IsFileExtension(fileName, ".gltf;.glb")) animations = LoadModelAnimationsGLTF(fileName, animCount);
 #endif
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+    if (IsFileExtension(fileName, ".rmdl")) animations = LoadModelAnimationsRMDL(fileName, animCount);
+#endif
 
     return animations;
 }
 
+// Export model animations data to file (.rmdl)
+bool ExportModelAnimations(ModelAnimation *animations, int animCount, const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+    if (IsFileExtension(fileName, ".rmdl") && (animations != NULL))
+    {
+        unsigned char *fileData = NULL;
+        int dataSize = 0;
+
+        // NOTE: Data is written in two passes, first one only computes the required data size
+        for (int pass = 0; pass < 2; pass++)
+        {
+            if (pass == 1) fileData = (unsigned char *)RL_CALLOC(dataSize, 1);
+
+            int offset = RMDL_HEADER_SIZE;
+
+            // Animation chunks: one chunk per animation, skeleton and frame poses
+            for (int i = 0; i < animCount; i++)
+            {
+                int chunkOffset = offset;
+                int animInfo[4] = { animations[i].boneCount, animations[i].frameCount, 0, 0 };
+                offset = WriteRMDLData(fileData, offset + RMDL_CHUNK_HEADER_SIZE, animInfo, sizeof(animInfo));
+                offset = WriteRMDLData(fileData, offset, animations[i].name, sizeof(animations[i].name));
+                offset = WriteRMDLData(fileData, offset, animations[i].bones, animations[i].boneCount*sizeof(BoneInfo));
+
+                // NOTE: Frame poses are stored contiguously, no padding between frames
+                for (int f = 0; f < animations[i].frameCount; f++)
+                {
+                    if (fileData != NULL) memcpy(fileData + offset + f*animations[i].boneCount*sizeof(Transform), animations[i].framePoses[f], animations[i].boneCount*sizeof(Transform));
+                }
+                offset = WriteRMDLData(fileData, offset, NULL, animations[i].frameCount*animations[i].boneCount*sizeof(Transform));
+
+                WriteRMDLChunkHeader(fileData, chunkOffset, "ANIM", offset - chunkOffset);
+            }
+
+            WriteRMDLHeader(fileData, animCount);
+            dataSize = offset;
+        }
+
+        success = SaveFileData(fileName, fileData, dataSize);
+
+        RL_FREE(fileData);
+    }
+#endif
+
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Model animations exported successfully", fileName);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export model animations", fileName);
+
+    return success;
+}
+
 // Update model animated bones transform matrices for a given frame
 // NOTE: Updated data is not uploaded to GPU but kept at model.meshes[i].boneMatrices[boneId],
 // to be uploaded to shader at drawing, in case GPU skinning is enabled
@@ -3594,25 +4382,34 @@ void GenMeshTangents(Mesh *mesh)
         mesh->tangents = (float *)RL_MALLOC(mesh->vertexCount*4*sizeof(float));
     }
 
-    Vector3 *tan1 = (Vector3 *)RL_MALLOC(mesh->vertexCount*sizeof(Vector3));
-    Vector3 *tan2 = (Vector3 *)RL_MALLOC(mesh->vertexCount*sizeof(Vector3));
+    Vector3 *tan1 = (Vector3 *)RL_CALLOC(mesh->vertexCount, sizeof(Vector3));
+    Vector3 *tan2 = (Vector3 *)RL_CALLOC(mesh->vertexCount, sizeof(Vector3));
+
+    bool indexed = ((mesh->indices != NULL) || (mesh->indices32 != NULL));
 
-    if (mesh->vertexCount % 3 != 0)
+    if (!indexed && (mesh->vertexCount % 3 != 0))
     {
         TRACELOG(LOG_WARNING, "MESH: vertexCount expected to be a multiple of 3. Expect uninitialized values.");
     }
 
-    for (int i = 0; i <= mesh->vertexCount - 3; i += 3)
+    // NOTE: Triangle directions are accumulated for vertices shared between triangles (indexed meshes)
+    for (int t = 0; t < mesh->triangleCount; t++)
     {
+        int i0 = indexed? (int)GetMeshIndex(mesh, t*3) : t*3;
+        int i1 = indexed? (int)GetMeshIndex(mesh, t*3 + 1) : t*3 + 1;
+        int i2 = indexed? (int)GetMeshIndex(mesh, t*3 + 2) : t*3 + 2;
+
+        if ((i0 >= mesh->vertexCount) || (i1 >= mesh->vertexCount) || (i2 >= mesh->vertexCount)) continue;
+
         // Get triangle vertices
-        Vector3 v1 = { mesh->vertices[(i + 0)*3 + 0], mesh->vertices[(i + 0)*3 + 1], mesh->vertices[(i + 0)*3 + 2] };
-        Vector3 v2 = { mesh->vertices[(i + 1)*3 + 0], mesh->vertices[(i + 1)*3 + 1], mesh->vertices[(i + 1)*3 + 2] };
-        Vector3 v3 = { mesh->vertices[(i + 2)*3 + 0], mesh->vertices[(i + 2)*3 + 1], mesh->vertices[(i + 2)*3 + 2] };
+        Vector3 v1 = { mesh->vertices[i0*3 + 0], mesh->vertices[i0*3 + 1], mesh->vertices[i0*3 + 2] };
+        Vector3 v2 = { mesh->vertices[i1*3 + 0], mesh->vertices[i1*3 + 1], mesh->vertices[i1*3 + 2] };
+        Vector3 v3 = { mesh->vertices[i2*3 + 0], mesh->vertices[i2*3 + 1], mesh->vertices[i2*3 + 2] };
 
         // Get triangle texcoords
-        Vector2 uv1 = { mesh->texcoords[(i + 0)*2 + 0], mesh->texcoords[(i + 0)*2 + 1] };
-        Vector2 uv2 = { mesh->texcoords[(i + 1)*2 + 0], mesh->texcoords[(i + 1)*2 + 1] };
-        Vector2 uv3 = { mesh->texcoords[(i + 2)*2 + 0], mesh->texcoords[(i + 2)*2 + 1] };
+        Vector2 uv1 = { mesh->texcoords[i0*2 + 0], mesh->texcoords[i0*2 + 1] };
+        Vector2 uv2 = { mesh->texcoords[i1*2 + 0], mesh->texcoords[i1*2 + 1] };
+        Vector2 uv3 = { mesh->texcoords[i2*2 + 0], mesh->texcoords[i2*2 + 1] };
 
         float x1 = v2.x - v1.x;
         float y1 = v2.y - v1.y;
@@ -3632,13 +4429,13 @@ void GenMeshTangents(Mesh *mesh)
         Vector3 sdir = { (t2*x1 - t1*x2)*r, (t2*y1 - t1*y2)*r, (t2*z1 - t1*z2)*r };
         Vector3 tdir = { (s1*x2 - s2*x1)*r, (s1*y2 - s2*y1)*r, (s1*z2 - s2*z1)*r };
 
-        tan1[i + 0] = sdir;
-        tan1[i + 1] = sdir;
-        tan1[i + 2] = sdir;
+        tan1[i0] = Vector3Add(tan1[i0], sdir);
+        tan1[i1] = Vector3Add(tan1[i1], sdir);
+        tan1[i2] = Vector3Add(tan1[i2], sdir);
 
-        tan2[i + 0] = tdir;
-        tan2[i + 1] = tdir;
-        tan2[i + 2] = tdir;
+        tan2[i0] = Vector3Add(tan2[i0], tdir);
+        tan2[i1] = Vector3Add(tan2[i1], tdir);
+        tan2[i2] = Vector3Add(tan2[i2], tdir);
     }
 
     // Compute tangents considering normals
@@ -3689,475 +4486,2210 @@ void GenMeshTangents(Mesh *mesh)
     TRACELOG(LOG_INFO, "MESH: Tangents data computed and uploaded for provided mesh");
 }
 
-// Draw a model (with texture if set)
-void DrawModel(Model model, Vector3 position, float scale, Color tint)
+// Generate mesh indices, welding duplicated vertices
+// NOTE: Vertices are duplicated when all their attributes are bitwise equal, unique vertices are
+// looked up in an open addressing hash table and vertex data is compacted in place,
+// 32-bit indices are generated if unique vertices exceed 16-bit indices range
+void GenMeshIndices(Mesh *mesh)
 {
-    Vector3 vScale = { scale, scale, scale };
-    Vector3 rotationAxis = { 0.0f, 1.0f, 0.0f };
+    if ((mesh->vertices == NULL) || (mesh->vertexCount <= 0))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Indices generation requires vertex position data");
+        return;
+    }
 
-    DrawModelEx(model, position, rotationAxis, 0.0f, vScale, tint);
-}
+    int vertexCount = mesh->vertexCount;
+    int indexCount = mesh->triangleCount*3;
 
-// Draw a model with extended parameters
-void DrawModelEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint)
-{
-    // Calculate transformation matrix from function parameters
-    // Get transform matrix (rotation -> scale -> translation)
-    Matrix matScale = MatrixScale(scale.x, scale.y, scale.z);
-    Matrix matRotation = MatrixRotate(rotationAxis, rotationAngle*DEG2RAD);
-    Matrix matTranslation = MatrixTranslate(position.x, position.y, position.z);
+    // Vertex attributes compared for welding, animated vertex data is only compacted
+    unsigned char *attributes[10] = {
+        (unsigned char *)mesh->vertices, (unsigned char *)mesh->texcoords, (unsigned char *)mesh->texcoords2,
+        (unsigned char *)mesh->normals, (unsigned char *)mesh->tangents, mesh->colors, mesh->boneIds,
+        (unsigned char *)mesh->boneWeights, (unsigned char *)mesh->animVertices, (unsigned char *)mesh->animNormals
+    };
+    const int attributeSizes[10] = {
+        3*sizeof(float), 2*sizeof(float), 2*sizeof(float), 3*sizeof(float), 4*sizeof(float),
+        4*sizeof(unsigned char), 4*sizeof(unsigned char), 4*sizeof(float), 3*sizeof(float), 3*sizeof(float)
+    };
+    const int comparedAttributes = 8;
 
-    Matrix matTransform = MatrixMultiply(MatrixMultiply(matScale, matRotation), matTranslation);
+    int tableSize = 1;
+    while (tableSize < vertexCount*2) tableSize <<= 1;
 
-    // Combine model transformation matrix (model.transform) with matrix generated by function parameters (matTransform)
-    model.transform = MatrixMultiply(model.transform, matTransform);
+    int *table = (int *)RL_MALLOC(tableSize*sizeof(int));
+    int *remap = (int *)RL_MALLOC(vertexCount*sizeof(int));
+    for (int i = 0; i < tableSize; i++) table[i] = -1;
 
-    for (int i = 0; i < model.meshCount; i++)
+    int uniqueCount = 0;
+
+    for (int i = 0; i < vertexCount; i++)
     {
-        Color color = model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color;
+        // Hash vertex attributes data (FNV-1a)
+        unsigned int hash = 2166136261u;
+        for (int a = 0; a < comparedAttributes; a++)
+        {
+            if (attributes[a] == NULL) continue;
 
-        Color colorTint = WHITE;
-        colorTint.r = (unsigned char)(((int)color.r*(int)tint.r)/255);
-        colorTint.g = (unsigned char)(((int)color.g*(int)tint.g)/255);
-        colorTint.b = (unsigned char)(((int)color.b*(int)tint.b)/255);
-        colorTint.a = (unsigned char)(((int)color.a*(int)tint.a)/255);
+            const unsigned char *data = attributes[a] + i*attributeSizes[a];
+            for (int b = 0; b < attributeSizes[a]; b++) hash = (hash ^ data[b])*16777619u;
+        }
 
-        model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color = colorTint;
-        DrawMesh(model.meshes[i], model.materials[model.meshMaterial[i]], model.transform);
-        model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color = color;
+        // Look for an equal unique vertex, table stores compacted vertex indices
+        int slot = (int)(hash & (tableSize - 1));
+        int index = -1;
+
+        while (table[slot] != -1)
+        {
+            bool equal = true;
+            for (int a = 0; (a < comparedAttributes) && equal; a++)
+            {
+                if (attributes[a] != NULL) equal = (memcmp(attributes[a] + table[slot]*attributeSizes[a], attributes[a] + i*attributeSizes[a], attributeSizes[a]) == 0);
+            }
+
+            if (equal)
+            {
+                index = table[slot];
+                break;
+            }
+
+            slot = (slot + 1) & (tableSize - 1);
+        }
+
+        if (index == -1)
+        {
+            // New unique vertex, move it to compacted position (never after current vertex)
+            index = uniqueCount;
+            table[slot] = index;
+
+            if (index != i)
+            {
+                for (int a = 0; a < 10; a++)
+                {
+                    if (attributes[a] != NULL) memcpy(attributes[a] + index*attributeSizes[a], attributes[a] + i*attributeSizes[a], attributeSizes[a]);
+                }
+            }
+
+            uniqueCount++;
+        }
+
+        remap[i] = index;
     }
-}
 
-// Draw a model wires (with texture if set)
-void DrawModelWires(Model model, Vector3 position, float scale, Color tint)
-{
-    rlEnableWireMode();
+    // Generate indices, remapping previous indices if mesh was already indexed
+    bool indexed = ((mesh->indices != NULL) || (mesh->indices32 != NULL));
+    unsigned short *indices = NULL;
+    unsigned int *indices32 = NULL;
 
-    DrawModel(model, position, scale, tint);
+    if (uniqueCount <= 65535) indices = (unsigned short *)RL_MALLOC(indexCount*sizeof(unsigned short));
+    else indices32 = (unsigned int *)RL_MALLOC(indexCount*sizeof(unsigned int));
 
-    rlDisableWireMode();
+    for (int i = 0; i < indexCount; i++)
+    {
+        unsigned int vertex = indexed? GetMeshIndex(mesh, i) : (unsigned int)i;
+        int index = (vertex < (unsigned int)vertexCount)? remap[vertex] : 0;
+
+        if (indices != NULL) indices[i] = (unsigned short)index;
+        else indices32[i] = (unsigned int)index;
+    }
+
+    RL_FREE(table);
+    RL_FREE(remap);
+
+    RL_FREE(mesh->indices);
+    RL_FREE(mesh->indices32);
+    mesh->indices = indices;
+    mesh->indices32 = indices32;
+
+    // Shrink vertex data arrays to unique vertices
+    mesh->vertexCount = uniqueCount;
+    if (mesh->vertices != NULL) mesh->vertices = (float *)RL_REALLOC(mesh->vertices, uniqueCount*3*sizeof(float));
+    if (mesh->texcoords != NULL) mesh->texcoords = (float *)RL_REALLOC(mesh->texcoords, uniqueCount*2*sizeof(float));
+    if (mesh->texcoords2 != NULL) mesh->texcoords2 = (float *)RL_REALLOC(mesh->texcoords2, uniqueCount*2*sizeof(float));
+    if (mesh->normals != NULL) mesh->normals = (float *)RL_REALLOC(mesh->normals, uniqueCount*3*sizeof(float));
+    if (mesh->tangents != NULL) mesh->tangents = (float *)RL_REALLOC(mesh->tangents, uniqueCount*4*sizeof(float));
+    if (mesh->colors != NULL) mesh->colors = (unsigned char *)RL_REALLOC(mesh->colors, uniqueCount*4*sizeof(unsigned char));
+    if (mesh->boneIds != NULL) mesh->boneIds = (unsigned char *)RL_REALLOC(mesh->boneIds, uniqueCount*4*sizeof(unsigned char));
+    if (mesh->boneWeights != NULL) mesh->boneWeights = (float *)RL_REALLOC(mesh->boneWeights, uniqueCount*4*sizeof(float));
+    if (mesh->animVertices != NULL) mesh->animVertices = (float *)RL_REALLOC(mesh->animVertices, uniqueCount*3*sizeof(float));
+    if (mesh->animNormals != NULL) mesh->animNormals = (float *)RL_REALLOC(mesh->animNormals, uniqueCount*3*sizeof(float));
+
+    // Vertex buffers size changed, mesh is uploaded again if it was already uploaded to GPU
+    ReloadMeshBuffers(mesh);
+
+    TRACELOG(LOG_INFO, "MESH: Indices generated for provided mesh, vertices welded: %i -> %i", vertexCount, uniqueCount);
 }
 
-// Draw a model wires (with texture if set) with extended parameters
-void DrawModelWiresEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint)
+// Optimize mesh triangles and vertices order for GPU rendering
+// NOTE: Optimization is done in three steps over indexed triangles (unindexed meshes are welded first):
+//  - Vertex cache: triangles reordered to maximize post-transform cache hits (Forsyth algorithm)
+//  - Overdraw: triangles clusters sorted to draw outer facing clusters first, keeping cache order inside clusters
+//  - Vertex fetch: vertices reordered by first use in index buffer, all vertex attributes are remapped
+void OptimizeMesh(Mesh *mesh)
 {
-    rlEnableWireMode();
+    if ((mesh->vertices == NULL) || (mesh->vertexCount <= 0) || (mesh->triangleCount <= 0))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Optimization requires vertex position and triangles data");
+        return;
+    }
 
-    DrawModelEx(model, position, rotationAxis, rotationAngle, scale, tint);
+    if ((mesh->indices == NULL) && (mesh->indices32 == NULL)) GenMeshIndices(mesh);
 
-    rlDisableWireMode();
-}
+    int indexCount = mesh->triangleCount*3;
+    int vertexCount = mesh->vertexCount;
+    unsigned int *indices = (unsigned int *)RL_MALLOC((size_t)indexCount*sizeof(unsigned int));
 
-// Draw a model points
-void DrawModelPoints(Model model, Vector3 position, float scale, Color tint)
-{
-    rlEnablePointMode();
-    rlDisableBackfaceCulling();
+    for (int i = 0; i < indexCount; i++)
+    {
+        indices[i] = GetMeshIndex(mesh, i);
+        if (indices[i] >= (unsigned int)vertexCount) indices[i] = 0;
+    }
 
-    DrawModel(model, position, scale, tint);
+    // Vertex cache and overdraw optimization
+    int *clusters = (int *)RL_MALLOC((mesh->triangleCount + 1)*sizeof(int));
+    int clusterCount = OptimizeVertexCache(indices, indexCount, vertexCount, clusters);
+    OptimizeOverdraw(indices, indexCount, mesh->vertices, clusters, clusterCount);
+    RL_FREE(clusters);
 
-    rlEnableBackfaceCulling();
-    rlDisableWireMode();
-}
+    // Vertex fetch optimization, vertices renumbered by first use
+    // NOTE: Vertices not referenced by any triangle are kept at the end
+    int *remap = (int *)RL_MALLOC(vertexCount*sizeof(int));
+    for (int i = 0; i < vertexCount; i++) remap[i] = -1;
 
-// Draw a model points
-void DrawModelPointsEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint)
-{
-    rlEnablePointMode();
-    rlDisableBackfaceCulling();
+    int nextVertex = 0;
+    for (int i = 0; i < indexCount; i++)
+    {
+        if (remap[indices[i]] == -1) remap[indices[i]] = nextVertex++;
+        indices[i] = (unsigned int)remap[indices[i]];
+    }
+    for (int i = 0; i < vertexCount; i++) if (remap[i] == -1) remap[i] = nextVertex++;
 
-    DrawModelEx(model, position, rotationAxis, rotationAngle, scale, tint);
+    RemapMeshVertices(mesh, remap);
+    RL_FREE(remap);
 
-    rlEnableBackfaceCulling();
-    rlDisableWireMode();
-}
+    for (int i = 0; i < indexCount; i++)
+    {
+        if (mesh->indices32 != NULL) mesh->indices32[i] = indices[i];
+        else mesh->indices[i] = (unsigned short)indices[i];
+    }
 
-// Draw a billboard
-void DrawBillboard(Camera camera, Texture2D texture, Vector3 position, float scale, Color tint)
-{
-    Rectangle source = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+    RL_FREE(indices);
 
-    DrawBillboardRec(camera, texture, source, position, (Vector2) { scale*fabsf((float)source.width/source.height), scale }, tint);
+    ReloadMeshBuffers(mesh);
+
+    TRACELOG(LOG_INFO, "MESH: Optimized mesh for GPU rendering (%i vertices, %i triangles)", mesh->vertexCount, mesh->triangleCount);
 }
 
-// Draw a billboard (part of a texture defined by a rectangle)
-void DrawBillboardRec(Camera camera, Texture2D texture, Rectangle source, Vector3 position, Vector2 size, Color tint)
+// Get mesh vertex cache statistics for a FIFO cache of provided size
+// NOTE: ACMR: Average cache misses per triangle, [0.5..3.0], lower is better
+//       ATVR: Average transformed vertices per vertex, [1.0..6.0], 1.0 is optimal
+void GetMeshCacheStats(Mesh mesh, int cacheSize, float *acmr, float *atvr)
 {
-    // NOTE: Billboard locked on axis-Y
-    Vector3 up = { 0.0f, 1.0f, 0.0f };
+    bool indexed = ((mesh.indices != NULL) || (mesh.indices32 != NULL));
+    int indexCount = mesh.triangleCount*3;
+    int misses = 0;
 
-    DrawBillboardPro(camera, texture, source, position, up, size, Vector2Scale(size, 0.5), 0.0f, tint);
+    if (acmr != NULL) *acmr = 0.0f;
+    if (atvr != NULL) *atvr = 0.0f;
+    if ((indexCount <= 0) || (mesh.vertexCount <= 0) || (cacheSize <= 0)) return;
+
+    // FIFO cache simulation, vertex timestamps used to check if vertex is in cache
+    int *timestamps = (int *)RL_CALLOC(mesh.vertexCount, sizeof(int));
+    int timestamp = cacheSize + 1;
+
+    for (int i = 0; i < indexCount; i++)
+    {
+        unsigned int index = indexed? GetMeshIndex(&mesh, i) : (unsigned int)i;
+        if (index >= (unsigned int)mesh.vertexCount) continue;
+
+        if ((timestamp - timestamps[index]) > cacheSize)
+        {
+            timestamps[index] = timestamp++;
+            misses++;
+        }
+    }
+
+    RL_FREE(timestamps);
+
+    if (acmr != NULL) *acmr = (float)misses/mesh.triangleCount;
+    if (atvr != NULL) *atvr = (float)misses/mesh.vertexCount;
 }
 
-// Draw a billboard with additional parameters
-void DrawBillboardPro(Camera camera, Texture2D texture, Rectangle source, Vector3 position, Vector3 up, Vector2 size, Vector2 origin, float rotation, Color tint)
+// Generate simplified mesh, triangles reduced to target ratio while error is below maxError
+// NOTE: Edge collapse simplification guided by quadric error metrics (Garland and Heckbert 1997),
+// vertices are only collapsed into existing vertices, so texcoords, normals, colors and skinning data are kept,
+// vertices on attributes seams (same position, different attributes) only collapse along the seam,
+// open borders are only collapsed along the border; maxError is relative to mesh bounds size,
+// resulting simplification error is returned in error (optional), generated mesh is uploaded to GPU if initialized
+Mesh GenMeshSimplified(Mesh mesh, float targetRatio, float maxError, float *error)
 {
-    // Compute the up vector and the right vector
-    Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
-    Vector3 right = { matView.m0, matView.m4, matView.m8 };
-    right = Vector3Scale(right, size.x);
-    up = Vector3Scale(up, size.y);
+    Mesh result = { 0 };
+    float resultError = 0.0f;
 
-    // Flip the content of the billboard while maintaining the counterclockwise edge rendering order
-    if (size.x < 0.0f)
+    if (error != NULL) *error = 0.0f;
+
+    if ((mesh.vertices == NULL) || (mesh.vertexCount <= 0) || (mesh.triangleCount <= 0))
     {
-        source.x += size.x;
-        source.width *= -1.0;
-        right = Vector3Negate(right);
-        origin.x *= -1.0f;
+        TRACELOG(LOG_WARNING, "MESH: Simplification requires vertex position and triangles data");
+        return result;
     }
-    if (size.y < 0.0f)
+
+    bool indexed = ((mesh.indices != NULL) || (mesh.indices32 != NULL));
+    int vertexCount = mesh.vertexCount;
+    int triangleCount = mesh.triangleCount;
+
+    unsigned int *indices = (unsigned int *)RL_MALLOC(triangleCount*3*sizeof(unsigned int));
+    for (int i = 0; i < triangleCount*3; i++)
+    {
+        indices[i] = indexed? GetMeshIndex(&mesh, i) : (unsigned int)i;
+        if (indices[i] >= (unsigned int)vertexCount) indices[i] = 0;
+    }
+
+    // Vertex positions normalized to mesh bounds, errors are relative to mesh size
+    BoundingBox bounds = GetMeshBoundingBox(mesh);
+    Vector3 size = Vector3Subtract(bounds.max, bounds.min);
+    float extent = fmaxf(size.x, fmaxf(size.y, size.z));
+    if (extent <= 0.0f) extent = 1.0f;
+
+    Vector3 *positions = (Vector3 *)RL_MALLOC(vertexCount*sizeof(Vector3));
+    for (int i = 0; i < vertexCount; i++)
+    {
+        Vector3 position = { mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] };
+        positions[i] = Vector3Scale(Vector3Subtract(position, bounds.min), 1.0f/extent);
+    }
+
+    // Vertices sharing position (wedges) are linked in circular lists, first vertex identifies the position
+    int *positionIds = (int *)RL_MALLOC(vertexCount*sizeof(int));
+    int *wedgeNext = (int *)RL_MALLOC(vertexCount*sizeof(int));
+    int tableSize = 1;
+    while (tableSize < vertexCount*2) tableSize <<= 1;
+    int *table = (int *)RL_MALLOC(tableSize*sizeof(int));
+    for (int i = 0; i < tableSize; i++) table[i] = -1;
+
+    for (int i = 0; i < vertexCount; i++)
+    {
+        unsigned int hash = 2166136261u;
+        const unsigned char *data = (const unsigned char *)(mesh.vertices + i*3);
+        for (int b = 0; b < 3*(int)sizeof(float); b++) hash = (hash ^ data[b])*16777619u;
+
+        int slot = (int)(hash & (tableSize - 1));
+        while ((table[slot] != -1) && (memcmp(mesh.vertices + table[slot]*3, mesh.vertices + i*3, 3*sizeof(float)) != 0)) slot = (slot + 1) & (tableSize - 1);
+
+        if (table[slot] == -1)
+        {
+            table[slot] = i;
+            positionIds[i] = i;
+            wedgeNext[i] = i;
+        }
+        else
+        {
+            int id = table[slot];
+            positionIds[i] = id;
+            wedgeNext[i] = wedgeNext[id];
+            wedgeNext[id] = i;
+        }
+    }
+
+    RL_FREE(table);
+
+    int *remap = (int *)RL_MALLOC(vertexCount*sizeof(int));
+    int *wedgeTargets = (int *)RL_MALLOC(vertexCount*sizeof(int));
+    int *marks = (int *)RL_CALLOC(vertexCount, sizeof(int));
+    bool *locked = (bool *)RL_MALLOC(vertexCount*sizeof(bool));
+    bool *border = (bool *)RL_MALLOC(vertexCount*sizeof(bool));
+    float *quadrics = (float *)RL_CALLOC(vertexCount*11, sizeof(float));
+    int *adjacencyOffsets = (int *)RL_MALLOC((vertexCount + 1)*sizeof(int));
+    int *adjacencyCounts = (int *)RL_MALLOC(vertexCount*sizeof(int));
+    int *adjacency = (int *)RL_MALLOC(triangleCount*3*sizeof(int));
+    MeshCollapse *collapses = (MeshCollapse *)RL_MALLOC(vertexCount*sizeof(MeshCollapse));
+    int stamp = 0;
+
+    for (int i = 0; i < vertexCount; i++)
+    {
+        remap[i] = i;
+        wedgeTargets[i] = -1;
+    }
+
+    triangleCount = RemoveDegenerateTriangles(indices, triangleCount, positionIds);
+    int targetCount = (int)(triangleCount*targetRatio);
+
+    // Simplification passes: collapses sorted by error, every pass only collapses independent regions
+    for (int pass = 0; triangleCount > targetCount; pass++)
+    {
+        // Positions triangles adjacency
+        memset(adjacencyCounts, 0, vertexCount*sizeof(int));
+        for (int i = 0; i < triangleCount*3; i++) adjacencyCounts[positionIds[indices[i]]]++;
+
+        adjacencyOffsets[0] = 0;
+        for (int i = 0; i < vertexCount; i++) adjacencyOffsets[i + 1] = adjacencyOffsets[i] + adjacencyCounts[i];
+
+        memset(adjacencyCounts, 0, vertexCount*sizeof(int));
+        for (int i = 0; i < triangleCount*3; i++)
+        {
+            int p = positionIds[indices[i]];
+            adjacency[adjacencyOffsets[p] + adjacencyCounts[p]++] = i/3;
+        }
+
+        // Border positions, edges used by a single triangle
+        memset(border, 0, vertexCount*sizeof(bool));
+        for (int t = 0; t < triangleCount; t++)
+        {
+            for (int k = 0; k < 3; k++)
+            {
+                int a = positionIds[indices[t*3 + k]];
+                int b = positionIds[indices[t*3 + (k + 1)%3]];
+
+                if (GetEdgeTrianglesCount(indices, positionIds, adjacency, adjacencyOffsets, a, b) == 1)
+                {
+                    border[a] = true;
+                    border[b] = true;
+
+                    // Initial border quadrics, plane perpendicular to triangle containing the edge
+                    if (pass == 0)
+                    {
+                        Vector3 p0 = positions[a], p1 = positions[b], p2 = positions[positionIds[indices[t*3 + (k + 2)%3]]];
+                        Vector3 edge = Vector3Subtract(p1, p0);
+                        Vector3 normal = Vector3Normalize(Vector3CrossProduct(edge, Vector3CrossProduct(edge, Vector3Subtract(p2, p0))));
+                        float weight = Vector3DotProduct(edge, edge)*MESH_SIMPLIFY_BORDER_WEIGHT;
+
+                        AddPlaneQuadric(quadrics + a*11, normal, -Vector3DotProduct(normal, p0), weight);
+                        AddPlaneQuadric(quadrics + b*11, normal, -Vector3DotProduct(normal, p0), weight);
+                    }
+                }
+            }
+
+            // Initial triangles quadrics, area weighted
+            if (pass == 0)
+            {
+                Vector3 p0 = positions[indices[t*3]], p1 = positions[indices[t*3 + 1]], p2 = positions[indices[t*3 + 2]];
+                Vector3 cross = Vector3CrossProduct(Vector3Subtract(p1, p0), Vector3Subtract(p2, p0));
+                float area = Vector3Length(cross)*0.5f;
+
+                if (area > 0.0f)
+                {
+                    Vector3 normal = Vector3Scale(cross, 0.5f/area);
+                    for (int k = 0; k < 3; k++) AddPlaneQuadric(quadrics + positionIds[indices[t*3 + k]]*11, normal, -Vector3DotProduct(normal, p0), area);
+                }
+            }
+        }
+
+        // Collapse candidates, best target position for every position
+        int collapseCount = 0;
+
+        for (int a = 0; a < vertexCount; a++)
+        {
+            if ((positionIds[a] != a) || (adjacencyCounts[a] == 0)) continue;
+
+            MeshCollapse collapse = { a, -1, 0.0f };
+
+            for (int j = adjacencyOffsets[a]; j < adjacencyOffsets[a + 1]; j++)
+            {
+                for (int k = 0; k < 3; k++)
+                {
+                    int b = positionIds[indices[adjacency[j]*3 + k]];
+                    if (b == a) continue;
+
+                    float cost = GetQuadricError(quadrics + a*11, quadrics + b*11, positions[b]);
+                    if ((collapse.target == -1) || (cost < collapse.error))
+                    {
+                        collapse.target = b;
+                        collapse.error = cost;
+                    }
+                }
+            }
+
+            if ((collapse.target != -1) && (collapse.error <= maxError)) collapses[collapseCount++] = collapse;
+        }
+
+        qsort(collapses, collapseCount, sizeof(MeshCollapse), CompareMeshCollapses);
+
+        // Collapse positions in error order, collapsed regions are locked for current pass
+        memset(locked, 0, vertexCount*sizeof(bool));
+        int removedCount = 0;
+        int collapsedCount = 0;
+
+        for (int c = 0; (c < collapseCount) && ((triangleCount - removedCount) > targetCount); c++)
+        {
+            int a = collapses[c].source;
+            int b = collapses[c].target;
+
+            if (locked[a] || locked[b]) continue;
+
+            // Check collapse keeps mesh topology and attributes, wedges of a are mapped to connected wedges of b
+            bool valid = true;
+            int sharedCount = 0;
+            stamp += 2;
+
+            for (int j = adjacencyOffsets[b]; j < adjacencyOffsets[b + 1]; j++)
+            {
+                for (int k = 0; k < 3; k++) marks[positionIds[indices[adjacency[j]*3 + k]]] = stamp;
+            }
+
+            int commonCount = 0;
+            for (int j = adjacencyOffsets[a]; (j < adjacencyOffsets[a + 1]) && valid; j++)
+            {
+                const unsigned int *triangle = indices + adjacency[j]*3;
+                int wedgeA = -1, wedgeB = -1;
+
+                for (int k = 0; k < 3; k++)
+                {
+                    int p = positionIds[triangle[k]];
+
+                    if (p == a) wedgeA = (int)triangle[k];
+                    else if (p == b) wedgeB = (int)triangle[k];
+                    else if (marks[p] == stamp)
+                    {
+                        marks[p] = stamp + 1;
+                        commonCount++;
+                    }
+                }
+
+                if (wedgeB != -1)
+                {
+                    sharedCount++;
+                    if (wedgeTargets[wedgeA] == -1) wedgeTargets[wedgeA] = wedgeB;
+                    else if (wedgeTargets[wedgeA] != wedgeB) valid = false;
+                }
+                else
+                {
+                    // Check triangle does not flip moving a to b position
+                    Vector3 p[3] = { 0 };
+                    for (int k = 0; k < 3; k++) p[k] = positions[positionIds[triangle[k]]];
+
+                    Vector3 normal = Vector3CrossProduct(Vector3Subtract(p[1], p[0]), Vector3Subtract(p[2], p[0]));
+                    for (int k = 0; k < 3; k++) if (positionIds[triangle[k]] == a) p[k] = positions[b];
+                    Vector3 collapsedNormal = Vector3CrossProduct(Vector3Subtract(p[1], p[0]), Vector3Subtract(p[2], p[0]));
+
+                    // NOTE: Normal rotations over ~75 degrees are also rejected, they produce slivers prone to fold
+                    if (Vector3DotProduct(normal, collapsedNormal) < 0.25f*Vector3Length(normal)*Vector3Length(collapsedNormal)) valid = false;
+                }
+            }
+
+            // Link condition: common neighbors must be the opposite vertices of shared triangles
+            if ((sharedCount == 0) || (sharedCount > 2) || (commonCount > sharedCount) || (border[a] && (sharedCount != 1))) valid = false;
+
+            // All wedges of a used by triangles must be mapped
+            for (int j = adjacencyOffsets[a]; (j < adjacencyOffsets[a + 1]) && valid; j++)
+            {
+                for (int k = 0; k < 3; k++)
+                {
+                    unsigned int v = indices[adjacency[j]*3 + k];
+                    if ((positionIds[v] == a) && (wedgeTargets[v] == -1)) valid = false;
+                }
+            }
+
+            if (valid)
+            {
+                for (int v = a, w = 0; (w == 0) || (v != a); v = wedgeNext[v], w++)
+                {
+                    if (wedgeTargets[v] != -1) remap[v] = wedgeTargets[v];
+                }
+
+                for (int i = 0; i < 11; i++) quadrics[b*11 + i] += quadrics[a*11 + i];
+
+                for (int j = adjacencyOffsets[a]; j < adjacencyOffsets[a + 1]; j++)
+                {
+                    for (int k = 0; k < 3; k++) locked[positionIds[indices[adjacency[j]*3 + k]]] = true;
+                }
+
+                if (collapses[c].error > resultError) resultError = collapses[c].error;
+                removedCount += sharedCount;
+                collapsedCount++;
+            }
+
+            for (int v = a, w = 0; (w == 0) || (v != a); v = wedgeNext[v], w++) wedgeTargets[v] = -1;
+        }
+
+        if (collapsedCount == 0) break;
+
+        for (int i = 0; i < triangleCount*3; i++) indices[i] = (unsigned int)remap[indices[i]];
+        triangleCount = RemoveDegenerateTriangles(indices, triangleCount, positionIds);
+    }
+
+    RL_FREE(positions);
+    RL_FREE(positionIds);
+    RL_FREE(wedgeNext);
+    RL_FREE(wedgeTargets);
+    RL_FREE(marks);
+    RL_FREE(locked);
+    RL_FREE(border);
+    RL_FREE(quadrics);
+    RL_FREE(adjacencyOffsets);
+    RL_FREE(adjacencyCounts);
+    RL_FREE(adjacency);
+    RL_FREE(collapses);
+
+    if (triangleCount == 0)
+    {
+        // Only degenerate triangles, no mesh generated
+        TRACELOG(LOG_WARNING, "MESH: Simplified mesh has no triangles, mesh not generated");
+        RL_FREE(indices);
+        RL_FREE(remap);
+
+        return result;
+    }
+
+    // Generate simplified mesh with referenced vertices
+    int *vertices = remap;
+    for (int i = 0; i < vertexCount; i++) vertices[i] = -1;
+
+    result.triangleCount = triangleCount;
+    for (int i = 0; i < triangleCount*3; i++)
+    {
+        if (vertices[indices[i]] == -1) vertices[indices[i]] = result.vertexCount++;
+        indices[i] = (unsigned int)vertices[indices[i]];
+    }
+
+    result.vertices = (float *)RL_MALLOC(result.vertexCount*3*sizeof(float));
+    for (int i = 0; i < vertexCount; i++) if (vertices[i] != -1) memcpy(result.vertices + vertices[i]*3, mesh.vertices + i*3, 3*sizeof(float));
+
+    if (mesh.texcoords != NULL)
+    {
+        result.texcoords = (float *)RL_MALLOC(result.vertexCount*2*sizeof(float));
+        for (int i = 0; i < vertexCount; i++) if (vertices[i] != -1) memcpy(result.texcoords + vertices[i]*2, mesh.texcoords + i*2, 2*sizeof(float));
+    }
+
+    if (mesh.texcoords2 != NULL)
+    {
+        result.texcoords2 = (float *)RL_MALLOC(result.vertexCount*2*sizeof(float));
+        for (int i = 0; i < vertexCount; i++) if (vertices[i] != -1) memcpy(result.texcoords2 + vertices[i]*2, mesh.texcoords2 + i*2, 2*sizeof(float));
+    }
+
+    if (mesh.normals != NULL)
+    {
+        result.normals = (float *)RL_MALLOC(result.vertexCount*3*sizeof(float));
+        for (int i = 0; i < vertexCount; i++) if (vertices[i] != -1) memcpy(result.normals + vertices[i]*3, mesh.normals + i*3, 3*sizeof(float));
+    }
+
+    if (mesh.tangents != NULL)
+    {
+        result.tangents = (float *)RL_MALLOC(result.vertexCount*4*sizeof(float));
+        for (int i = 0; i < vertexCount; i++) if (vertices[i] != -1) memcpy(result.tangents + vertices[i]*4, mesh.tangents + i*4, 4*sizeof(float));
+    }
+
+    if (mesh.colors != NULL)
+    {
+        result.colors = (unsigned char *)RL_MALLOC(result.vertexCount*4*sizeof(unsigned char));
+        for (int i = 0; i < vertexCount; i++) if (vertices[i] != -1) memcpy(result.colors + vertices[i]*4, mesh.colors + i*4, 4*sizeof(unsigned char));
+    }
+
+    if ((mesh.boneIds != NULL) && (mesh.boneWeights != NULL))
+    {
+        result.boneIds = (unsigned char *)RL_MALLOC(result.vertexCount*4*sizeof(unsigned char));
+        result.boneWeights = (float *)RL_MALLOC(result.vertexCount*4*sizeof(float));
+        for (int i = 0; i < vertexCount; i++)
+        {
+            if (vertices[i] == -1) continue;
+            memcpy(result.boneIds + vertices[i]*4, mesh.boneIds + i*4, 4*sizeof(unsigned char));
+            memcpy(result.boneWeights + vertices[i]*4, mesh.boneWeights + i*4, 4*sizeof(float));
+        }
+
+        // Animated vertex data and bone transform matrices
+        result.animVertices = (float *)RL_MALLOC(result.vertexCount*3*sizeof(float));
+        memcpy(result.animVertices, result.vertices, result.vertexCount*3*sizeof(float));
+        result.animNormals = (float *)RL_CALLOC(result.vertexCount*3, sizeof(float));
+        if (result.normals != NULL) memcpy(result.animNormals, result.normals, result.vertexCount*3*sizeof(float));
+
+        result.boneCount = mesh.boneCount;
+        result.boneMatrices = (Matrix *)RL_MALLOC(result.boneCount*sizeof(Matrix));
+        for (int i = 0; i < result.boneCount; i++) result.boneMatrices[i] = MatrixIdentity();
+    }
+
+    if (result.vertexCount <= 65535)
+    {
+        result.indices = (unsigned short *)RL_MALLOC(triangleCount*3*sizeof(unsigned short));
+        for (int i = 0; i < triangleCount*3; i++) result.indices[i] = (unsigned short)indices[i];
+    }
+    else
+    {
+        result.indices32 = indices;
+        indices = NULL;
+    }
+
+    RL_FREE(indices);
+    RL_FREE(remap);
+
+    // Upload simplified mesh data to GPU (VRAM), mesh bounds are computed
+    if (isGpuReady) UploadMesh(&result, false);
+
+    if (error != NULL) *error = resultError;
+
+    return result;
+}
+
+// Generate mesh levels of detail, simplified to target ratios while error is below maxError
+// NOTE: Level 0 is provided mesh, one simplified level is generated for every ratio,
+// chain stops when a level can not be further simplified; screen sizes are computed from
+// levels simplification error, switching level when error on screen exceeds MESH_LOD_SCREEN_ERROR;
+// generated levels (1..levelCount-1) are uploaded to GPU if initialized and must be unloaded with UnloadMesh()
+MeshLod GenMeshLod(Mesh mesh, const float *ratios, int ratioCount, float maxError)
+{
+    Mesh *levels = (Mesh *)RL_CALLOC(ratioCount + 1, sizeof(Mesh));
+    float *errors = (float *)RL_CALLOC(ratioCount + 1, sizeof(float));
+    int levelCount = 1;
+
+    levels[0] = mesh;
+
+    for (int i = 0; i < ratioCount; i++)
+    {
+        float levelError = 0.0f;
+        Mesh level = GenMeshSimplified(mesh, ratios[i], maxError, &levelError);
+
+        if ((level.triangleCount == 0) || (level.triangleCount >= levels[levelCount - 1].triangleCount))
+        {
+            // No further simplification possible under error bound
+            UnloadMesh(level);
+            break;
+        }
+
+        TRACELOG(LOG_INFO, "MESH: LOD level %i generated: %i triangles (%.1f%%), error: %.5f", levelCount,
+            level.triangleCount, 100.0f*level.triangleCount/mesh.triangleCount, levelError);
+
+        levels[levelCount] = level;
+        errors[levelCount] = levelError;
+        levelCount++;
+    }
+
+    // Screen size thresholds: level is used while its error on screen is below MESH_LOD_SCREEN_ERROR,
+    // last level is never culled by screen size
+    float *screenSizes = (float *)RL_CALLOC(levelCount, sizeof(float));
+    for (int i = 0; i < levelCount - 1; i++)
+    {
+        screenSizes[i] = MESH_LOD_SCREEN_ERROR/fmaxf(errors[i + 1], 0.000001f);
+    }
+
+    // Screen sizes must decrease with levels
+    for (int i = levelCount - 2; i >= 0; i--) screenSizes[i] = fmaxf(screenSizes[i], screenSizes[i + 1]);
+
+    MeshLod lod = LoadMeshLod(levels, screenSizes, levelCount);
+
+    RL_FREE(levels);
+    RL_FREE(errors);
+    RL_FREE(screenSizes);
+
+    return lod;
+}
+
+// Split mesh into spatially coherent chunks with 16-bit indices and own bounds
+// NOTE: Triangles are sorted by their centroid Morton code (Z-order curve) inside mesh bounds and
+// chunks are filled in that order until maxVertices or maxTriangles is reached, so every chunk covers
+// a compact region of the mesh (culled independently) and shares most vertices among its triangles.
+// Only static vertex attributes are copied (no animation data) and chunks are uploaded to GPU if initialized,
+// every chunk must be unloaded with UnloadMesh() and the returned array with MemFree()
+Mesh *SplitMesh(Mesh mesh, int maxVertices, int maxTriangles, int *meshCount)
+{
+    Mesh *meshes = NULL;
+    *meshCount = 0;
+
+    if ((mesh.vertices == NULL) || (mesh.triangleCount <= 0))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Split mesh requires vertex data");
+        return meshes;
+    }
+
+    if ((maxVertices <= 0) || (maxVertices > 65536)) maxVertices = 65536;   // Limited by 16-bit indices
+    if (maxVertices < 3) maxVertices = 3;
+    if ((maxTriangles <= 0) || (maxTriangles > mesh.triangleCount)) maxTriangles = mesh.triangleCount;
+
+    bool indexed = ((mesh.indices != NULL) || (mesh.indices32 != NULL));
+    BoundingBox bounds = GetMeshBoundingBox(mesh);
+    Vector3 size = Vector3Subtract(bounds.max, bounds.min);
+    Vector3 scale = {
+        (size.x > 0.0f)? 1023.0f/size.x : 0.0f,
+        (size.y > 0.0f)? 1023.0f/size.y : 0.0f,
+        (size.z > 0.0f)? 1023.0f/size.z : 0.0f
+    };
+
+    // Compute triangles centroid Morton code (10 bits per axis)
+    unsigned int *codes = (unsigned int *)RL_MALLOC(mesh.triangleCount*sizeof(unsigned int));
+    unsigned int *order = (unsigned int *)RL_MALLOC(mesh.triangleCount*sizeof(unsigned int));
+    unsigned int *sortedCodes = (unsigned int *)RL_MALLOC(mesh.triangleCount*sizeof(unsigned int));
+    unsigned int *sortedOrder = (unsigned int *)RL_MALLOC(mesh.triangleCount*sizeof(unsigned int));
+
+    for (int t = 0; t < mesh.triangleCount; t++)
+    {
+        Vector3 centroid = { 0 };
+
+        for (int k = 0; k < 3; k++)
+        {
+            unsigned int v = indexed? GetMeshIndex(&mesh, t*3 + k) : (unsigned int)(t*3 + k);
+            centroid.x += mesh.vertices[v*3]/3.0f;
+            centroid.y += mesh.vertices[v*3 + 1]/3.0f;
+            centroid.z += mesh.vertices[v*3 + 2]/3.0f;
+        }
+
+        unsigned int x = (unsigned int)Clamp((centroid.x - bounds.min.x)*scale.x, 0.0f, 1023.0f);
+        unsigned int y = (unsigned int)Clamp((centroid.y - bounds.min.y)*scale.y, 0.0f, 1023.0f);
+        unsigned int z = (unsigned int)Clamp((centroid.z - bounds.min.z)*scale.z, 0.0f, 1023.0f);
+        unsigned int code = 0;
+
+        for (int b = 0; b < 10; b++) code |= (((x >> b) & 1) << (3*b + 2)) | (((y >> b) & 1) << (3*b + 1)) | (((z >> b) & 1) << (3*b));
+
+        codes[t] = code;
+        order[t] = t;
+    }
+
+    // Sort triangles by Morton code, radix sort (3 passes of 10 bits, stable)
+    unsigned int *histogram = (unsigned int *)RL_MALLOC(1024*sizeof(unsigned int));
+
+    for (int pass = 0; pass < 3; pass++)
+    {
+        int shift = pass*10;
+        memset(histogram, 0, 1024*sizeof(unsigned int));
+
+        for (int t = 0; t < mesh.triangleCount; t++) histogram[(codes[t] >> shift) & 0x3ff]++;
+        for (unsigned int b = 0, sum = 0; b < 1024; b++) { unsigned int count = histogram[b]; histogram[b] = sum; sum += count; }
+
+        for (int t = 0; t < mesh.triangleCount; t++)
+        {
+            unsigned int position = histogram[(codes[t] >> shift) & 0x3ff]++;
+            sortedCodes[position] = codes[t];
+            sortedOrder[position] = order[t];
+        }
+
+        unsigned int *temp = codes; codes = sortedCodes; sortedCodes = temp;
+        temp = order; order = sortedOrder; sortedOrder = temp;
+    }
+
+    RL_FREE(histogram);
+    RL_FREE(sortedCodes);
+    RL_FREE(sortedOrder);
+    RL_FREE(codes);
+
+    // Fill chunks with sorted triangles, remapping source vertices to chunk vertices
+    int *remap = (int *)RL_MALLOC(mesh.vertexCount*sizeof(int));           // Source vertex to chunk vertex
+    int *remapChunk = (int *)RL_MALLOC(mesh.vertexCount*sizeof(int));      // Chunk the source vertex was last remapped to
+    unsigned int *chunkVertices = (unsigned int *)RL_MALLOC(maxVertices*sizeof(unsigned int));
+    unsigned short *chunkIndices = (unsigned short *)RL_MALLOC(maxTriangles*3*sizeof(unsigned short));
+    int capacity = 8;
+
+    for (int i = 0; i < mesh.vertexCount; i++) remapChunk[i] = -1;
+    meshes = (Mesh *)RL_CALLOC(capacity, sizeof(Mesh));
+
+    for (int t = 0; t < mesh.triangleCount; )
+    {
+        int chunk = *meshCount;
+        int vertexCount = 0;
+        int triangleCount = 0;
+
+        for (; (t < mesh.triangleCount) && (triangleCount < maxTriangles); t++)
+        {
+            unsigned int v[3] = { 0 };
+            int newVertices = 0;
+
+            for (int k = 0; k < 3; k++)
+            {
+                v[k] = indexed? GetMeshIndex(&mesh, order[t]*3 + k) : order[t]*3 + k;
+                if (remapChunk[v[k]] != chunk) newVertices++;
+            }
+
+            if ((vertexCount + newVertices) > maxVertices) break;
+
+            for (int k = 0; k < 3; k++)
+            {
+                if (remapChunk[v[k]] != chunk)
+                {
+                    remapChunk[v[k]] = chunk;
+                    remap[v[k]] = vertexCount;
+                    chunkVertices[vertexCount++] = v[k];
+                }
+
+                chunkIndices[triangleCount*3 + k] = (unsigned short)remap[v[k]];
+            }
+
+            triangleCount++;
+        }
+
+        if (chunk == capacity)
+        {
+            capacity *= 2;
+            meshes = (Mesh *)RL_REALLOC(meshes, capacity*sizeof(Mesh));
+        }
+
+        Mesh part = { 0 };
+        part.vertexCount = vertexCount;
+        part.triangleCount = triangleCount;
+
+        part.vertices = (float *)RL_MALLOC(vertexCount*3*sizeof(float));
+        for (int i = 0; i < vertexCount; i++) memcpy(part.vertices + i*3, mesh.vertices + chunkVertices[i]*3, 3*sizeof(float));
+
+        if (mesh.texcoords != NULL)
+        {
+            part.texcoords = (float *)RL_MALLOC(vertexCount*2*sizeof(float));
+            for (int i = 0; i < vertexCount; i++) memcpy(part.texcoords + i*2, mesh.texcoords + chunkVertices[i]*2, 2*sizeof(float));
+        }
+
+        if (mesh.texcoords2 != NULL)
+        {
+            part.texcoords2 = (float *)RL_MALLOC(vertexCount*2*sizeof(float));
+            for (int i = 0; i < vertexCount; i++) memcpy(part.texcoords2 + i*2, mesh.texcoords2 + chunkVertices[i]*2, 2*sizeof(float));
+        }
+
+        if (mesh.normals != NULL)
+        {
+            part.normals = (float *)RL_MALLOC(vertexCount*3*sizeof(float));
+            for (int i = 0; i < vertexCount; i++) memcpy(part.normals + i*3, mesh.normals + chunkVertices[i]*3, 3*sizeof(float));
+        }
+
+        if (mesh.tangents != NULL)
+        {
+            part.tangents = (float *)RL_MALLOC(vertexCount*4*sizeof(float));
+            for (int i = 0; i < vertexCount; i++) memcpy(part.tangents + i*4, mesh.tangents + chunkVertices[i]*4, 4*sizeof(float));
+        }
+
+        if (mesh.colors != NULL)
+        {
+            part.colors = (unsigned char *)RL_MALLOC(vertexCount*4*sizeof(unsigned char));
+            for (int i = 0; i < vertexCount; i++) memcpy(part.colors + i*4, mesh.colors + chunkVertices[i]*4, 4*sizeof(unsigned char));
+        }
+
+        part.indices = (unsigned short *)RL_MALLOC(triangleCount*3*sizeof(unsigned short));
+        memcpy(part.indices, chunkIndices, triangleCount*3*sizeof(unsigned short));
+
+        // Upload chunk data to GPU (VRAM), chunk bounds are computed
+        if (isGpuReady) UploadMesh(&part, false);
+
+        meshes[chunk] = part;
+        (*meshCount)++;
+    }
+
+    RL_FREE(remap);
+    RL_FREE(remapChunk);
+    RL_FREE(chunkVertices);
+    RL_FREE(chunkIndices);
+    RL_FREE(order);
+
+    TRACELOG(LOG_INFO, "MESH: Mesh split into %i chunks (max vertices: %i, max triangles: %i)", *meshCount, maxVertices, maxTriangles);
+
+    return meshes;
+}
+
+// Draw a model (with texture if set)
+void DrawModel(Model model, Vector3 position, float scale, Color tint)
+{
+    Vector3 vScale = { scale, scale, scale };
+    Vector3 rotationAxis = { 0.0f, 1.0f, 0.0f };
+
+    DrawModelEx(model, position, rotationAxis, 0.0f, vScale, tint);
+}
+
+// Draw a model with extended parameters
+void DrawModelEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint)
+{
+    // Calculate transformation matrix from function parameters
+    // Get transform matrix (rotation -> scale -> translation)
+    Matrix matScale = MatrixScale(scale.x, scale.y, scale.z);
+    Matrix matRotation = MatrixRotate(rotationAxis, rotationAngle*DEG2RAD);
+    Matrix matTranslation = MatrixTranslate(position.x, position.y, position.z);
+
+    Matrix matTransform = MatrixMultiply(MatrixMultiply(matScale, matRotation), matTranslation);
+
+    // Combine model transformation matrix (model.transform) with matrix generated by function parameters (matTransform)
+    model.transform = MatrixMultiply(model.transform, matTransform);
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        Color color = model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color;
+
+        Color colorTint = WHITE;
+        colorTint.r = (unsigned char)(((int)color.r*(int)tint.r)/255);
+        colorTint.g = (unsigned char)(((int)color.g*(int)tint.g)/255);
+        colorTint.b = (unsigned char)(((int)color.b*(int)tint.b)/255);
+        colorTint.a = (unsigned char)(((int)color.a*(int)tint.a)/255);
+
+        model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color = colorTint;
+        DrawMesh(model.meshes[i], model.materials[model.meshMaterial[i]], model.transform);
+        model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color = color;
+    }
+}
+
+// Draw a model wires (with texture if set)
+void DrawModelWires(Model model, Vector3 position, float scale, Color tint)
+{
+    rlEnableWireMode();
+
+    DrawModel(model, position, scale, tint);
+
+    rlDisableWireMode();
+}
+
+// Draw a model wires (with texture if set) with extended parameters
+void DrawModelWiresEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint)
+{
+    rlEnableWireMode();
+
+    DrawModelEx(model, position, rotationAxis, rotationAngle, scale, tint);
+
+    rlDisableWireMode();
+}
+
+// Draw a model points
+void DrawModelPoints(Model model, Vector3 position, float scale, Color tint)
+{
+    rlEnablePointMode();
+    rlDisableBackfaceCulling();
+
+    DrawModel(model, position, scale, tint);
+
+    rlEnableBackfaceCulling();
+    rlDisableWireMode();
+}
+
+// Draw a model points
+void DrawModelPointsEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint)
+{
+    rlEnablePointMode();
+    rlDisableBackfaceCulling();
+
+    DrawModelEx(model, position, rotationAxis, rotationAngle, scale, tint);
+
+    rlEnableBackfaceCulling();
+    rlDisableWireMode();
+}
+
+// Draw a billboard
+void DrawBillboard(Camera camera, Texture2D texture, Vector3 position, float scale, Color tint)
+{
+    Rectangle source = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+
+    DrawBillboardRec(camera, texture, source, position, (Vector2) { scale*fabsf((float)source.width/source.height), scale }, tint);
+}
+
+// Draw a billboard (part of a texture defined by a rectangle)
+void DrawBillboardRec(Camera camera, Texture2D texture, Rectangle source, Vector3 position, Vector2 size, Color tint)
+{
+    // NOTE: Billboard locked on axis-Y
+    Vector3 up = { 0.0f, 1.0f, 0.0f };
+
+    DrawBillboardPro(camera, texture, source, position, up, size, Vector2Scale(size, 0.5), 0.0f, tint);
+}
+
+// Draw a billboard with additional parameters
+void DrawBillboardPro(Camera camera, Texture2D texture, Rectangle source, Vector3 position, Vector3 up, Vector2 size, Vector2 origin, float rotation, Color tint)
+{
+    // Compute the up vector and the right vector
+    Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
+    Vector3 right = { matView.m0, matView.m4, matView.m8 };
+    right = Vector3Scale(right, size.x);
+    up = Vector3Scale(up, size.y);
+
+    // Flip the content of the billboard while maintaining the counterclockwise edge rendering order
+    if (size.x < 0.0f)
+    {
+        source.x += size.x;
+        source.width *= -1.0;
+        right = Vector3Negate(right);
+        origin.x *= -1.0f;
+    }
+    if (size.y < 0.0f)
+    {
+        source.y += size.y;
+        source.height *= -1.0;
+        up = Vector3Negate(up);
+        origin.y *= -1.0f;
+    }
+
+    // Draw the texture region described by source on the following rectangle in 3D space:
+    //
+    //                size.x          <--.
+    //  3 ^---------------------------+ 2 \ rotation
+    //    |                           |   /
+    //    |                           |
+    //    |   origin.x   position     |
+    // up |..............             | size.y
+    //    |             .             |
+    //    |             . origin.y    |
+    //    |             .             |
+    //  0 +---------------------------> 1
+    //                right
+    Vector3 forward;
+    if (rotation != 0.0) forward = Vector3CrossProduct(right, up);
+
+    Vector3 origin3D = Vector3Add(Vector3Scale(Vector3Normalize(right), origin.x), Vector3Scale(Vector3Normalize(up), origin.y));
+
+    Vector3 points[4];
+    points[0] = Vector3Zero();
+    points[1] = right;
+    points[2] = Vector3Add(up, right);
+    points[3] = up;
+
+    for (int i = 0; i < 4; i++)
+    {
+        points[i] = Vector3Subtract(points[i], origin3D);
+        if (rotation != 0.0) points[i] = Vector3RotateByAxisAngle(points[i], forward, rotation * DEG2RAD);
+        points[i] = Vector3Add(points[i], position);
+    }
+
+    Vector2 texcoords[4];
+    texcoords[0] = (Vector2) { (float)source.x/texture.width, (float)(source.y + source.height)/texture.height };
+    texcoords[1] = (Vector2) { (float)(source.x + source.width)/texture.width, (float)(source.y + source.height)/texture.height };
+    texcoords[2] = (Vector2) { (float)(source.x + source.width)/texture.width, (float)source.y/texture.height };
+    texcoords[3] = (Vector2) { (float)source.x/texture.width, (float)source.y/texture.height };
+
+    rlSetTexture(texture.id);
+    rlBegin(RL_QUADS);
+
+        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+        for (int i = 0; i < 4; i++)
+        {
+            rlTexCoord2f(texcoords[i].x, texcoords[i].y);
+            rlVertex3f(points[i].x, points[i].y, points[i].z);
+        }
+
+    rlEnd();
+    rlSetTexture(0);
+}
+
+// Draw a bounding box with wires
+void DrawBoundingBox(BoundingBox box, Color color)
+{
+    Vector3 size = { 0 };
+
+    size.x = fabsf(box.max.x - box.min.x);
+    size.y = fabsf(box.max.y - box.min.y);
+    size.z = fabsf(box.max.z - box.min.z);
+
+    Vector3 center = { box.min.x + size.x/2.0f, box.min.y + size.y/2.0f, box.min.z + size.z/2.0f };
+
+    DrawCubeWires(center, size.x, size.y, size.z, color);
+}
+
+// Check collision between two spheres
+bool CheckCollisionSpheres(Vector3 center1, float radius1, Vector3 center2, float radius2)
+{
+    bool collision = false;
+
+    // Simple way to check for collision, just checking distance between two points
+    // Unfortunately, sqrtf() is a costly operation, so we avoid it with following solution
+    /*
+    float dx = center1.x - center2.x;      // X distance between centers
+    float dy = center1.y - center2.y;      // Y distance between centers
+    float dz = center1.z - center2.z;      // Z distance between centers
+
+    float distance = sqrtf(dx*dx + dy*dy + dz*dz);  // Distance between centers
+
+    if (distance <= (radius1 + radius2)) collision = true;
+    */
+
+    // Check for distances squared to avoid sqrtf()
+    if (Vector3DotProduct(Vector3Subtract(center2, center1), Vector3Subtract(center2, center1)) <= (radius1 + radius2)*(radius1 + radius2)) collision = true;
+
+    return collision;
+}
+
+// Check collision between two boxes
+// NOTE: Boxes are defined by two points minimum and maximum
+bool CheckCollisionBoxes(BoundingBox box1, BoundingBox box2)
+{
+    bool collision = true;
+
+    if ((box1.max.x >= box2.min.x) && (box1.min.x <= box2.max.x))
     {
-        source.y += size.y;
-        source.height *= -1.0;
-        up = Vector3Negate(up);
-        origin.y *= -1.0f;
+        if ((box1.max.y < box2.min.y) || (box1.min.y > box2.max.y)) collision = false;
+        if ((box1.max.z < box2.min.z) || (box1.min.z > box2.max.z)) collision = false;
+    }
+    else collision = false;
+
+    return collision;
+}
+
+// Check collision between frustum and box (box inside or intersecting)
+// NOTE: Test is conservative, some boxes outside the frustum close to its corners are not discarded
+bool CheckCollisionFrustumBox(Frustum frustum, BoundingBox box)
+{
+    bool collision = true;
+
+    for (int i = 0; i < 6; i++)
+    {
+        Vector4 plane = frustum.planes[i];
+
+        // Check box corner farthest along plane normal (positive vertex)
+        float distance = plane.x*((plane.x >= 0.0f)? box.max.x : box.min.x) +
+                         plane.y*((plane.y >= 0.0f)? box.max.y : box.min.y) +
+                         plane.z*((plane.z >= 0.0f)? box.max.z : box.min.z) + plane.w;
+
+        if (distance < 0.0f)
+        {
+            collision = false;
+            break;
+        }
+    }
+
+    return collision;
+}
+
+// Check collision between frustum and sphere (sphere inside or intersecting)
+bool CheckCollisionFrustumSphere(Frustum frustum, Vector3 center, float radius)
+{
+    bool collision = true;
+
+    for (int i = 0; i < 6; i++)
+    {
+        Vector4 plane = frustum.planes[i];
+
+        if ((plane.x*center.x + plane.y*center.y + plane.z*center.z + plane.w) < -radius)
+        {
+            collision = false;
+            break;
+        }
+    }
+
+    return collision;
+}
+
+// Check collision between box and sphere
+bool CheckCollisionBoxSphere(BoundingBox box, Vector3 center, float radius)
+{
+    bool collision = false;
+
+    float dmin = 0;
+
+    if (center.x < box.min.x) dmin += powf(center.x - box.min.x, 2);
+    else if (center.x > box.max.x) dmin += powf(center.x - box.max.x, 2);
+
+    if (center.y < box.min.y) dmin += powf(center.y - box.min.y, 2);
+    else if (center.y > box.max.y) dmin += powf(center.y - box.max.y, 2);
+
+    if (center.z < box.min.z) dmin += powf(center.z - box.min.z, 2);
+    else if (center.z > box.max.z) dmin += powf(center.z - box.max.z, 2);
+
+    if (dmin <= (radius*radius)) collision = true;
+
+    return collision;
+}
+
+// Get collision info between ray and sphere
+RayCollision GetRayCollisionSphere(Ray ray, Vector3 center, float radius)
+{
+    RayCollision collision = { 0 };
+
+    Vector3 raySpherePos = Vector3Subtract(center, ray.position);
+    float vector = Vector3DotProduct(raySpherePos, ray.direction);
+    float distance = Vector3Length(raySpherePos);
+    float d = radius*radius - (distance*distance - vector*vector);
+
+    collision.hit = d >= 0.0f;
+
+    // Check if ray origin is inside the sphere to calculate the correct collision point
+    if (distance < radius)
+    {
+        collision.distance = vector + sqrtf(d);
+
+        // Calculate collision point
+        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+
+        // Calculate collision normal (pointing outwards)
+        collision.normal = Vector3Negate(Vector3Normalize(Vector3Subtract(collision.point, center)));
+    }
+    else
+    {
+        collision.distance = vector - sqrtf(d);
+
+        // Calculate collision point
+        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+
+        // Calculate collision normal (pointing inwards)
+        collision.normal = Vector3Normalize(Vector3Subtract(collision.point, center));
+    }
+
+    return collision;
+}
+
+// Get collision info between ray and box
+RayCollision GetRayCollisionBox(Ray ray, BoundingBox box)
+{
+    RayCollision collision = { 0 };
+
+    // Note: If ray.position is inside the box, the distance is negative (as if the ray was reversed)
+    // Reversing ray.direction will give use the correct result
+    bool insideBox = (ray.position.x > box.min.x) && (ray.position.x < box.max.x) &&
+                     (ray.position.y > box.min.y) && (ray.position.y < box.max.y) &&
+                     (ray.position.z > box.min.z) && (ray.position.z < box.max.z);
+
+    if (insideBox) ray.direction = Vector3Negate(ray.direction);
+
+    float t[11] = { 0 };
+
+    t[8] = 1.0f/ray.direction.x;
+    t[9] = 1.0f/ray.direction.y;
+    t[10] = 1.0f/ray.direction.z;
+
+    t[0] = (box.min.x - ray.position.x)*t[8];
+    t[1] = (box.max.x - ray.position.x)*t[8];
+    t[2] = (box.min.y - ray.position.y)*t[9];
+    t[3] = (box.max.y - ray.position.y)*t[9];
+    t[4] = (box.min.z - ray.position.z)*t[10];
+    t[5] = (box.max.z - ray.position.z)*t[10];
+    t[6] = (float)fmax(fmax(fmin(t[0], t[1]), fmin(t[2], t[3])), fmin(t[4], t[5]));
+    t[7] = (float)fmin(fmin(fmax(t[0], t[1]), fmax(t[2], t[3])), fmax(t[4], t[5]));
+
+    collision.hit = !((t[7] < 0) || (t[6] > t[7]));
+    collision.distance = t[6];
+    collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+
+    // Get box center point
+    collision.normal = Vector3Lerp(box.min, box.max, 0.5f);
+    // Get vector center point->hit point
+    collision.normal = Vector3Subtract(collision.point, collision.normal);
+    // Scale vector to unit cube
+    // NOTE: We use an additional .01 to fix numerical errors
+    collision.normal = Vector3Scale(collision.normal, 2.01f);
+    collision.normal = Vector3Divide(collision.normal, Vector3Subtract(box.max, box.min));
+    // The relevant elements of the vector are now slightly larger than 1.0f (or smaller than -1.0f)
+    // and the others are somewhere between -1.0 and 1.0 casting to int is exactly our wanted normal!
+    collision.normal.x = (float)((int)collision.normal.x);
+    collision.normal.y = (float)((int)collision.normal.y);
+    collision.normal.z = (float)((int)collision.normal.z);
+
+    collision.normal = Vector3Normalize(collision.normal);
+
+    if (insideBox)
+    {
+        // Reset ray.direction
+        ray.direction = Vector3Negate(ray.direction);
+        // Fix result
+        collision.distance *= -1.0f;
+        collision.normal = Vector3Negate(collision.normal);
+    }
+
+    return collision;
+}
+
+// Get collision info between ray and mesh
+RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
+{
+    RayCollision collision = { 0 };
+
+    // Check if mesh vertex data on CPU for testing
+    if (mesh.vertices != NULL)
+    {
+        int triangleCount = mesh.triangleCount;
+
+        // Test against all triangles in mesh
+        for (int i = 0; i < triangleCount; i++)
+        {
+            Vector3 a, b, c;
+            Vector3* vertdata = (Vector3*)mesh.vertices;
+
+            if ((mesh.indices != NULL) || (mesh.indices32 != NULL))
+            {
+                a = vertdata[GetMeshIndex(&mesh, i*3 + 0)];
+                b = vertdata[GetMeshIndex(&mesh, i*3 + 1)];
+                c = vertdata[GetMeshIndex(&mesh, i*3 + 2)];
+            }
+            else
+            {
+                a = vertdata[i*3 + 0];
+                b = vertdata[i*3 + 1];
+                c = vertdata[i*3 + 2];
+            }
+
+            a = Vector3Transform(a, transform);
+            b = Vector3Transform(b, transform);
+            c = Vector3Transform(c, transform);
+
+            RayCollision triHitInfo = GetRayCollisionTriangle(ray, a, b, c);
+
+            if (triHitInfo.hit)
+            {
+                // Save the closest hit triangle
+                if ((!collision.hit) || (collision.distance > triHitInfo.distance)) collision = triHitInfo;
+            }
+        }
+    }
+
+    return collision;
+}
+
+// Get collision info between ray and triangle
+// NOTE: The points are expected to be in counter-clockwise winding
+// NOTE: Based on https://en.wikipedia.org/wiki/M%C3%B6ller%E2%80%93Trumbore_intersection_algorithm
+RayCollision GetRayCollisionTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3)
+{
+    #define EPSILON 0.000001f        // A small number
+
+    RayCollision collision = { 0 };
+    Vector3 edge1 = { 0 };
+    Vector3 edge2 = { 0 };
+    Vector3 p, q, tv;
+    float det, invDet, u, v, t;
+
+    // Find vectors for two edges sharing V1
+    edge1 = Vector3Subtract(p2, p1);
+    edge2 = Vector3Subtract(p3, p1);
+
+    // Begin calculating determinant - also used to calculate u parameter
+    p = Vector3CrossProduct(ray.direction, edge2);
+
+    // If determinant is near zero, ray lies in plane of triangle or ray is parallel to plane of triangle
+    det = Vector3DotProduct(edge1, p);
+
+    // Avoid culling!
+    if ((det > -EPSILON) && (det < EPSILON)) return collision;
+
+    invDet = 1.0f/det;
+
+    // Calculate distance from V1 to ray origin
+    tv = Vector3Subtract(ray.position, p1);
+
+    // Calculate u parameter and test bound
+    u = Vector3DotProduct(tv, p)*invDet;
+
+    // The intersection lies outside the triangle
+    if ((u < 0.0f) || (u > 1.0f)) return collision;
+
+    // Prepare to test v parameter
+    q = Vector3CrossProduct(tv, edge1);
+
+    // Calculate V parameter and test bound
+    v = Vector3DotProduct(ray.direction, q)*invDet;
+
+    // The intersection lies outside the triangle
+    if ((v < 0.0f) || ((u + v) > 1.0f)) return collision;
+
+    t = Vector3DotProduct(edge2, q)*invDet;
+
+    if (t > EPSILON)
+    {
+        // Ray hit, get hit point and normal
+        collision.hit = true;
+        collision.distance = t;
+        collision.normal = Vector3Normalize(Vector3CrossProduct(edge1, edge2));
+        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, t));
     }
 
-    // Draw the texture region described by source on the following rectangle in 3D space:
-    //
-    //                size.x          <--.
-    //  3 ^---------------------------+ 2 \ rotation
-    //    |                           |   /
-    //    |                           |
-    //    |   origin.x   position     |
-    // up |..............             | size.y
-    //    |             .             |
-    //    |             . origin.y    |
-    //    |             .             |
-    //  0 +---------------------------> 1
-    //                right
-    Vector3 forward;
-    if (rotation != 0.0) forward = Vector3CrossProduct(right, up);
+    return collision;
+}
 
-    Vector3 origin3D = Vector3Add(Vector3Scale(Vector3Normalize(right), origin.x), Vector3Scale(Vector3Normalize(up), origin.y));
+// Get collision info between ray and quad
+// NOTE: The points are expected to be in counter-clockwise winding
+RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Vector3 p4)
+{
+    RayCollision collision = { 0 };
 
-    Vector3 points[4];
-    points[0] = Vector3Zero();
-    points[1] = right;
-    points[2] = Vector3Add(up, right);
-    points[3] = up;
+    collision = GetRayCollisionTriangle(ray, p1, p2, p4);
 
-    for (int i = 0; i < 4; i++)
+    if (!collision.hit) collision = GetRayCollisionTriangle(ray, p2, p3, p4);
+
+    return collision;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Get normal matrix for model matrix: transpose(inverse(matModel))
+// NOTE: Matrix inversion is only computed again when model matrix changes,
+// usually the same model matrix is used for all the meshes of a model
+static Matrix GetMatrixNormal(Matrix matModel)
+{
+    if (!matNormalReady || (memcmp(&matNormalModel, &matModel, sizeof(Matrix)) != 0))
     {
-        points[i] = Vector3Subtract(points[i], origin3D);
-        if (rotation != 0.0) points[i] = Vector3RotateByAxisAngle(points[i], forward, rotation * DEG2RAD);
-        points[i] = Vector3Add(points[i], position);
+        matNormalModel = matModel;
+        matNormalCached = MatrixTranspose(MatrixInvert(matModel));
+        matNormalReady = true;
     }
 
-    Vector2 texcoords[4];
-    texcoords[0] = (Vector2) { (float)source.x/texture.width, (float)(source.y + source.height)/texture.height };
-    texcoords[1] = (Vector2) { (float)(source.x + source.width)/texture.width, (float)(source.y + source.height)/texture.height };
-    texcoords[2] = (Vector2) { (float)(source.x + source.width)/texture.width, (float)source.y/texture.height };
-    texcoords[3] = (Vector2) { (float)source.x/texture.width, (float)source.y/texture.height };
+    return matNormalCached;
+}
 
-    rlSetTexture(texture.id);
-    rlBegin(RL_QUADS);
+// Set instance buffer attributes for shader locations, starting at required instance
+// NOTE: Attributes are set for currently bound mesh VAO (or global state if VAO not supported)
+static void SetInstanceBufferAttributes(InstanceBuffer buffer, Shader shader, int offset, bool enable)
+{
+    if (buffer.id == 0) return;
 
-        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
-        for (int i = 0; i < 4; i++)
+    if (enable) rlEnableVertexBuffer(buffer.id);
+
+    for (unsigned int attrib = INSTANCE_ATTRIB_TRANSFORM; attrib <= INSTANCE_ATTRIB_LAST; attrib <<= 1)
+    {
+        if ((buffer.attributes & attrib) == 0) continue;
+
+        int size = GetInstanceAttributeSize(attrib);
+        int dataOffset = GetInstanceAttributeOffset(buffer, attrib) + offset*size;
+
+        // Attribute locations and components per location: type, components, normalized, offset
+        int locs[4] = { -1, -1, -1, -1 };
+        int types[4] = { RL_FLOAT, RL_FLOAT, RL_FLOAT, RL_FLOAT };
+        bool normalized[4] = { false, false, false, false };
+        int offsets[4] = { 0 };
+        int locCount = 1;
+
+        switch (attrib)
         {
-            rlTexCoord2f(texcoords[i].x, texcoords[i].y);
-            rlVertex3f(points[i].x, points[i].y, points[i].z);
+            case INSTANCE_ATTRIB_TRANSFORM:
+            {
+                // Transform matrix is sent to 4 consecutive locations (one per column)
+                if (shader.locs[SHADER_LOC_MATRIX_MODEL] != -1)
+                {
+                    for (int i = 0; i < 4; i++)
+                    {
+                        locs[i] = shader.locs[SHADER_LOC_MATRIX_MODEL] + i;
+                        offsets[i] = i*sizeof(Vector4);
+                    }
+                }
+                locCount = 4;
+            } break;
+            case INSTANCE_ATTRIB_TRANSFORM_QUANTIZED:
+            {
+                locs[0] = shader.locs[SHADER_LOC_INSTANCE_POSITION];
+                locs[1] = shader.locs[SHADER_LOC_INSTANCE_ROTATION];
+                types[1] = RL_SHORT;
+                normalized[1] = true;
+                offsets[1] = 4*sizeof(float);
+                locCount = 2;
+            } break;
+            case INSTANCE_ATTRIB_COLOR:
+            {
+                locs[0] = shader.locs[SHADER_LOC_INSTANCE_COLOR];
+                types[0] = RL_UNSIGNED_BYTE;
+                normalized[0] = true;
+            } break;
+            case INSTANCE_ATTRIB_TEXRECT: locs[0] = shader.locs[SHADER_LOC_INSTANCE_TEXRECT]; break;
+            case INSTANCE_ATTRIB_CUSTOM0: locs[0] = shader.locs[SHADER_LOC_INSTANCE_CUSTOM]; break;
+            case INSTANCE_ATTRIB_CUSTOM1: if (shader.locs[SHADER_LOC_INSTANCE_CUSTOM] != -1) locs[0] = shader.locs[SHADER_LOC_INSTANCE_CUSTOM] + 1; break;
+            default: break;
         }
 
-    rlEnd();
-    rlSetTexture(0);
+        for (int i = 0; i < locCount; i++)
+        {
+            if (locs[i] == -1) continue;
+
+            if (enable)
+            {
+                rlEnableVertexAttribute(locs[i]);
+                rlSetVertexAttribute(locs[i], 4, types[i], normalized[i], size, dataOffset + offsets[i]);
+                rlSetVertexAttributeDivisor(locs[i], 1);
+            }
+            else
+            {
+                rlSetVertexAttributeDivisor(locs[i], 0);
+                rlDisableVertexAttribute(locs[i]);
+            }
+        }
+    }
+
+    if (enable) rlDisableVertexBuffer();
 }
+#endif
 
-// Draw a bounding box with wires
-void DrawBoundingBox(BoundingBox box, Color color)
+// Get instance attribute data size (per instance)
+static int GetInstanceAttributeSize(unsigned int attribute)
 {
-    Vector3 size = { 0 };
+    int size = 0;
 
-    size.x = fabsf(box.max.x - box.min.x);
-    size.y = fabsf(box.max.y - box.min.y);
-    size.z = fabsf(box.max.z - box.min.z);
+    switch (attribute)
+    {
+        case INSTANCE_ATTRIB_TRANSFORM: size = 16*sizeof(float); break;
+        case INSTANCE_ATTRIB_TRANSFORM_QUANTIZED: size = 4*sizeof(float) + 4*sizeof(short); break;
+        case INSTANCE_ATTRIB_COLOR: size = 4*sizeof(unsigned char); break;
+        case INSTANCE_ATTRIB_TEXRECT:
+        case INSTANCE_ATTRIB_CUSTOM0:
+        case INSTANCE_ATTRIB_CUSTOM1: size = 4*sizeof(float); break;
+        default: break;
+    }
 
-    Vector3 center = { box.min.x + size.x/2.0f, box.min.y + size.y/2.0f, box.min.z + size.z/2.0f };
+    return size;
+}
 
-    DrawCubeWires(center, size.x, size.y, size.z, color);
+// Get instance attribute region offset in buffer
+// NOTE: Attributes regions are stored consecutively, in flags order
+static int GetInstanceAttributeOffset(InstanceBuffer buffer, unsigned int attribute)
+{
+    int offset = 0;
+
+    for (unsigned int attrib = INSTANCE_ATTRIB_TRANSFORM; attrib < attribute; attrib <<= 1)
+    {
+        if (buffer.attributes & attrib) offset += buffer.capacity*GetInstanceAttributeSize(attrib);
+    }
+
+    return offset;
 }
 
-// Check collision between two spheres
-bool CheckCollisionSpheres(Vector3 center1, float radius1, Vector3 center2, float radius2)
+// Get frustum planes from (model-)view-projection matrix
+// NOTE: Planes are defined in matrix input space and normalized, i.e. world space for view-projection matrix
+static Frustum GetMatrixFrustum(Matrix mat)
 {
-    bool collision = false;
+    Frustum frustum = { 0 };
 
-    // Simple way to check for collision, just checking distance between two points
-    // Unfortunately, sqrtf() is a costly operation, so we avoid it with following solution
-    /*
-    float dx = center1.x - center2.x;      // X distance between centers
-    float dy = center1.y - center2.y;      // Y distance between centers
-    float dz = center1.z - center2.z;      // Z distance between centers
+    frustum.planes[0] = (Vector4){ mat.m3 + mat.m0, mat.m7 + mat.m4, mat.m11 + mat.m8, mat.m15 + mat.m12 };     // Left
+    frustum.planes[1] = (Vector4){ mat.m3 - mat.m0, mat.m7 - mat.m4, mat.m11 - mat.m8, mat.m15 - mat.m12 };     // Right
+    frustum.planes[2] = (Vector4){ mat.m3 + mat.m1, mat.m7 + mat.m5, mat.m11 + mat.m9, mat.m15 + mat.m13 };     // Bottom
+    frustum.planes[3] = (Vector4){ mat.m3 - mat.m1, mat.m7 - mat.m5, mat.m11 - mat.m9, mat.m15 - mat.m13 };     // Top
+    frustum.planes[4] = (Vector4){ mat.m3 + mat.m2, mat.m7 + mat.m6, mat.m11 + mat.m10, mat.m15 + mat.m14 };    // Near
+    frustum.planes[5] = (Vector4){ mat.m3 - mat.m2, mat.m7 - mat.m6, mat.m11 - mat.m10, mat.m15 - mat.m14 };    // Far
 
-    float distance = sqrtf(dx*dx + dy*dy + dz*dz);  // Distance between centers
+    for (int i = 0; i < 6; i++)
+    {
+        float length = sqrtf(frustum.planes[i].x*frustum.planes[i].x + frustum.planes[i].y*frustum.planes[i].y + frustum.planes[i].z*frustum.planes[i].z);
+        if (length > 0.0f)
+        {
+            float ilength = 1.0f/length;
+            frustum.planes[i].x *= ilength;
+            frustum.planes[i].y *= ilength;
+            frustum.planes[i].z *= ilength;
+            frustum.planes[i].w *= ilength;
+        }
+    }
 
-    if (distance <= (radius1 + radius2)) collision = true;
-    */
+    return frustum;
+}
 
-    // Check for distances squared to avoid sqrtf()
-    if (Vector3DotProduct(Vector3Subtract(center2, center1), Vector3Subtract(center2, center1)) <= (radius1 + radius2)*(radius1 + radius2)) collision = true;
+// Check if bounding box has been computed
+// NOTE: Zero box is considered not computed, flat and point boxes are valid
+static bool IsBoundingBoxValid(BoundingBox box)
+{
+    bool zero = (box.min.x == 0.0f) && (box.min.y == 0.0f) && (box.min.z == 0.0f) &&
+                (box.max.x == 0.0f) && (box.max.y == 0.0f) && (box.max.z == 0.0f);
 
-    return collision;
+    return (!zero && (box.min.x <= box.max.x) && (box.min.y <= box.max.y) && (box.min.z <= box.max.z));
 }
 
-// Check collision between two boxes
-// NOTE: Boxes are defined by two points minimum and maximum
-bool CheckCollisionBoxes(BoundingBox box1, BoundingBox box2)
+// Set mesh bounds as outdated, vertex positions buffer updated
+// NOTE: Current mesh bounds are stored, bounds are considered recomputed once they change
+static void SetMeshBoundsOutdated(Mesh mesh)
 {
-    bool collision = true;
+    if ((mesh.vboId == NULL) || (mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION] == 0)) return;
 
-    if ((box1.max.x >= box2.min.x) && (box1.min.x <= box2.max.x))
+    unsigned int vboId = mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION];
+
+    for (int i = 0; i < meshBoundsOutdatedCount; i++)
     {
-        if ((box1.max.y < box2.min.y) || (box1.min.y > box2.max.y)) collision = false;
-        if ((box1.max.z < box2.min.z) || (box1.min.z > box2.max.z)) collision = false;
+        if (meshBoundsOutdated[i].vboId == vboId)
+        {
+            meshBoundsOutdated[i].bounds = mesh.bounds;
+            return;
+        }
     }
-    else collision = false;
 
-    return collision;
+    meshBoundsOutdated = (MeshBoundsOutdated *)RL_REALLOC(meshBoundsOutdated, (meshBoundsOutdatedCount + 1)*sizeof(MeshBoundsOutdated));
+    meshBoundsOutdated[meshBoundsOutdatedCount++] = (MeshBoundsOutdated){ vboId, mesh.bounds };
 }
 
-// Check collision between box and sphere
-bool CheckCollisionBoxSphere(BoundingBox box, Vector3 center, float radius)
+// Check if mesh bounds are outdated, not recomputed since vertex positions buffer update
+static bool IsMeshBoundsOutdated(Mesh mesh)
 {
-    bool collision = false;
+    if ((meshBoundsOutdatedCount == 0) || (mesh.vboId == NULL)) return false;
 
-    float dmin = 0;
+    unsigned int vboId = mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION];
 
-    if (center.x < box.min.x) dmin += powf(center.x - box.min.x, 2);
-    else if (center.x > box.max.x) dmin += powf(center.x - box.max.x, 2);
+    for (int i = 0; i < meshBoundsOutdatedCount; i++)
+    {
+        if (meshBoundsOutdated[i].vboId == vboId)
+        {
+            if (memcmp(&meshBoundsOutdated[i].bounds, &mesh.bounds, sizeof(BoundingBox)) == 0) return true;
 
-    if (center.y < box.min.y) dmin += powf(center.y - box.min.y, 2);
-    else if (center.y > box.max.y) dmin += powf(center.y - box.max.y, 2);
+            // Mesh bounds have been recomputed, they can be used for culling again
+            RemoveMeshBoundsOutdated(vboId);
+            return false;
+        }
+    }
 
-    if (center.z < box.min.z) dmin += powf(center.z - box.min.z, 2);
-    else if (center.z > box.max.z) dmin += powf(center.z - box.max.z, 2);
+    return false;
+}
 
-    if (dmin <= (radius*radius)) collision = true;
+// Remove mesh from outdated bounds list, list is freed once empty
+static void RemoveMeshBoundsOutdated(unsigned int vboId)
+{
+    for (int i = 0; i < meshBoundsOutdatedCount; i++)
+    {
+        if (meshBoundsOutdated[i].vboId == vboId)
+        {
+            meshBoundsOutdated[i] = meshBoundsOutdated[--meshBoundsOutdatedCount];
+            break;
+        }
+    }
 
-    return collision;
+    if ((meshBoundsOutdatedCount == 0) && (meshBoundsOutdated != NULL))
+    {
+        RL_FREE(meshBoundsOutdated);
+        meshBoundsOutdated = NULL;
+    }
 }
 
-// Get collision info between ray and sphere
-RayCollision GetRayCollisionSphere(Ray ray, Vector3 center, float radius)
+// Get mesh vertex index (16-bit or 32-bit indices)
+static unsigned int GetMeshIndex(const Mesh *mesh, int index)
 {
-    RayCollision collision = { 0 };
+    return (mesh->indices32 != NULL)? mesh->indices32[index] : mesh->indices[index];
+}
 
-    Vector3 raySpherePos = Vector3Subtract(center, ray.position);
-    float vector = Vector3DotProduct(raySpherePos, ray.direction);
-    float distance = Vector3Length(raySpherePos);
-    float d = radius*radius - (distance*distance - vector*vector);
+// Optimize triangles order for post-transform vertex cache, returns clusters count
+// NOTE: Implementation of Tom Forsyth linear-speed vertex cache optimization algorithm,
+// clusters start at cache discontinuities, used later for overdraw optimization
+// Ref: https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html
+static int OptimizeVertexCache(unsigned int *indices, int indexCount, int vertexCount, int *clusters)
+{
+    #define FORSYTH_CACHE_SIZE  MESH_OPTIMIZE_CACHE_SIZE
+    #define FORSYTH_MAX_VALENCE 32
 
-    collision.hit = d >= 0.0f;
+    int triangleCount = indexCount/3;
+    int clusterCount = 0;
 
-    // Check if ray origin is inside the sphere to calculate the correct collision point
-    if (distance < radius)
+    if ((triangleCount <= 0) || (vertexCount <= 0)) return clusterCount;
+
+    // Vertex scores lookup tables by cache position and remaining valence
+    float cacheScores[FORSYTH_CACHE_SIZE] = { 0 };
+    float valenceScores[FORSYTH_MAX_VALENCE] = { 0 };
+
+    for (int i = 0; i < FORSYTH_CACHE_SIZE; i++)
     {
-        collision.distance = vector + sqrtf(d);
+        // Last triangle vertices get a fixed score, to avoid using them immediately again
+        if (i < 3) cacheScores[i] = 0.75f;
+        else cacheScores[i] = powf(1.0f - (float)(i - 3)/(FORSYTH_CACHE_SIZE - 3), 1.5f);
+    }
+    for (int i = 1; i < FORSYTH_MAX_VALENCE; i++) valenceScores[i] = 2.0f/sqrtf((float)i);
 
-        // Calculate collision point
-        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+    // Vertex triangles adjacency, alive triangles kept at the start of every vertex list
+    int *valences = (int *)RL_CALLOC((size_t)vertexCount, sizeof(int));
+    int *adjacencyOffsets = (int *)RL_CALLOC((size_t)vertexCount + 1, sizeof(int));
+    int *adjacency = (int *)RL_MALLOC((size_t)indexCount*sizeof(int));
 
-        // Calculate collision normal (pointing outwards)
-        collision.normal = Vector3Negate(Vector3Normalize(Vector3Subtract(collision.point, center)));
+    for (int i = 0; i < indexCount; i++) valences[indices[i]]++;
+    for (int i = 0; i < vertexCount; i++) adjacencyOffsets[i + 1] = adjacencyOffsets[i] + valences[i];
+    for (int i = 0; i < vertexCount; i++) valences[i] = 0;
+    for (int i = 0; i < indexCount; i++)
+    {
+        unsigned int v = indices[i];
+        adjacency[adjacencyOffsets[v] + valences[v]++] = i/3;
     }
-    else
+
+    int *cachePositions = (int *)RL_MALLOC((size_t)vertexCount*sizeof(int));
+    float *vertexScores = (float *)RL_MALLOC((size_t)vertexCount*sizeof(float));
+    float *triangleScores = (float *)RL_CALLOC((size_t)triangleCount, sizeof(float));
+    bool *emitted = (bool *)RL_CALLOC((size_t)triangleCount, sizeof(bool));
+    unsigned int *output = (unsigned int *)RL_MALLOC((size_t)indexCount*sizeof(unsigned int));
+
+    for (int i = 0; i < vertexCount; i++)
     {
-        collision.distance = vector - sqrtf(d);
+        cachePositions[i] = -1;
+        vertexScores[i] = (valences[i] > 0)? valenceScores[(valences[i] < FORSYTH_MAX_VALENCE)? valences[i] : FORSYTH_MAX_VALENCE - 1] : -1.0f;
+    }
 
-        // Calculate collision point
-        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+    for (int t = 0; t < triangleCount; t++)
+    {
+        triangleScores[t] = vertexScores[indices[t*3]] + vertexScores[indices[t*3 + 1]] + vertexScores[indices[t*3 + 2]];
+    }
+
+    int cache[FORSYTH_CACHE_SIZE + 3] = { 0 };
+    int cacheCount = 0;
+    int bestTriangle = -1;
+    int nextTriangle = 0;       // Next triangle to check when no candidates available in cache
+    int clusterMisses = 0;
+    int clusterStart = 0;
+
+    for (int t = 0; t < triangleCount; t++)
+    {
+        if (bestTriangle == -1)
+        {
+            // No cached vertex has triangles left, continue with next not emitted triangle
+            while (emitted[nextTriangle]) nextTriangle++;
+            bestTriangle = nextTriangle;
+            clusters[clusterCount++] = t;
+            clusterStart = t;
+            clusterMisses = 0;
+        }
+
+        const unsigned int *triangle = indices + bestTriangle*3;
+        int misses = 0;
+        for (int k = 0; k < 3; k++) if (cachePositions[triangle[k]] == -1) misses++;
+
+        // Start a new cluster where the cache order has a soft boundary,
+        // clusters are kept large enough to not hurt vertex cache efficiency
+        if ((t - clusterStart >= MESH_OPTIMIZE_CLUSTER_SIZE) && (misses >= 2) && (clusterMisses > (t - clusterStart)/2))
+        {
+            clusters[clusterCount++] = t;
+            clusterStart = t;
+            clusterMisses = 0;
+        }
+        clusterMisses += misses;
+
+        memcpy(output + t*3, triangle, 3*sizeof(unsigned int));
+        emitted[bestTriangle] = true;
+
+        // Remove triangle from its vertices alive triangles lists
+        for (int k = 0; k < 3; k++)
+        {
+            unsigned int v = triangle[k];
+            int *list = adjacency + adjacencyOffsets[v];
+
+            for (int j = 0; j < valences[v]; j++)
+            {
+                if (list[j] == bestTriangle)
+                {
+                    list[j] = list[valences[v] - 1];
+                    list[valences[v] - 1] = bestTriangle;
+                    break;
+                }
+            }
+
+            valences[v]--;
+        }
+
+        // Update cache: triangle vertices moved to front (LRU), cache temporarily grows by 3
+        int newCache[FORSYTH_CACHE_SIZE + 3] = { 0 };
+        int newCacheCount = 0;
+
+        for (int k = 0; k < 3; k++) newCache[newCacheCount++] = (int)triangle[k];
+        for (int k = 0; k < cacheCount; k++)
+        {
+            int v = cache[k];
+            if ((v != (int)triangle[0]) && (v != (int)triangle[1]) && (v != (int)triangle[2])) newCache[newCacheCount++] = v;
+        }
+
+        // Update vertices scores and their alive triangles scores, choose best candidate
+        float bestScore = -1.0f;
+        bestTriangle = -1;
+
+        for (int k = 0; k < newCacheCount; k++)
+        {
+            int v = newCache[k];
+            cachePositions[v] = (k < FORSYTH_CACHE_SIZE)? k : -1;
+
+            float score = -1.0f;
+            if (valences[v] > 0)
+            {
+                score = valenceScores[(valences[v] < FORSYTH_MAX_VALENCE)? valences[v] : FORSYTH_MAX_VALENCE - 1];
+                if (cachePositions[v] >= 0) score += cacheScores[cachePositions[v]];
+            }
+
+            float delta = score - vertexScores[v];
+            vertexScores[v] = score;
+
+            for (int j = 0; j < valences[v]; j++)
+            {
+                int tri = adjacency[adjacencyOffsets[v] + j];
+                triangleScores[tri] += delta;
+
+                if (triangleScores[tri] > bestScore)
+                {
+                    bestScore = triangleScores[tri];
+                    bestTriangle = tri;
+                }
+            }
+        }
+
+        cacheCount = (newCacheCount < FORSYTH_CACHE_SIZE)? newCacheCount : FORSYTH_CACHE_SIZE;
+        memcpy(cache, newCache, cacheCount*sizeof(int));
+    }
+
+    memcpy(indices, output, triangleCount*3*sizeof(unsigned int));
+    clusters[clusterCount] = triangleCount;
+
+    RL_FREE(valences);
+    RL_FREE(adjacencyOffsets);
+    RL_FREE(adjacency);
+    RL_FREE(cachePositions);
+    RL_FREE(vertexScores);
+    RL_FREE(triangleScores);
+    RL_FREE(emitted);
+    RL_FREE(output);
+
+    return clusterCount;
+}
+
+// Optimize triangles clusters order to reduce overdraw
+// NOTE: Clusters are sorted by their average normal facing away from mesh centroid,
+// outer facing clusters are drawn first to occlude the rest (view independent approximation)
+// Ref: Sander et al. 2007, Fast Triangle Reordering for Vertex Locality and Reduced Overdraw
+static void OptimizeOverdraw(unsigned int *indices, int indexCount, const float *vertices, const int *clusters, int clusterCount)
+{
+    if (clusterCount < 2) return;
+
+    MeshCluster *sorted = (MeshCluster *)RL_MALLOC(clusterCount*sizeof(MeshCluster));
+    Vector3 *centroids = (Vector3 *)RL_CALLOC(clusterCount, sizeof(Vector3));
+    Vector3 *normals = (Vector3 *)RL_CALLOC(clusterCount, sizeof(Vector3));
+    Vector3 meshCentroid = { 0 };
+    float meshArea = 0.0f;
+
+    // Compute area weighted clusters centroids and normals
+    for (int c = 0; c < clusterCount; c++)
+    {
+        float clusterArea = 0.0f;
+
+        for (int t = clusters[c]; t < clusters[c + 1]; t++)
+        {
+            Vector3 v0 = { vertices[indices[t*3]*3], vertices[indices[t*3]*3 + 1], vertices[indices[t*3]*3 + 2] };
+            Vector3 v1 = { vertices[indices[t*3 + 1]*3], vertices[indices[t*3 + 1]*3 + 1], vertices[indices[t*3 + 1]*3 + 2] };
+            Vector3 v2 = { vertices[indices[t*3 + 2]*3], vertices[indices[t*3 + 2]*3 + 1], vertices[indices[t*3 + 2]*3 + 2] };
+
+            Vector3 cross = Vector3CrossProduct(Vector3Subtract(v1, v0), Vector3Subtract(v2, v0));
+            float area = Vector3Length(cross);
+            Vector3 center = Vector3Scale(Vector3Add(Vector3Add(v0, v1), v2), area/3.0f);
+
+            centroids[c] = Vector3Add(centroids[c], center);
+            normals[c] = Vector3Add(normals[c], cross);
+            clusterArea += area;
+        }
+
+        meshCentroid = Vector3Add(meshCentroid, centroids[c]);
+        meshArea += clusterArea;
+        centroids[c] = (clusterArea > 0.0f)? Vector3Scale(centroids[c], 1.0f/clusterArea) : centroids[c];
+    }
+
+    if (meshArea > 0.0f) meshCentroid = Vector3Scale(meshCentroid, 1.0f/meshArea);
+
+    for (int c = 0; c < clusterCount; c++)
+    {
+        sorted[c].start = clusters[c];
+        sorted[c].count = clusters[c + 1] - clusters[c];
+        sorted[c].key = Vector3DotProduct(Vector3Subtract(centroids[c], meshCentroid), Vector3Normalize(normals[c]));
+    }
+
+    qsort(sorted, clusterCount, sizeof(MeshCluster), CompareMeshClusters);
 
-        // Calculate collision normal (pointing inwards)
-        collision.normal = Vector3Normalize(Vector3Subtract(collision.point, center));
+    // Rebuild index buffer with sorted clusters
+    unsigned int *output = (unsigned int *)RL_MALLOC(indexCount*sizeof(unsigned int));
+    int offset = 0;
+
+    for (int c = 0; c < clusterCount; c++)
+    {
+        memcpy(output + offset, indices + sorted[c].start*3, sorted[c].count*3*sizeof(unsigned int));
+        offset += sorted[c].count*3;
     }
 
-    return collision;
+    memcpy(indices, output, offset*sizeof(unsigned int));
+
+    RL_FREE(output);
+    RL_FREE(sorted);
+    RL_FREE(centroids);
+    RL_FREE(normals);
 }
 
-// Get collision info between ray and box
-RayCollision GetRayCollisionBox(Ray ray, BoundingBox box)
+// Compare mesh clusters for sorting, higher key first (stable by start)
+static int CompareMeshClusters(const void *a, const void *b)
 {
-    RayCollision collision = { 0 };
+    const MeshCluster *clusterA = (const MeshCluster *)a;
+    const MeshCluster *clusterB = (const MeshCluster *)b;
 
-    // Note: If ray.position is inside the box, the distance is negative (as if the ray was reversed)
-    // Reversing ray.direction will give use the correct result
-    bool insideBox = (ray.position.x > box.min.x) && (ray.position.x < box.max.x) &&
-                     (ray.position.y > box.min.y) && (ray.position.y < box.max.y) &&
-                     (ray.position.z > box.min.z) && (ray.position.z < box.max.z);
+    if (clusterA->key > clusterB->key) return -1;
+    if (clusterA->key < clusterB->key) return 1;
 
-    if (insideBox) ray.direction = Vector3Negate(ray.direction);
+    return clusterA->start - clusterB->start;
+}
 
-    float t[11] = { 0 };
+// Remap mesh vertices data to new positions, remap[oldIndex] = newIndex
+// NOTE: Vertices mapped to the same position are expected to be equal
+static void RemapMeshVertices(Mesh *mesh, const int *remap)
+{
+    void **attributes[10] = {
+        (void **)&mesh->vertices, (void **)&mesh->texcoords, (void **)&mesh->texcoords2, (void **)&mesh->normals,
+        (void **)&mesh->tangents, (void **)&mesh->colors, (void **)&mesh->boneIds, (void **)&mesh->boneWeights,
+        (void **)&mesh->animVertices, (void **)&mesh->animNormals
+    };
+    const int attributeSizes[10] = {
+        3*sizeof(float), 2*sizeof(float), 2*sizeof(float), 3*sizeof(float), 4*sizeof(float),
+        4*sizeof(unsigned char), 4*sizeof(unsigned char), 4*sizeof(float), 3*sizeof(float), 3*sizeof(float)
+    };
 
-    t[8] = 1.0f/ray.direction.x;
-    t[9] = 1.0f/ray.direction.y;
-    t[10] = 1.0f/ray.direction.z;
+    for (int a = 0; a < 10; a++)
+    {
+        unsigned char *data = (unsigned char *)*attributes[a];
+        if (data == NULL) continue;
 
-    t[0] = (box.min.x - ray.position.x)*t[8];
-    t[1] = (box.max.x - ray.position.x)*t[8];
-    t[2] = (box.min.y - ray.position.y)*t[9];
-    t[3] = (box.max.y - ray.position.y)*t[9];
-    t[4] = (box.min.z - ray.position.z)*t[10];
-    t[5] = (box.max.z - ray.position.z)*t[10];
-    t[6] = (float)fmax(fmax(fmin(t[0], t[1]), fmin(t[2], t[3])), fmin(t[4], t[5]));
-    t[7] = (float)fmin(fmin(fmax(t[0], t[1]), fmax(t[2], t[3])), fmax(t[4], t[5]));
+        unsigned char *remapped = (unsigned char *)RL_MALLOC(mesh->vertexCount*attributeSizes[a]);
+        for (int i = 0; i < mesh->vertexCount; i++) memcpy(remapped + remap[i]*attributeSizes[a], data + i*attributeSizes[a], attributeSizes[a]);
 
-    collision.hit = !((t[7] < 0) || (t[6] > t[7]));
-    collision.distance = t[6];
-    collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+        RL_FREE(data);
+        *attributes[a] = remapped;
+    }
+}
 
-    // Get box center point
-    collision.normal = Vector3Lerp(box.min, box.max, 0.5f);
-    // Get vector center point->hit point
-    collision.normal = Vector3Subtract(collision.point, collision.normal);
-    // Scale vector to unit cube
-    // NOTE: We use an additional .01 to fix numerical errors
-    collision.normal = Vector3Scale(collision.normal, 2.01f);
-    collision.normal = Vector3Divide(collision.normal, Vector3Subtract(box.max, box.min));
-    // The relevant elements of the vector are now slightly larger than 1.0f (or smaller than -1.0f)
-    // and the others are somewhere between -1.0 and 1.0 casting to int is exactly our wanted normal!
-    collision.normal.x = (float)((int)collision.normal.x);
-    collision.normal.y = (float)((int)collision.normal.y);
-    collision.normal.z = (float)((int)collision.normal.z);
+// Reload mesh vertex buffers in GPU after vertex data layout changed
+// NOTE: Only required if mesh was already uploaded, mesh is uploaded again with same vertex format and usage
+static void ReloadMeshBuffers(Mesh *mesh)
+{
+    if (mesh->vboId != NULL)
+    {
+        rlUnloadVertexArray(mesh->vaoId);
+        for (int i = 0; i < MAX_MESH_VERTEX_BUFFERS; i++) rlUnloadVertexBuffer(mesh->vboId[i]);
+        RL_FREE(mesh->vboId);
 
-    collision.normal = Vector3Normalize(collision.normal);
+        mesh->vaoId = 0;
+        mesh->vboId = NULL;
+        UploadMeshEx(mesh, mesh->dynamic, mesh->vertexFormat);
+    }
+}
 
-    if (insideBox)
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Get mesh vertex attribute format for GPU buffer, returns attribute size per vertex
+// NOTE: Attribute is one of the default shader attribute locations (RL_DEFAULT_SHADER_ATTRIB_LOCATION_*)
+static int GetMeshVertexAttributeFormat(int attribute, int vertexFormat, int *compSize, int *type, bool *normalized)
+{
+    int size = 0;
+    int count = 0;
+    int dataType = RL_FLOAT;
+    bool norm = false;
+
+    switch (attribute)
     {
-        // Reset ray.direction
-        ray.direction = Vector3Negate(ray.direction);
-        // Fix result
-        collision.distance *= -1.0f;
-        collision.normal = Vector3Negate(collision.normal);
+        case RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION:
+        {
+            // NOTE: Positions padded to 4 components, keeping attribute 4-byte aligned
+            if (vertexFormat & MESH_FORMAT_POSITION_INT16) { count = 4; dataType = RL_SHORT; norm = true; size = 4*sizeof(short); }
+            else { count = 3; size = 3*sizeof(float); }
+        } break;
+        case RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD:
+        case RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2:
+        {
+            count = 2;
+            if (vertexFormat & MESH_FORMAT_TEXCOORD_UNORM16) { dataType = RL_UNSIGNED_SHORT; norm = true; size = 2*sizeof(unsigned short); }
+            else size = 2*sizeof(float);
+        } break;
+        case RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL:
+        {
+            if (vertexFormat & MESH_FORMAT_NORMAL_INT8) { count = 4; dataType = RL_BYTE; norm = true; size = 4*sizeof(char); }
+            else { count = 3; size = 3*sizeof(float); }
+        } break;
+        case RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT:
+        {
+            count = 4;
+            if (vertexFormat & MESH_FORMAT_NORMAL_INT8) { dataType = RL_BYTE; norm = true; size = 4*sizeof(char); }
+            else size = 4*sizeof(float);
+        } break;
+        case RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS:
+        {
+            count = 4;
+            if (vertexFormat & MESH_FORMAT_BONEWEIGHT_UNORM8) { dataType = RL_UNSIGNED_BYTE; norm = true; size = 4*sizeof(unsigned char); }
+            else size = 4*sizeof(float);
+        } break;
+        default: break;
     }
 
-    return collision;
+    if (compSize != NULL) *compSize = count;
+    if (type != NULL) *type = dataType;
+    if (normalized != NULL) *normalized = norm;
+
+    return size;
 }
 
-// Get collision info between ray and mesh
-RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
+// Set mesh vertex attribute format for shader location (currently bound vertex buffer)
+static void SetMeshVertexAttribute(int location, int attribute, int vertexFormat)
 {
-    RayCollision collision = { 0 };
+    int compSize = 0;
+    int type = RL_FLOAT;
+    bool normalized = false;
 
-    // Check if mesh vertex data on CPU for testing
-    if (mesh.vertices != NULL)
+    GetMeshVertexAttributeFormat(attribute, vertexFormat, &compSize, &type, &normalized);
+    rlSetVertexAttribute(location, compSize, type, normalized, 0, 0);
+}
+
+// Load mesh vertex attribute data in compact format, NULL if attribute is uploaded as float
+// NOTE: Normalized values are rounded to nearest, data must be freed by caller
+static void *LoadMeshVertexDataCompact(const Mesh *mesh, int attribute, int vertexFormat)
+{
+    void *data = NULL;
+
+    switch (attribute)
     {
-        int triangleCount = mesh.triangleCount;
+        case RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION:
+        {
+            if ((vertexFormat & MESH_FORMAT_POSITION_INT16) && (mesh->vertices != NULL))
+            {
+                Vector4 dequantize = GetMeshDequantize(*mesh);
+                short *positions = (short *)RL_CALLOC(mesh->vertexCount*4, sizeof(short));
 
-        // Test against all triangles in mesh
-        for (int i = 0; i < triangleCount; i++)
+                for (int i = 0; i < mesh->vertexCount; i++)
+                {
+                    positions[i*4] = (short)roundf(Clamp((mesh->vertices[i*3] - dequantize.x)/dequantize.w, -1.0f, 1.0f)*32767.0f);
+                    positions[i*4 + 1] = (short)roundf(Clamp((mesh->vertices[i*3 + 1] - dequantize.y)/dequantize.w, -1.0f, 1.0f)*32767.0f);
+                    positions[i*4 + 2] = (short)roundf(Clamp((mesh->vertices[i*3 + 2] - dequantize.z)/dequantize.w, -1.0f, 1.0f)*32767.0f);
+                }
+
+                data = positions;
+            }
+        } break;
+        case RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD:
+        case RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2:
         {
-            Vector3 a, b, c;
-            Vector3* vertdata = (Vector3*)mesh.vertices;
+            const float *texcoords = (attribute == RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD)? mesh->texcoords : mesh->texcoords2;
 
-            if (mesh.indices)
+            if ((vertexFormat & MESH_FORMAT_TEXCOORD_UNORM16) && (texcoords != NULL))
             {
-                a = vertdata[mesh.indices[i*3 + 0]];
-                b = vertdata[mesh.indices[i*3 + 1]];
-                c = vertdata[mesh.indices[i*3 + 2]];
+                unsigned short *coords = (unsigned short *)RL_MALLOC(mesh->vertexCount*2*sizeof(unsigned short));
+                for (int i = 0; i < mesh->vertexCount*2; i++) coords[i] = (unsigned short)roundf(Clamp(texcoords[i], 0.0f, 1.0f)*65535.0f);
+
+                data = coords;
             }
-            else
+        } break;
+        case RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL:
+        case RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT:
+        {
+            // NOTE: Normals padded to 4 components, tangents keep handedness in w component
+            int components = (attribute == RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL)? 3 : 4;
+            const float *vectors = (attribute == RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL)? mesh->normals : mesh->tangents;
+
+            if ((vertexFormat & MESH_FORMAT_NORMAL_INT8) && (vectors != NULL))
             {
-                a = vertdata[i*3 + 0];
-                b = vertdata[i*3 + 1];
-                c = vertdata[i*3 + 2];
+                signed char *packed = (signed char *)RL_CALLOC(mesh->vertexCount*4, sizeof(signed char));
+
+                for (int i = 0; i < mesh->vertexCount; i++)
+                {
+                    for (int c = 0; c < components; c++) packed[i*4 + c] = (signed char)roundf(Clamp(vectors[i*components + c], -1.0f, 1.0f)*127.0f);
+                }
+
+                data = packed;
             }
+        } break;
+        case RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS:
+        {
+            if ((vertexFormat & MESH_FORMAT_BONEWEIGHT_UNORM8) && (mesh->boneWeights != NULL))
+            {
+                unsigned char *weights = (unsigned char *)RL_MALLOC(mesh->vertexCount*4*sizeof(unsigned char));
 
-            a = Vector3Transform(a, transform);
-            b = Vector3Transform(b, transform);
-            c = Vector3Transform(c, transform);
+                for (int i = 0; i < mesh->vertexCount; i++)
+                {
+                    // Quantized weights are adjusted to keep their sum to 1.0 (255), largest weight absorbs the rounding error
+                    int sum = 0;
+                    int largest = 0;
 
-            RayCollision triHitInfo = GetRayCollisionTriangle(ray, a, b, c);
+                    for (int w = 0; w < 4; w++)
+                    {
+                        weights[i*4 + w] = (unsigned char)roundf(Clamp(mesh->boneWeights[i*4 + w], 0.0f, 1.0f)*255.0f);
+                        sum += weights[i*4 + w];
+                        if (weights[i*4 + w] > weights[i*4 + largest]) largest = w;
+                    }
 
-            if (triHitInfo.hit)
-            {
-                // Save the closest hit triangle
-                if ((!collision.hit) || (collision.distance > triHitInfo.distance)) collision = triHitInfo;
+                    if ((sum > 0) && (sum != 255)) weights[i*4 + largest] = (unsigned char)Clamp((float)(weights[i*4 + largest] + 255 - sum), 0.0f, 255.0f);
+                }
+
+                data = weights;
             }
-        }
+        } break;
+        default: break;
     }
 
-    return collision;
+    return data;
 }
 
-// Get collision info between ray and triangle
-// NOTE: The points are expected to be in counter-clockwise winding
-// NOTE: Based on https://en.wikipedia.org/wiki/M%C3%B6ller%E2%80%93Trumbore_intersection_algorithm
-RayCollision GetRayCollisionTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3)
+// Get mesh positions dequantization offset (xyz) and scale (w), computed on UploadMeshEx()
+// NOTE: Returns identity dequantization (scale 1.0) if mesh positions are not quantized
+static Vector4 GetMeshDequantize(Mesh mesh)
 {
-    #define EPSILON 0.000001f        // A small number
+    Vector4 dequantize = { 0.0f, 0.0f, 0.0f, 1.0f };
 
-    RayCollision collision = { 0 };
-    Vector3 edge1 = { 0 };
-    Vector3 edge2 = { 0 };
-    Vector3 p, q, tv;
-    float det, invDet, u, v, t;
+    if ((mesh.vertexFormat & MESH_FORMAT_POSITION_INT16) && (mesh.dequantize.w > 0.0f)) dequantize = mesh.dequantize;
 
-    // Find vectors for two edges sharing V1
-    edge1 = Vector3Subtract(p2, p1);
-    edge2 = Vector3Subtract(p3, p1);
+    return dequantize;
+}
+#endif
 
-    // Begin calculating determinant - also used to calculate u parameter
-    p = Vector3CrossProduct(ray.direction, edge2);
+// Remove degenerate triangles (repeated vertex positions) from indices, returns triangles count
+static int RemoveDegenerateTriangles(unsigned int *indices, int triangleCount, const int *positionIds)
+{
+    int count = 0;
 
-    // If determinant is near zero, ray lies in plane of triangle or ray is parallel to plane of triangle
-    det = Vector3DotProduct(edge1, p);
+    for (int t = 0; t < triangleCount; t++)
+    {
+        int p0 = positionIds[indices[t*3]];
+        int p1 = positionIds[indices[t*3 + 1]];
+        int p2 = positionIds[indices[t*3 + 2]];
 
-    // Avoid culling!
-    if ((det > -EPSILON) && (det < EPSILON)) return collision;
+        if ((p0 != p1) && (p1 != p2) && (p2 != p0))
+        {
+            if (count != t) memcpy(indices + count*3, indices + t*3, 3*sizeof(unsigned int));
+            count++;
+        }
+    }
 
-    invDet = 1.0f/det;
+    return count;
+}
 
-    // Calculate distance from V1 to ray origin
-    tv = Vector3Subtract(ray.position, p1);
+// Get number of triangles sharing edge between positions a and b
+static int GetEdgeTrianglesCount(const unsigned int *indices, const int *positionIds, const int *adjacency, const int *adjacencyOffsets, int a, int b)
+{
+    int count = 0;
 
-    // Calculate u parameter and test bound
-    u = Vector3DotProduct(tv, p)*invDet;
+    for (int j = adjacencyOffsets[a]; j < adjacencyOffsets[a + 1]; j++)
+    {
+        const unsigned int *triangle = indices + adjacency[j]*3;
+        if ((positionIds[triangle[0]] == b) || (positionIds[triangle[1]] == b) || (positionIds[triangle[2]] == b)) count++;
+    }
 
-    // The intersection lies outside the triangle
-    if ((u < 0.0f) || (u > 1.0f)) return collision;
+    return count;
+}
 
-    // Prepare to test v parameter
-    q = Vector3CrossProduct(tv, edge1);
+// Add weighted plane to quadric, plane defined by normal and distance (n·p + d = 0)
+// NOTE: Quadric stored as symmetric matrix A (6 values), vector b (3 values), constant c and total weight
+static void AddPlaneQuadric(float *quadric, Vector3 normal, float distance, float weight)
+{
+    quadric[0] += weight*normal.x*normal.x;
+    quadric[1] += weight*normal.y*normal.y;
+    quadric[2] += weight*normal.z*normal.z;
+    quadric[3] += weight*normal.x*normal.y;
+    quadric[4] += weight*normal.x*normal.z;
+    quadric[5] += weight*normal.y*normal.z;
+    quadric[6] += weight*normal.x*distance;
+    quadric[7] += weight*normal.y*distance;
+    quadric[8] += weight*normal.z*distance;
+    quadric[9] += weight*distance*distance;
+    quadric[10] += weight;
+}
 
-    // Calculate V parameter and test bound
-    v = Vector3DotProduct(ray.direction, q)*invDet;
+// Get error of position for the sum of two quadrics, as distance (square root of weighted mean squared distance)
+static float GetQuadricError(const float *quadricA, const float *quadricB, Vector3 position)
+{
+    float q[11] = { 0 };
+    for (int i = 0; i < 11; i++) q[i] = quadricA[i] + quadricB[i];
 
-    // The intersection lies outside the triangle
-    if ((v < 0.0f) || ((u + v) > 1.0f)) return collision;
+    float x = position.x, y = position.y, z = position.z;
+    float error = q[0]*x*x + q[1]*y*y + q[2]*z*z + 2.0f*(q[3]*x*y + q[4]*x*z + q[5]*y*z) + 2.0f*(q[6]*x + q[7]*y + q[8]*z) + q[9];
 
-    t = Vector3DotProduct(edge2, q)*invDet;
+    return (q[10] > 0.0f)? sqrtf(fabsf(error)/q[10]) : 0.0f;
+}
 
-    if (t > EPSILON)
-    {
-        // Ray hit, get hit point and normal
-        collision.hit = true;
-        collision.distance = t;
-        collision.normal = Vector3Normalize(Vector3CrossProduct(edge1, edge2));
-        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, t));
-    }
+// Compare mesh collapses for sorting, lower error first
+static int CompareMeshCollapses(const void *a, const void *b)
+{
+    const MeshCollapse *collapseA = (const MeshCollapse *)a;
+    const MeshCollapse *collapseB = (const MeshCollapse *)b;
 
-    return collision;
+    if (collapseA->error < collapseB->error) return -1;
+    if (collapseA->error > collapseB->error) return 1;
+
+    return collapseA->source - collapseB->source;
 }
 
-// Get collision info between ray and quad
-// NOTE: The points are expected to be in counter-clockwise winding
-RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Vector3 p4)
+// Get mesh level of detail for transform, returns -1 if culled
+// NOTE: Bounds sphere is used for culling and screen size, radius scaled by transform maximum scale
+static int GetMeshLodLevelEx(MeshLod lod, Matrix transform, Frustum frustum, Matrix matView, Matrix matProjection, bool cull)
 {
-    RayCollision collision = { 0 };
+    int level = -1;
 
-    collision = GetRayCollisionTriangle(ray, p1, p2, p4);
+    Vector3 center = Vector3Transform(Vector3Scale(Vector3Add(lod.bounds.min, lod.bounds.max), 0.5f), transform);
+    float scaleX = transform.m0*transform.m0 + transform.m1*transform.m1 + transform.m2*transform.m2;
+    float scaleY = transform.m4*transform.m4 + transform.m5*transform.m5 + transform.m6*transform.m6;
+    float scaleZ = transform.m8*transform.m8 + transform.m9*transform.m9 + transform.m10*transform.m10;
+    float radius = Vector3Distance(lod.bounds.min, lod.bounds.max)*0.5f*sqrtf(fmaxf(scaleX, fmaxf(scaleY, scaleZ)));
 
-    if (!collision.hit) collision = GetRayCollisionTriangle(ray, p2, p3, p4);
+    meshCullingTested++;
 
-    return collision;
+    if (!cull || CheckCollisionFrustumSphere(frustum, center, radius))
+    {
+        // Screen size: bounds sphere projected diameter relative to screen height
+        // NOTE: Perspective projection scale depends on distance to camera, orthographic does not
+        float screenSize = radius*matProjection.m5;
+
+        if (matProjection.m15 == 0.0f)
+        {
+            float distance = Vector3Length(Vector3Transform(center, matView));
+            screenSize = (distance > radius)? screenSize/distance : lod.screenSizes[0];
+        }
+
+        for (int i = 0; i < lod.levelCount; i++)
+        {
+            if (screenSize >= lod.screenSizes[i])
+            {
+                level = i;
+                break;
+            }
+        }
+    }
+
+    if (level < 0) meshCullingCulled++;
+
+    return level;
 }
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
 #if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_GLTF)
 // Build pose from parent joints
 // NOTE: Required for animations loading (required by IQM and GLTF)
@@ -4413,6 +6945,16 @@ static Model LoadOBJ(const char *fileName)
     tinyobj_shapes_free(objShapes, objShapeCount);
     tinyobj_materials_free(objMaterials, objMaterialCount);
 
+#if defined(SUPPORT_OBJ_VERTEX_WELDING)
+    // Weld duplicated face vertices, OBJ faces reference separate position/normal/texcoord indices
+    // NOTE: Without 32-bit indices support (GL_OES_element_index_uint), meshes that could require them
+    // after welding are kept unindexed, welding is done in place and 32-bit indexed meshes are not drawn
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        if (rlIsVertexBufferElementUintSupported() || (model.meshes[i].vertexCount <= 65535)) GenMeshIndices(&model.meshes[i]);
+    }
+#endif
+
     for (int i = 0; i < model.meshCount; i++)
         UploadMesh(model.meshes + i, true);
 
@@ -5101,7 +7643,9 @@ static Image LoadImageFromCgltfImage(cgltf_image *cgltfImage, const char *texPat
 
                 if (result == cgltf_result_success)
                 {
-                    image = LoadImageFromMemory(".png", (unsigned char *)data, outSize);
+                    // Check data URI media type, only jpeg and png expected by glTF specs
+                    const char *fileType = (strncmp(cgltfImage->uri + 5, "image/jpeg", 10) == 0)? ".jpg" : ".png";
+                    image = LoadImageFromMemory(fileType, (unsigned char *)data, outSize);
                     RL_FREE(data);
                 }
             }
@@ -5113,16 +7657,8 @@ static Image LoadImageFromCgltfImage(cgltf_image *cgltfImage, const char *texPat
     }
     else if (cgltfImage->buffer_view->buffer->data != NULL)    // Check if image is provided as data buffer
     {
-        unsigned char *data = RL_MALLOC(cgltfImage->buffer_view->size);
-        int offset = (int)cgltfImage->buffer_view->offset;
-        int stride = (int)cgltfImage->buffer_view->stride? (int)cgltfImage->buffer_view->stride : 1;
-
-        // Copy buffer data to memory for loading
-        for (unsigned int i = 0; i < cgltfImage->buffer_view->size; i++)
-        {
-            data[i] = ((unsigned char *)cgltfImage->buffer_view->buffer->data)[offset];
-            offset += stride;
-        }
+        // NOTE: Image data is loaded directly from buffer, image buffer views are always tightly packed
+        unsigned char *data = (unsigned char *)cgltf_buffer_view_data(cgltfImage->buffer_view);
 
         // Check mime_type for image: (cgltfImage->mime_type == "image/png")
         // NOTE: Detected that some models define mime_type as "image\\/png"
@@ -5131,8 +7667,6 @@ static Image LoadImageFromCgltfImage(cgltf_image *cgltfImage, const char *texPat
         else if ((strcmp(cgltfImage->mime_type, "image\\/jpeg") == 0) ||
                  (strcmp(cgltfImage->mime_type, "image/jpeg") == 0)) image = LoadImageFromMemory(".jpg", data, (int)cgltfImage->buffer_view->size);
         else TRACELOG(LOG_WARNING, "MODEL: glTF image data MIME type not recognized", TextFormat("%s/%s", texPath, cgltfImage->uri));
-
-        RL_FREE(data);
     }
 
     return image;
@@ -5164,11 +7698,111 @@ static BoneInfo *LoadBoneInfoGLTF(cgltf_skin skin, int *boneCount)
                 break;
             }
         }
-
-        bones[i].parent = parentIndex;
+
+        bones[i].parent = parentIndex;
+    }
+
+    return bones;
+}
+
+// Load texture from glTF texture image, every image is decoded once and cached in images array
+// NOTE: Images array is indexed by glTF image index, a new texture is loaded on every call,
+// materials own their textures and can be unloaded independently with UnloadMaterial()
+static Texture2D LoadTextureFromCgltfTexture(cgltf_data *data, cgltf_texture *cgltfTexture, Image *images, const char *texPath)
+{
+    Texture2D texture = { 0 };
+
+    // NOTE: Textures could only provide images through extensions not supported (i.e. KHR_texture_basisu)
+    if (cgltfTexture->image == NULL) return texture;
+
+    int index = (int)(cgltfTexture->image - data->images);
+
+    if (images[index].data == NULL) images[index] = LoadImageFromCgltfImage(cgltfTexture->image, texPath);
+    if (images[index].data != NULL) texture = LoadTextureFromImage(images[index]);
+
+    return texture;
+}
+
+// Load glTF accessor data into raylib mesh array, converting component type while reading
+// NOTE: Data is read straight from the glTF buffer into the destination array (no intermediate copies),
+// destination components not provided by accessor are set to 1.0 (i.e. RGB colors alpha),
+// returns number of values truncated to destination type or -1 if data not available
+static int LoadAccessorGLTF(const cgltf_accessor *accessor, cgltf_component_type type, int components, bool normalized, void *dst)
+{
+    const unsigned char *buffer = (accessor->buffer_view != NULL)? cgltf_buffer_view_data(accessor->buffer_view) : NULL;
+
+    if ((buffer == NULL) || accessor->is_sparse) return -1;
+
+    buffer += accessor->offset;
+
+    int srcComponents = (int)cgltf_num_components(accessor->type);
+    int srcSize = (int)cgltf_component_size(accessor->component_type);
+    int dstSize = (int)cgltf_component_size(type);
+    int stride = (int)accessor->stride;
+    int count = (int)accessor->count;
+    int truncated = 0;
+
+    if ((accessor->component_type == type) && (srcComponents == components))
+    {
+        // Same data layout, copy elements directly (all at once if tightly packed)
+        if (stride == components*dstSize) memcpy(dst, buffer, count*stride);
+        else for (int i = 0; i < count; i++) memcpy((unsigned char *)dst + i*components*dstSize, buffer + i*stride, components*dstSize);
+
+        return truncated;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        const unsigned char *element = buffer + i*stride;
+
+        for (int c = 0; c < components; c++)
+        {
+            // Read component value, integer values kept as integers unless normalized (indices precision)
+            float value = 1.0f;
+            unsigned int ivalue = 0;
+            bool integer = false;
+
+            if (c < srcComponents)
+            {
+                const unsigned char *src = element + c*srcSize;
+
+                switch (accessor->component_type)
+                {
+                    case cgltf_component_type_r_8: { signed char v = 0; memcpy(&v, src, 1); value = normalized? fmaxf(v/127.0f, -1.0f) : (float)v; } break;
+                    case cgltf_component_type_r_8u: { unsigned char v = 0; memcpy(&v, src, 1); value = normalized? v/255.0f : (float)v; ivalue = v; integer = !normalized; } break;
+                    case cgltf_component_type_r_16: { short v = 0; memcpy(&v, src, 2); value = normalized? fmaxf(v/32767.0f, -1.0f) : (float)v; } break;
+                    case cgltf_component_type_r_16u: { unsigned short v = 0; memcpy(&v, src, 2); value = normalized? v/65535.0f : (float)v; ivalue = v; integer = !normalized; } break;
+                    case cgltf_component_type_r_32u: { unsigned int v = 0; memcpy(&v, src, 4); value = (float)v; ivalue = v; integer = true; } break;
+                    case cgltf_component_type_r_32f: memcpy(&value, src, 4); break;
+                    default: break;
+                }
+            }
+
+            // Write component value in destination type
+            switch (type)
+            {
+                case cgltf_component_type_r_32f: ((float *)dst)[i*components + c] = value; break;
+                case cgltf_component_type_r_8u:
+                {
+                    if (integer)
+                    {
+                        if (ivalue > 255) truncated++;
+                        ((unsigned char *)dst)[i*components + c] = (unsigned char)ivalue;
+                    }
+                    else ((unsigned char *)dst)[i*components + c] = (unsigned char)(Clamp(value, 0.0f, 1.0f)*255.0f + 0.5f);
+                } break;
+                case cgltf_component_type_r_16u:
+                {
+                    if (ivalue > 65535) truncated++;
+                    ((unsigned short *)dst)[i*components + c] = (unsigned short)ivalue;
+                } break;
+                case cgltf_component_type_r_32u: ((unsigned int *)dst)[i*components + c] = ivalue; break;
+                default: break;
+            }
+        }
     }
 
-    return bones;
+    return truncated;
 }
 
 // Load glTF file into model struct, .gltf and .glb supported
@@ -5182,7 +7816,8 @@ static Model LoadGLTF(const char *fileName)
 
         FEATURES:
           - Supports .gltf and .glb files
-          - Supports embedded (base64) or external textures
+          - Supports embedded (base64) or external textures, every image is decoded once
+            for all materials referencing it
           - Supports PBR metallic/roughness flow, loads material textures, values and colors
                      PBR specular/glossiness flow and extended texture flows not supported
           - Supports multiple meshes per model (every primitives is loaded as a separate mesh)
@@ -5195,47 +7830,41 @@ static Model LoadGLTF(const char *fileName)
         RESTRICTIONS:
           - Only triangle meshes supported
           - Vertex attribute types and formats supported:
-              > Vertices (position): vec3: float
-              > Normals: vec3: float
-              > Texcoords: vec2: float
-              > Colors: vec4: u8, u16, f32 (normalized)
-              > Indices: u16, u32 (truncated to u16)
+              > Vertices (position): vec3: float, s8/u8/s16/u16 (KHR_mesh_quantization)
+              > Normals: vec3: float, s8/s16 normalized (KHR_mesh_quantization)
+              > Tangents: vec4: float, s8/s16 normalized (KHR_mesh_quantization)
+              > Texcoords: vec2: float, u8, u16 (normalized)
+              > Colors: vec3/vec4: u8, u16, f32 (normalized)
+              > Indices: u8, u16, u32 (32-bit indices used for meshes with more than 65535 vertices)
+          - Sparse accessors not supported
           - Scenes defined in the glTF file are ignored. All nodes in the file
             are used.
 
     ***********************************************************************************************/
 
-    // Macro to simplify attributes loading code
-    #define LOAD_ATTRIBUTE(accesor, numComp, srcType, dstPtr) LOAD_ATTRIBUTE_CAST(accesor, numComp, srcType, dstPtr, srcType)
-
-    #define LOAD_ATTRIBUTE_CAST(accesor, numComp, srcType, dstPtr, dstType) \
-    { \
-        int n = 0; \
-        srcType *buffer = (srcType *)accesor->buffer_view->buffer->data + accesor->buffer_view->offset/sizeof(srcType) + accesor->offset/sizeof(srcType); \
-        for (unsigned int k = 0; k < accesor->count; k++) \
-        {\
-            for (int l = 0; l < numComp; l++) \
-            {\
-                dstPtr[numComp*k + l] = (dstType)buffer[n + l];\
-            }\
-            n += (int)(accesor->stride/sizeof(srcType));\
-        }\
-    }
-
     Model model = { 0 };
 
-    // glTF file loading
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+#if defined(SUPPORT_TRACELOG_DEBUG)
+    // Loading stages times, reported at the end of loading
+    // NOTE: Timer requires platform initialized, only measured for debugging
+    double time = GetTime();
+    double parseTime = 0.0;
+    double buffersTime = 0.0;
+    double materialsTime = 0.0;
+    double meshesTime = 0.0;
+#endif
 
-    if (fileData == NULL) return model;
+    // glTF file mapping (no copy if supported, glb binary chunk can be big)
+    FileMapping mapping = MapFileData(fileName);
+
+    if (mapping.data == NULL) return model;
 
     // glTF data loading
     cgltf_options options = { 0 };
     options.file.read = LoadFileGLTFCallback;
     options.file.release = ReleaseFileGLTFCallback;
     cgltf_data *data = NULL;
-    cgltf_result result = cgltf_parse(&options, fileData, dataSize, &data);
+    cgltf_result result = cgltf_parse(&options, mapping.data, (cgltf_size)mapping.size, &data);
 
     if (result == cgltf_result_success)
     {
@@ -5249,11 +7878,21 @@ static Model LoadGLTF(const char *fileName)
         TRACELOG(LOG_DEBUG, "    > Images count: %i", data->images_count);
         TRACELOG(LOG_DEBUG, "    > Textures count: %i", data->textures_count);
 
+#if defined(SUPPORT_TRACELOG_DEBUG)
+        parseTime = GetTime() - time;
+        time = GetTime();
+#endif
+
         // Force reading data buffers (fills buffer_view->buffer->data)
         // NOTE: If an uri is defined to base64 data or external path, it's automatically loaded
         result = cgltf_load_buffers(&options, data, fileName);
         if (result != cgltf_result_success) TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load mesh/material buffers", fileName);
 
+#if defined(SUPPORT_TRACELOG_DEBUG)
+        buffersTime = GetTime() - time;
+        time = GetTime();
+#endif
+
         int primitivesCount = 0;
         // NOTE: We will load every primitive in the glTF as a separate raylib Mesh.
         // Determine total number of meshes needed from the node hierarchy.
@@ -5285,11 +7924,16 @@ static Model LoadGLTF(const char *fileName)
         model.meshMaterial = RL_CALLOC(model.meshCount, sizeof(int));
 
         // Load materials data
+        // NOTE: Images are decoded once per glTF image, materials referencing the same image load their own texture
         //----------------------------------------------------------------------------------------------------
+        Image *images = RL_CALLOC(data->images_count + 1, sizeof(Image));
+        const char *directory = GetDirectoryPath(fileName);
+        char *texPath = RL_CALLOC(strlen(directory) + 1, sizeof(char));
+        strcpy(texPath, directory);
+
         for (unsigned int i = 0, j = 1; i < data->materials_count; i++, j++)
         {
             model.materials[j] = LoadMaterialDefault();
-            const char *texPath = GetDirectoryPath(fileName);
 
             // Check glTF material flow: PBR metallic/roughness flow
             // NOTE: Alternatively, materials can follow PBR specular/glossiness flow
@@ -5298,12 +7942,8 @@ static Model LoadGLTF(const char *fileName)
                 // Load base color texture (albedo)
                 if (data->materials[i].pbr_metallic_roughness.base_color_texture.texture)
                 {
-                    Image imAlbedo = LoadImageFromCgltfImage(data->materials[i].pbr_metallic_roughness.base_color_texture.texture->image, texPath);
-                    if (imAlbedo.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_ALBEDO].texture = LoadTextureFromImage(imAlbedo);
-                        UnloadImage(imAlbedo);
-                    }
+                    Texture2D texAlbedo = LoadTextureFromCgltfTexture(data, data->materials[i].pbr_metallic_roughness.base_color_texture.texture, images, texPath);
+                    if (texAlbedo.id > 0) model.materials[j].maps[MATERIAL_MAP_ALBEDO].texture = texAlbedo;
                 }
                 // Load base color factor (tint)
                 model.materials[j].maps[MATERIAL_MAP_ALBEDO].color.r = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[0]*255);
@@ -5314,12 +7954,7 @@ static Model LoadGLTF(const char *fileName)
                 // Load metallic/roughness texture
                 if (data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture)
                 {
-                    Image imMetallicRoughness = LoadImageFromCgltfImage(data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture->image, texPath);
-                    if (imMetallicRoughness.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_ROUGHNESS].texture = LoadTextureFromImage(imMetallicRoughness);
-                        UnloadImage(imMetallicRoughness);
-                    }
+                    model.materials[j].maps[MATERIAL_MAP_ROUGHNESS].texture = LoadTextureFromCgltfTexture(data, data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture, images, texPath);
 
                     // Load metallic/roughness material properties
                     float roughness = data->materials[i].pbr_metallic_roughness.roughness_factor;
@@ -5332,34 +7967,19 @@ static Model LoadGLTF(const char *fileName)
                 // Load normal texture
                 if (data->materials[i].normal_texture.texture)
                 {
-                    Image imNormal = LoadImageFromCgltfImage(data->materials[i].normal_texture.texture->image, texPath);
-                    if (imNormal.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_NORMAL].texture = LoadTextureFromImage(imNormal);
-                        UnloadImage(imNormal);
-                    }
+                    model.materials[j].maps[MATERIAL_MAP_NORMAL].texture = LoadTextureFromCgltfTexture(data, data->materials[i].normal_texture.texture, images, texPath);
                 }
 
                 // Load ambient occlusion texture
                 if (data->materials[i].occlusion_texture.texture)
                 {
-                    Image imOcclusion = LoadImageFromCgltfImage(data->materials[i].occlusion_texture.texture->image, texPath);
-                    if (imOcclusion.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_OCCLUSION].texture = LoadTextureFromImage(imOcclusion);
-                        UnloadImage(imOcclusion);
-                    }
+                    model.materials[j].maps[MATERIAL_MAP_OCCLUSION].texture = LoadTextureFromCgltfTexture(data, data->materials[i].occlusion_texture.texture, images, texPath);
                 }
 
                 // Load emissive texture
                 if (data->materials[i].emissive_texture.texture)
                 {
-                    Image imEmissive = LoadImageFromCgltfImage(data->materials[i].emissive_texture.texture->image, texPath);
-                    if (imEmissive.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_EMISSION].texture = LoadTextureFromImage(imEmissive);
-                        UnloadImage(imEmissive);
-                    }
+                    model.materials[j].maps[MATERIAL_MAP_EMISSION].texture = LoadTextureFromCgltfTexture(data, data->materials[i].emissive_texture.texture, images, texPath);
 
                     // Load emissive color factor
                     model.materials[j].maps[MATERIAL_MAP_EMISSION].color.r = (unsigned char)(data->materials[i].emissive_factor[0]*255);
@@ -5373,6 +7993,15 @@ static Model LoadGLTF(const char *fileName)
             // has_clearcoat, has_transmission, has_volume, has_ior, has specular, has_sheen
         }
 
+        for (unsigned int i = 0; i < data->images_count; i++) UnloadImage(images[i]);
+        RL_FREE(images);
+        RL_FREE(texPath);
+
+#if defined(SUPPORT_TRACELOG_DEBUG)
+        materialsTime = GetTime() - time;
+        time = GetTime();
+#endif
+
         // Visit each node in the hierarchy and process any mesh linked from it.
         // Each primitive within a glTF node becomes a Raylib Mesh.
         // The local-to-world transform of each node is used to transform the
@@ -5403,6 +8032,10 @@ static Model LoadGLTF(const char *fileName)
 
             Matrix worldMatrixNormals = MatrixTranspose(MatrixInvert(worldMatrix));
 
+            // Nodes without transformation do not require transforming vertex data
+            Matrix identity = MatrixIdentity();
+            bool transformed = (memcmp(&worldMatrix, &identity, sizeof(Matrix)) != 0);
+
             for (unsigned int p = 0; p < mesh->primitives_count; p++)
             {
                 // NOTE: We only support primitives defined by triangles
@@ -5410,29 +8043,33 @@ static Model LoadGLTF(const char *fileName)
                 if (mesh->primitives[p].type != cgltf_primitive_type_triangles) continue;
 
                 // NOTE: Attributes data could be provided in several data formats (8, 8u, 16u, 32...),
-                // Only some formats for each attribute type are supported, read info at the top of this function!
+                // Data is converted to raylib mesh data types while read from the glTF buffers,
+                // only some formats for each attribute type are supported, read info at the top of this function!
+                Mesh *modelMesh = &model.meshes[meshIndex];
 
                 for (unsigned int j = 0; j < mesh->primitives[p].attributes_count; j++)
                 {
+                    cgltf_accessor *attribute = mesh->primitives[p].attributes[j].data;
+
                     // Check the different attributes for every primitive
-                    if (mesh->primitives[p].attributes[j].type == cgltf_attribute_type_position)      // POSITION, vec3, float
+                    if (mesh->primitives[p].attributes[j].type == cgltf_attribute_type_position)      // POSITION, vec3
                     {
-                        cgltf_accessor *attribute = mesh->primitives[p].attributes[j].data;
-
                         // WARNING: SPECS: POSITION accessor MUST have its min and max properties defined
 
-                        if ((attribute->type == cgltf_type_vec3) && (attribute->component_type == cgltf_component_type_r_32f))
+                        if (attribute->type == cgltf_type_vec3)
                         {
                             // Init raylib mesh vertices to copy glTF attribute data
-                            model.meshes[meshIndex].vertexCount = (int)attribute->count;
-                            model.meshes[meshIndex].vertices = RL_MALLOC(attribute->count*3*sizeof(float));
+                            modelMesh->vertexCount = (int)attribute->count;
+                            modelMesh->vertices = RL_MALLOC(attribute->count*3*sizeof(float));
 
-                            // Load 3 components of float data type into mesh.vertices
-                            LOAD_ATTRIBUTE(attribute, 3, float, model.meshes[meshIndex].vertices)
+                            if (LoadAccessorGLTF(attribute, cgltf_component_type_r_32f, 3, attribute->normalized, modelMesh->vertices) < 0)
+                            {
+                                TRACELOG(LOG_WARNING, "MODEL: [%s] Vertices attribute data not available", fileName);
+                            }
 
                             // Transform the vertices
-                            float *vertices = model.meshes[meshIndex].vertices;
-                            for (unsigned int k = 0; k < attribute->count; k++)
+                            float *vertices = modelMesh->vertices;
+                            for (unsigned int k = 0; transformed && (k < attribute->count); k++)
                             {
                                 Vector3 vt = Vector3Transform((Vector3){ vertices[3*k], vertices[3*k+1], vertices[3*k+2] }, worldMatrix);
                                 vertices[3*k] = vt.x;
@@ -5440,23 +8077,19 @@ static Model LoadGLTF(const char *fileName)
                                 vertices[3*k+2] = vt.z;
                             }
                         }
-                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Vertices attribute data format not supported, use vec3 float", fileName);
+                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Vertices attribute data format not supported, use vec3", fileName);
                     }
-                    else if (mesh->primitives[p].attributes[j].type == cgltf_attribute_type_normal)   // NORMAL, vec3, float
+                    else if (mesh->primitives[p].attributes[j].type == cgltf_attribute_type_normal)   // NORMAL, vec3
                     {
-                        cgltf_accessor *attribute = mesh->primitives[p].attributes[j].data;
-
-                        if ((attribute->type == cgltf_type_vec3) && (attribute->component_type == cgltf_component_type_r_32f))
+                        if (attribute->type == cgltf_type_vec3)
                         {
                             // Init raylib mesh normals to copy glTF attribute data
-                            model.meshes[meshIndex].normals = RL_MALLOC(attribute->count*3*sizeof(float));
-
-                            // Load 3 components of float data type into mesh.normals
-                            LOAD_ATTRIBUTE(attribute, 3, float, model.meshes[meshIndex].normals)
+                            modelMesh->normals = RL_MALLOC(attribute->count*3*sizeof(float));
+                            LoadAccessorGLTF(attribute, cgltf_component_type_r_32f, 3, true, modelMesh->normals);
 
                             // Transform the normals
-                            float *normals = model.meshes[meshIndex].normals;
-                            for (unsigned int k = 0; k < attribute->count; k++)
+                            float *normals = modelMesh->normals;
+                            for (unsigned int k = 0; transformed && (k < attribute->count); k++)
                             {
                                 Vector3 nt = Vector3Transform((Vector3){ normals[3*k], normals[3*k+1], normals[3*k+2] }, worldMatrixNormals);
                                 normals[3*k] = nt.x;
@@ -5464,84 +8097,44 @@ static Model LoadGLTF(const char *fileName)
                                 normals[3*k+2] = nt.z;
                             }
                         }
-                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Normal attribute data format not supported, use vec3 float", fileName);
+                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Normal attribute data format not supported, use vec3", fileName);
                     }
-                    else if (mesh->primitives[p].attributes[j].type == cgltf_attribute_type_tangent)   // TANGENT, vec3, float
+                    else if (mesh->primitives[p].attributes[j].type == cgltf_attribute_type_tangent)   // TANGENT, vec4
                     {
-                        cgltf_accessor *attribute = mesh->primitives[p].attributes[j].data;
-
-                        if ((attribute->type == cgltf_type_vec4) && (attribute->component_type == cgltf_component_type_r_32f))
+                        if (attribute->type == cgltf_type_vec4)
                         {
                             // Init raylib mesh tangent to copy glTF attribute data
-                            model.meshes[meshIndex].tangents = RL_MALLOC(attribute->count*4*sizeof(float));
-
-                            // Load 4 components of float data type into mesh.tangents
-                            LOAD_ATTRIBUTE(attribute, 4, float, model.meshes[meshIndex].tangents)
+                            modelMesh->tangents = RL_MALLOC(attribute->count*4*sizeof(float));
+                            LoadAccessorGLTF(attribute, cgltf_component_type_r_32f, 4, true, modelMesh->tangents);
 
-                            // Transform the tangents
-                            float *tangents = model.meshes[meshIndex].tangents;
-                            for (unsigned int k = 0; k < attribute->count; k++)
+                            // Transform the tangents, w component keeps handedness
+                            float *tangents = modelMesh->tangents;
+                            for (unsigned int k = 0; transformed && (k < attribute->count); k++)
                             {
-                                Vector3 tt = Vector3Transform((Vector3){ tangents[3*k], tangents[3*k+1], tangents[3*k+2] }, worldMatrix);
-                                tangents[3*k] = tt.x;
-                                tangents[3*k+1] = tt.y;
-                                tangents[3*k+2] = tt.z;
+                                Vector3 tt = Vector3Transform((Vector3){ tangents[4*k], tangents[4*k+1], tangents[4*k+2] }, worldMatrix);
+                                tangents[4*k] = tt.x;
+                                tangents[4*k+1] = tt.y;
+                                tangents[4*k+2] = tt.z;
                             }
                         }
-                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Tangent attribute data format not supported, use vec4 float", fileName);
+                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Tangent attribute data format not supported, use vec4", fileName);
                     }
                     else if (mesh->primitives[p].attributes[j].type == cgltf_attribute_type_texcoord) // TEXCOORD_n, vec2, float/u8n/u16n
                     {
                         // Support up to 2 texture coordinates attributes
                         float *texcoordPtr = NULL;
 
-                        cgltf_accessor *attribute = mesh->primitives[p].attributes[j].data;
-
                         if (attribute->type == cgltf_type_vec2)
                         {
-                            if (attribute->component_type == cgltf_component_type_r_32f)  // vec2, float
-                            {
-                                // Init raylib mesh texcoords to copy glTF attribute data
-                                texcoordPtr = (float *)RL_MALLOC(attribute->count*2*sizeof(float));
-
-                                // Load 3 components of float data type into mesh.texcoords
-                                LOAD_ATTRIBUTE(attribute, 2, float, texcoordPtr)
-                            }
-                            else if (attribute->component_type == cgltf_component_type_r_8u) // vec2, u8n
-                            {
-                                // Init raylib mesh texcoords to copy glTF attribute data
-                                texcoordPtr = (float *)RL_MALLOC(attribute->count*2*sizeof(float));
-
-                                // Load data into a temp buffer to be converted to raylib data type
-                                unsigned char *temp = (unsigned char *)RL_MALLOC(attribute->count*2*sizeof(unsigned char));
-                                LOAD_ATTRIBUTE(attribute, 2, unsigned char, temp);
-
-                                // Convert data to raylib texcoord data type (float)
-                                for (unsigned int t = 0; t < attribute->count*2; t++) texcoordPtr[t] = (float)temp[t]/255.0f;
-
-                                RL_FREE(temp);
-                            }
-                            else if (attribute->component_type == cgltf_component_type_r_16u) // vec2, u16n
-                            {
-                                // Init raylib mesh texcoords to copy glTF attribute data
-                                texcoordPtr = (float *)RL_MALLOC(attribute->count*2*sizeof(float));
-
-                                // Load data into a temp buffer to be converted to raylib data type
-                                unsigned short *temp = (unsigned short *)RL_MALLOC(attribute->count*2*sizeof(unsigned short));
-                                LOAD_ATTRIBUTE(attribute, 2, unsigned short, temp);
-
-                                // Convert data to raylib texcoord data type (float)
-                                for (unsigned int t = 0; t < attribute->count*2; t++) texcoordPtr[t] = (float)temp[t]/65535.0f;
-
-                                RL_FREE(temp);
-                            }
-                            else TRACELOG(LOG_WARNING, "MODEL: [%s] Texcoords attribute data format not supported", fileName);
+                            // Init raylib mesh texcoords to copy glTF attribute data
+                            texcoordPtr = (float *)RL_MALLOC(attribute->count*2*sizeof(float));
+                            LoadAccessorGLTF(attribute, cgltf_component_type_r_32f, 2, true, texcoordPtr);
                         }
-                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Texcoords attribute data format not supported, use vec2 float", fileName);
+                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Texcoords attribute data format not supported, use vec2", fileName);
 
                         int index = mesh->primitives[p].attributes[j].index;
-                        if (index == 0) model.meshes[meshIndex].texcoords = texcoordPtr;
-                        else if (index == 1) model.meshes[meshIndex].texcoords2 = texcoordPtr;
+                        if (index == 0) modelMesh->texcoords = texcoordPtr;
+                        else if (index == 1) modelMesh->texcoords2 = texcoordPtr;
                         else
                         {
                             TRACELOG(LOG_WARNING, "MODEL: [%s] No more than 2 texture coordinates attributes supported", fileName);
@@ -5550,113 +8143,14 @@ static Model LoadGLTF(const char *fileName)
                     }
                     else if (mesh->primitives[p].attributes[j].type == cgltf_attribute_type_color)    // COLOR_n, vec3/vec4, float/u8n/u16n
                     {
-                        cgltf_accessor *attribute = mesh->primitives[p].attributes[j].data;
-
                         // WARNING: SPECS: All components of each COLOR_n accessor element MUST be clamped to [0.0, 1.0] range
 
-                        if (attribute->type == cgltf_type_vec3)  // RGB
-                        {
-                            if (attribute->component_type == cgltf_component_type_r_8u)
-                            {
-                                // Init raylib mesh color to copy glTF attribute data
-                                model.meshes[meshIndex].colors = RL_MALLOC(attribute->count*4*sizeof(unsigned char));
-
-                                // Load data into a temp buffer to be converted to raylib data type
-                                unsigned char *temp = RL_MALLOC(attribute->count*3*sizeof(unsigned char));
-                                LOAD_ATTRIBUTE(attribute, 3, unsigned char, temp);
-
-                                // Convert data to raylib color data type (4 bytes)
-                                for (unsigned int c = 0, k = 0; c < (attribute->count*4 - 3); c += 4, k += 3)
-                                {
-                                    model.meshes[meshIndex].colors[c] = temp[k];
-                                    model.meshes[meshIndex].colors[c + 1] = temp[k + 1];
-                                    model.meshes[meshIndex].colors[c + 2] = temp[k + 2];
-                                    model.meshes[meshIndex].colors[c + 3] = 255;
-                                }
-
-                                RL_FREE(temp);
-                            }
-                            else if (attribute->component_type == cgltf_component_type_r_16u)
-                            {
-                                // Init raylib mesh color to copy glTF attribute data
-                                model.meshes[meshIndex].colors = RL_MALLOC(attribute->count*4*sizeof(unsigned char));
-
-                                // Load data into a temp buffer to be converted to raylib data type
-                                unsigned short *temp = RL_MALLOC(attribute->count*3*sizeof(unsigned short));
-                                LOAD_ATTRIBUTE(attribute, 3, unsigned short, temp);
-
-                                // Convert data to raylib color data type (4 bytes)
-                                for (unsigned int c = 0, k = 0; c < (attribute->count*4 - 3); c += 4, k += 3)
-                                {
-                                    model.meshes[meshIndex].colors[c] = (unsigned char)(((float)temp[k]/65535.0f)*255.0f);
-                                    model.meshes[meshIndex].colors[c + 1] = (unsigned char)(((float)temp[k + 1]/65535.0f)*255.0f);
-                                    model.meshes[meshIndex].colors[c + 2] = (unsigned char)(((float)temp[k + 2]/65535.0f)*255.0f);
-                                    model.meshes[meshIndex].colors[c + 3] = 255;
-                                }
-
-                                RL_FREE(temp);
-                            }
-                            else if (attribute->component_type == cgltf_component_type_r_32f)
-                            {
-                                // Init raylib mesh color to copy glTF attribute data
-                                model.meshes[meshIndex].colors = RL_MALLOC(attribute->count*4*sizeof(unsigned char));
-
-                                // Load data into a temp buffer to be converted to raylib data type
-                                float *temp = RL_MALLOC(attribute->count*3*sizeof(float));
-                                LOAD_ATTRIBUTE(attribute, 3, float, temp);
-
-                                // Convert data to raylib color data type (4 bytes)
-                                for (unsigned int c = 0, k = 0; c < (attribute->count*4 - 3); c += 4, k += 3)
-                                {
-                                    model.meshes[meshIndex].colors[c] = (unsigned char)(temp[k]*255.0f);
-                                    model.meshes[meshIndex].colors[c + 1] = (unsigned char)(temp[k + 1]*255.0f);
-                                    model.meshes[meshIndex].colors[c + 2] = (unsigned char)(temp[k + 2]*255.0f);
-                                    model.meshes[meshIndex].colors[c + 3] = 255;
-                                }
-
-                                RL_FREE(temp);
-                            }
-                            else TRACELOG(LOG_WARNING, "MODEL: [%s] Color attribute data format not supported", fileName);
-                        }
-                        else if (attribute->type == cgltf_type_vec4) // RGBA
+                        if ((attribute->type == cgltf_type_vec3) || (attribute->type == cgltf_type_vec4))
                         {
-                            if (attribute->component_type == cgltf_component_type_r_8u)
-                            {
-                                // Init raylib mesh color to copy glTF attribute data
-                                model.meshes[meshIndex].colors = RL_MALLOC(attribute->count*4*sizeof(unsigned char));
-
-                                // Load 4 components of unsigned char data type into mesh.colors
-                                LOAD_ATTRIBUTE(attribute, 4, unsigned char, model.meshes[meshIndex].colors)
-                            }
-                            else if (attribute->component_type == cgltf_component_type_r_16u)
-                            {
-                                // Init raylib mesh color to copy glTF attribute data
-                                model.meshes[meshIndex].colors = RL_MALLOC(attribute->count*4*sizeof(unsigned char));
-
-                                // Load data into a temp buffer to be converted to raylib data type
-                                unsigned short *temp = RL_MALLOC(attribute->count*4*sizeof(unsigned short));
-                                LOAD_ATTRIBUTE(attribute, 4, unsigned short, temp);
-
-                                // Convert data to raylib color data type (4 bytes)
-                                for (unsigned int c = 0; c < attribute->count*4; c++) model.meshes[meshIndex].colors[c] = (unsigned char)(((float)temp[c]/65535.0f)*255.0f);
-
-                                RL_FREE(temp);
-                            }
-                            else if (attribute->component_type == cgltf_component_type_r_32f)
-                            {
-                                // Init raylib mesh color to copy glTF attribute data
-                                model.meshes[meshIndex].colors = RL_MALLOC(attribute->count*4*sizeof(unsigned char));
-
-                                // Load data into a temp buffer to be converted to raylib data type
-                                float *temp = RL_MALLOC(attribute->count*4*sizeof(float));
-                                LOAD_ATTRIBUTE(attribute, 4, float, temp);
-
-                                // Convert data to raylib color data type (4 bytes), we expect the color data normalized
-                                for (unsigned int c = 0; c < attribute->count*4; c++) model.meshes[meshIndex].colors[c] = (unsigned char)(temp[c]*255.0f);
-
-                                RL_FREE(temp);
-                            }
-                            else TRACELOG(LOG_WARNING, "MODEL: [%s] Color attribute data format not supported", fileName);
+                            // Init raylib mesh color to copy glTF attribute data
+                            // NOTE: RGB colors are converted to RGBA, alpha set to 255
+                            modelMesh->colors = RL_MALLOC(attribute->count*4*sizeof(unsigned char));
+                            LoadAccessorGLTF(attribute, cgltf_component_type_r_8u, 4, true, modelMesh->colors);
                         }
                         else TRACELOG(LOG_WARNING, "MODEL: [%s] Color attribute data format not supported", fileName);
                     }
@@ -5669,52 +8163,40 @@ static Model LoadGLTF(const char *fileName)
                 {
                     cgltf_accessor *attribute = mesh->primitives[p].indices;
 
-                    model.meshes[meshIndex].triangleCount = (int)attribute->count/3;
-
-                    if (attribute->component_type == cgltf_component_type_r_16u)
-                    {
-                        // Init raylib mesh indices to copy glTF attribute data
-                        model.meshes[meshIndex].indices = RL_MALLOC(attribute->count*sizeof(unsigned short));
-
-                        // Load unsigned short data type into mesh.indices
-                        LOAD_ATTRIBUTE(attribute, 1, unsigned short, model.meshes[meshIndex].indices)
-                    }
-                    else if (attribute->component_type == cgltf_component_type_r_8u)
-                    {
-                        // Init raylib mesh indices to copy glTF attribute data
-                        model.meshes[meshIndex].indices = RL_MALLOC(attribute->count * sizeof(unsigned short));
-                        LOAD_ATTRIBUTE_CAST(attribute, 1, unsigned char, model.meshes[meshIndex].indices, unsigned short)
+                    modelMesh->triangleCount = (int)attribute->count/3;
 
-                    }
-                    else if (attribute->component_type == cgltf_component_type_r_32u)
+                    if ((attribute->component_type == cgltf_component_type_r_8u) ||
+                        (attribute->component_type == cgltf_component_type_r_16u) ||
+                        (attribute->component_type == cgltf_component_type_r_32u))
                     {
-                        // Init raylib mesh indices to copy glTF attribute data
-                        model.meshes[meshIndex].indices = RL_MALLOC(attribute->count*sizeof(unsigned short));
-                        LOAD_ATTRIBUTE_CAST(attribute, 1, unsigned int, model.meshes[meshIndex].indices, unsigned short);
-
-                        TRACELOG(LOG_WARNING, "MODEL: [%s] Indices data converted from u32 to u16, possible loss of data", fileName);
+                        if (modelMesh->vertexCount > 65535)
+                        {
+                            // Init raylib mesh 32-bit indices to copy glTF attribute data
+                            // NOTE: Mesh vertices can not be addressed with 16-bit indices
+                            modelMesh->indices32 = RL_MALLOC(attribute->count*sizeof(unsigned int));
+                            LoadAccessorGLTF(attribute, cgltf_component_type_r_32u, 1, false, modelMesh->indices32);
+                        }
+                        else
+                        {
+                            // Init raylib mesh indices to copy glTF attribute data
+                            // NOTE: All vertices can be addressed with 16-bit indices, no data loss
+                            modelMesh->indices = RL_MALLOC(attribute->count*sizeof(unsigned short));
+                            LoadAccessorGLTF(attribute, cgltf_component_type_r_16u, 1, false, modelMesh->indices);
+                        }
                     }
                     else
                     {
-                        TRACELOG(LOG_WARNING, "MODEL: [%s] Indices data format not supported, use u16", fileName);
+                        TRACELOG(LOG_WARNING, "MODEL: [%s] Indices data format not supported, use u8, u16 or u32", fileName);
                     }
                 }
-                else model.meshes[meshIndex].triangleCount = model.meshes[meshIndex].vertexCount/3;    // Unindexed mesh
+                else modelMesh->triangleCount = modelMesh->vertexCount/3;    // Unindexed mesh
 
                 // Assign to the primitive mesh the corresponding material index
                 // NOTE: If no material defined, mesh uses the already assigned default material (index: 0)
-                for (unsigned int m = 0; m < data->materials_count; m++)
-                {
-                    // The primitive actually keeps the pointer to the corresponding material,
-                    // raylib instead assigns to the mesh the by its index, as loaded in model.materials array
-                    // To get the index, we check if material pointers match, and we assign the corresponding index,
-                    // skipping index 0, the default material
-                    if (&data->materials[m] == mesh->primitives[p].material)
-                    {
-                        model.meshMaterial[meshIndex] = m + 1;
-                        break;
-                    }
-                }
+                // The primitive actually keeps the pointer to the corresponding material,
+                // raylib instead assigns to the mesh the by its index, as loaded in model.materials array,
+                // skipping index 0, the default material
+                if (mesh->primitives[p].material != NULL) model.meshMaterial[meshIndex] = (int)(mesh->primitives[p].material - data->materials) + 1;
 
                 meshIndex++;       // Move to next mesh
             }
@@ -5771,11 +8253,10 @@ static Model LoadGLTF(const char *fileName)
                 for (unsigned int j = 0; j < mesh->primitives[p].attributes_count; j++)
                 {
                     // NOTE: JOINTS_1 + WEIGHT_1 will be used for +4 joints influencing a vertex -> Not supported by raylib
+                    cgltf_accessor *attribute = mesh->primitives[p].attributes[j].data;
 
                     if (mesh->primitives[p].attributes[j].type == cgltf_attribute_type_joints) // JOINTS_n (vec4: 4 bones max per vertex / u8, u16)
                     {
-                        cgltf_accessor *attribute = mesh->primitives[p].attributes[j].data;
-
                         // NOTE: JOINTS_n can only be vec4 and u8/u16
                         // SPECS: https://registry.khronos.org/glTF/specs/2.0/glTF-2.0.html#meshes-overview
 
@@ -5783,92 +8264,32 @@ static Model LoadGLTF(const char *fileName)
                         // if data is provided in any other format, it is converted to supported format but
                         // it could imply data loss (a warning message is issued in that case)
 
-                        if (attribute->type == cgltf_type_vec4)
+                        if ((attribute->type == cgltf_type_vec4) &&
+                            ((attribute->component_type == cgltf_component_type_r_8u) || (attribute->component_type == cgltf_component_type_r_16u)))
                         {
-                            if (attribute->component_type == cgltf_component_type_r_8u)
-                            {
-                                // Init raylib mesh boneIds to copy glTF attribute data
-                                model.meshes[meshIndex].boneIds = RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(unsigned char));
+                            // Init raylib mesh boneIds to copy glTF attribute data
+                            model.meshes[meshIndex].boneIds = RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(unsigned char));
 
-                                // Load attribute: vec4, u8 (unsigned char)
-                                LOAD_ATTRIBUTE(attribute, 4, unsigned char, model.meshes[meshIndex].boneIds)
-                            }
-                            else if (attribute->component_type == cgltf_component_type_r_16u)
+                            // Load attribute: vec4, u8 (unsigned char), u16 values are truncated
+                            if (LoadAccessorGLTF(attribute, cgltf_component_type_r_8u, 4, false, model.meshes[meshIndex].boneIds) > 0)
                             {
-                                // Init raylib mesh boneIds to copy glTF attribute data
-                                model.meshes[meshIndex].boneIds = RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(unsigned char));
-
-                                // Load data into a temp buffer to be converted to raylib data type
-                                unsigned short *temp = RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(unsigned short));
-                                LOAD_ATTRIBUTE(attribute, 4, unsigned short, temp);
-
-                                // Convert data to raylib color data type (4 bytes)
-                                bool boneIdOverflowWarning = false;
-                                for (int b = 0; b < model.meshes[meshIndex].vertexCount*4; b++)
-                                {
-                                    if ((temp[b] > 255) && !boneIdOverflowWarning)
-                                    {
-                                        TRACELOG(LOG_WARNING, "MODEL: [%s] Joint attribute data format (u16) overflow", fileName);
-                                        boneIdOverflowWarning = true;
-                                    }
-
-                                    // Despite the possible overflow, we convert data to unsigned char
-                                    model.meshes[meshIndex].boneIds[b] = (unsigned char)temp[b];
-                                }
-
-                                RL_FREE(temp);
+                                TRACELOG(LOG_WARNING, "MODEL: [%s] Joint attribute data format (u16) overflow", fileName);
                             }
-                            else TRACELOG(LOG_WARNING, "MODEL: [%s] Joint attribute data format not supported", fileName);
                         }
                         else TRACELOG(LOG_WARNING, "MODEL: [%s] Joint attribute data format not supported", fileName);
                     }
                     else if (mesh->primitives[p].attributes[j].type == cgltf_attribute_type_weights)  // WEIGHTS_n (vec4, u8n/u16n/f32)
                     {
-                        cgltf_accessor *attribute = mesh->primitives[p].attributes[j].data;
-
-                        if (attribute->type == cgltf_type_vec4)
+                        if ((attribute->type == cgltf_type_vec4) &&
+                            ((attribute->component_type == cgltf_component_type_r_8u) ||
+                             (attribute->component_type == cgltf_component_type_r_16u) ||
+                             (attribute->component_type == cgltf_component_type_r_32f)))
                         {
-                            // TODO: Support component types: u8, u16?
-                            if (attribute->component_type == cgltf_component_type_r_8u)
-                            {
-                                // Init raylib mesh bone weight to copy glTF attribute data
-                                model.meshes[meshIndex].boneWeights = RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(float));
-
-                                // Load data into a temp buffer to be converted to raylib data type
-                                unsigned char *temp = RL_MALLOC(attribute->count*4*sizeof(unsigned char));
-                                LOAD_ATTRIBUTE(attribute, 4, unsigned char, temp);
-
-                                // Convert data to raylib bone weight data type (4 bytes)
-                                for (unsigned int b = 0; b < attribute->count*4; b++) model.meshes[meshIndex].boneWeights[b] = (float)temp[b]/255.0f;
-
-                                RL_FREE(temp);
-                            }
-                            else if (attribute->component_type == cgltf_component_type_r_16u)
-                            {
-                                // Init raylib mesh bone weight to copy glTF attribute data
-                                model.meshes[meshIndex].boneWeights = RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(float));
-
-                                // Load data into a temp buffer to be converted to raylib data type
-                                unsigned short *temp = RL_MALLOC(attribute->count*4*sizeof(unsigned short));
-                                LOAD_ATTRIBUTE(attribute, 4, unsigned short, temp);
+                            // Init raylib mesh bone weight to copy glTF attribute data
+                            model.meshes[meshIndex].boneWeights = RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(float));
 
-                                // Convert data to raylib bone weight data type
-                                for (unsigned int b = 0; b < attribute->count*4; b++) model.meshes[meshIndex].boneWeights[b] = (float)temp[b]/65535.0f;
-
-                                RL_FREE(temp);
-                            }
-                            else if (attribute->component_type == cgltf_component_type_r_32f)
-                            {
-                                // Init raylib mesh bone weight to copy glTF attribute data
-                                model.meshes[meshIndex].boneWeights = RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(float));
-
-                                // Load 4 components of float data type into mesh.boneWeights
-                                // for cgltf_attribute_type_weights we have:
-                                //   - data.meshes[0] (256 vertices)
-                                //   - 256 values, provided as cgltf_type_vec4 of float (4 byte per joint, stride 16)
-                                LOAD_ATTRIBUTE(attribute, 4, float, model.meshes[meshIndex].boneWeights)
-                            }
-                            else TRACELOG(LOG_WARNING, "MODEL: [%s] Joint weight attribute data format not supported, use vec4 float", fileName);
+                            // Load 4 components converted to float data type into mesh.boneWeights
+                            LoadAccessorGLTF(attribute, cgltf_component_type_r_32f, 4, true, model.meshes[meshIndex].boneWeights);
                         }
                         else TRACELOG(LOG_WARNING, "MODEL: [%s] Joint weight attribute data format not supported, use vec4 float", fileName);
                     }
@@ -5897,13 +8318,20 @@ static Model LoadGLTF(const char *fileName)
 
         }
 
+#if defined(SUPPORT_TRACELOG_DEBUG)
+        meshesTime = GetTime() - time;
+
+        TRACELOG(LOG_DEBUG, "MODEL: [%s] glTF loading times: parse %.2f ms, buffers %.2f ms, materials %.2f ms, meshes %.2f ms", fileName,
+            parseTime*1000.0, buffersTime*1000.0, materialsTime*1000.0, meshesTime*1000.0);
+#endif
+
         // Free all cgltf loaded data
         cgltf_free(data);
     }
     else TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load glTF data", fileName);
 
     // WARNING: cgltf requires the file pointer available while reading data
-    UnloadFileData(fileData);
+    UnmapFileData(mapping);
 
     return model;
 }
@@ -6793,4 +9221,336 @@ static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animCou
 }
 #endif
 
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+// Load rMDL mesh data
+// NOTE: Vertex data is stored as independent arrays, ready to be copied and uploaded to GPU
+static Model LoadRMDL(const char *fileName)
+{
+    Model model = { 0 };
+
+    FileMapping mapping = MapFileData(fileName);
+
+    if (mapping.data != NULL)
+    {
+        const unsigned char *fileData = mapping.data;
+        int fileHeader[4] = { 0 };      // Version, chunks count, reserved
+
+        if ((mapping.size >= RMDL_HEADER_SIZE) && (memcmp(fileData, "rMDL", 4) == 0))
+        {
+            memcpy(fileHeader, fileData, RMDL_HEADER_SIZE);
+            if (fileHeader[1] != RMDL_FILE_VERSION) TRACELOG(LOG_WARNING, "MODEL: [%s] rMDL file version not supported: %i", fileName, fileHeader[1]);
+            else
+            {
+                long long offset = RMDL_HEADER_SIZE;
+                int meshIndex = 0;
+
+                for (int c = 0; c < fileHeader[2]; c++)
+                {
+                    int chunkSize = GetRMDLChunkSize(mapping, offset);
+                    if (chunkSize < 0)
+                    {
+                        TRACELOG(LOG_WARNING, "MODEL: [%s] rMDL file data corrupted", fileName);
+                        break;
+                    }
+
+                    const unsigned char *chunk = fileData + offset + RMDL_CHUNK_HEADER_SIZE;
+                    int chunkOffset = 0;
+
+                    if ((memcmp(fileData + offset, "MODL", 4) == 0) && (model.meshes == NULL))
+                    {
+                        int modelInfo[4] = { 0 };   // Meshes count, materials count, bones count, reserved
+                        LoadRMDLData(chunk, chunkSize, &chunkOffset, modelInfo, sizeof(modelInfo));
+
+                        if ((modelInfo[0] > 0) && (modelInfo[0] <= chunkSize) && (modelInfo[1] >= 0) && (modelInfo[1] <= chunkSize) &&
+                            (modelInfo[2] >= 0) && (modelInfo[2] <= chunkSize))
+                        {
+                            model.meshCount = modelInfo[0];
+                            model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
+                            model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+                            LoadRMDLData(chunk, chunkSize, &chunkOffset, model.meshMaterial, model.meshCount*sizeof(int));
+
+                            // Materials are initialized with default shader and texture, updated with MATL chunk data
+                            model.materialCount = modelInfo[1];
+                            if (model.materialCount > 0)
+                            {
+                                model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
+                                for (int i = 0; i < model.materialCount; i++) model.materials[i] = LoadMaterialDefault();
+                            }
+
+                            for (int i = 0; i < model.meshCount; i++)
+                            {
+                                if ((model.meshMaterial[i] < 0) || (model.meshMaterial[i] >= model.materialCount)) model.meshMaterial[i] = 0;
+                            }
+
+                            model.boneCount = modelInfo[2];
+                            if (model.boneCount > 0)
+                            {
+                                model.bones = (BoneInfo *)RL_CALLOC(model.boneCount, sizeof(BoneInfo));
+                                model.bindPose = (Transform *)RL_CALLOC(model.boneCount, sizeof(Transform));
+                                LoadRMDLData(chunk, chunkSize, &chunkOffset, model.bones, model.boneCount*sizeof(BoneInfo));
+                                LoadRMDLData(chunk, chunkSize, &chunkOffset, model.bindPose, model.boneCount*sizeof(Transform));
+                            }
+                        }
+                    }
+                    else if ((memcmp(fileData + offset, "MATL", 4) == 0) && (model.materials != NULL))
+                    {
+                        int materialsInfo[4] = { 0 };   // Materials count, maps count, reserved
+                        LoadRMDLData(chunk, chunkSize, &chunkOffset, materialsInfo, sizeof(materialsInfo));
+
+                        // NOTE: Maps count is checked against chunk size before computing material data size, to avoid overflows
+                        bool validMaps = ((materialsInfo[1] >= 0) && (materialsInfo[1] <= (chunkSize - (int)(4*sizeof(float)))/8));
+                        int materialDataSize = validMaps? (int)(4*sizeof(float)) + materialsInfo[1]*8 : 0;
+                        unsigned char *materialData = (validMaps && (materialDataSize <= chunkSize))? (unsigned char *)RL_CALLOC(materialDataSize, 1) : NULL;
+
+                        for (int i = 0; (i < materialsInfo[0]) && (i < model.materialCount) && (materialData != NULL); i++)
+                        {
+                            if (!LoadRMDLData(chunk, chunkSize, &chunkOffset, materialData, materialDataSize)) break;
+
+                            memcpy(model.materials[i].params, materialData, 4*sizeof(float));
+                            for (int m = 0; (m < materialsInfo[1]) && (m < MAX_MATERIAL_MAPS); m++)
+                            {
+                                memcpy(&model.materials[i].maps[m].color, materialData + 4*sizeof(float) + m*8, 4);
+                                memcpy(&model.materials[i].maps[m].value, materialData + 4*sizeof(float) + m*8 + 4, 4);
+                            }
+                        }
+
+                        RL_FREE(materialData);
+                    }
+                    else if ((memcmp(fileData + offset, "MESH", 4) == 0) && (meshIndex < model.meshCount))
+                    {
+                        Mesh *mesh = &model.meshes[meshIndex];
+                        int meshInfo[4] = { 0 };    // Vertex count, triangle count, attributes, bones count
+                        LoadRMDLData(chunk, chunkSize, &chunkOffset, meshInfo, sizeof(meshInfo));
+                        LoadRMDLData(chunk, chunkSize, &chunkOffset, &mesh->bounds, sizeof(BoundingBox));
+
+                        // NOTE: Attributes data size is validated against chunk size
+                        if ((meshInfo[0] > 0) && (meshInfo[0] <= chunkSize) && (meshInfo[1] >= 0) && (meshInfo[1] <= chunkSize) &&
+                            (meshInfo[3] >= 0) && (meshInfo[3] <= chunkSize))
+                        {
+                            int attributes = meshInfo[2];
+                            mesh->vertexCount = meshInfo[0];
+                            mesh->triangleCount = meshInfo[1];
+                            mesh->boneCount = meshInfo[3];
+
+                            if (attributes & RMDL_MESH_VERTICES) mesh->vertices = (float *)LoadRMDLArray(chunk, chunkSize, &chunkOffset, mesh->vertexCount, 3*sizeof(float));
+                            if (attributes & RMDL_MESH_TEXCOORDS) mesh->texcoords = (float *)LoadRMDLArray(chunk, chunkSize, &chunkOffset, mesh->vertexCount, 2*sizeof(float));
+                            if (attributes & RMDL_MESH_TEXCOORDS2) mesh->texcoords2 = (float *)LoadRMDLArray(chunk, chunkSize, &chunkOffset, mesh->vertexCount, 2*sizeof(float));
+                            if (attributes & RMDL_MESH_NORMALS) mesh->normals = (float *)LoadRMDLArray(chunk, chunkSize, &chunkOffset, mesh->vertexCount, 3*sizeof(float));
+                            if (attributes & RMDL_MESH_TANGENTS) mesh->tangents = (float *)LoadRMDLArray(chunk, chunkSize, &chunkOffset, mesh->vertexCount, 4*sizeof(float));
+                            if (attributes & RMDL_MESH_COLORS) mesh->colors = (unsigned char *)LoadRMDLArray(chunk, chunkSize, &chunkOffset, mesh->vertexCount, 4*sizeof(unsigned char));
+                            if (attributes & RMDL_MESH_INDICES) mesh->indices = (unsigned short *)LoadRMDLArray(chunk, chunkSize, &chunkOffset, mesh->triangleCount, 3*sizeof(unsigned short));
+                            else if (attributes & RMDL_MESH_INDICES32) mesh->indices32 = (unsigned int *)LoadRMDLArray(chunk, chunkSize, &chunkOffset, mesh->triangleCount, 3*sizeof(unsigned int));
+                            if (attributes & RMDL_MESH_BONEIDS) mesh->boneIds = (unsigned char *)LoadRMDLArray(chunk, chunkSize, &chunkOffset, mesh->vertexCount, 4*sizeof(unsigned char));
+                            if (attributes & RMDL_MESH_BONEWEIGHTS) mesh->boneWeights = (float *)LoadRMDLArray(chunk, chunkSize, &chunkOffset, mesh->vertexCount, 4*sizeof(float));
+
+                            if ((mesh->vertices != NULL) && (mesh->boneIds != NULL) && (mesh->boneWeights != NULL))
+                            {
+                                // Animated vertex data
+                                mesh->animVertices = (float *)RL_CALLOC(mesh->vertexCount*3, sizeof(float));
+                                memcpy(mesh->animVertices, mesh->vertices, mesh->vertexCount*3*sizeof(float));
+                                mesh->animNormals = (float *)RL_CALLOC(mesh->vertexCount*3, sizeof(float));
+                                if (mesh->normals != NULL) memcpy(mesh->animNormals, mesh->normals, mesh->vertexCount*3*sizeof(float));
+
+                                // Bone transform matrices
+                                mesh->boneMatrices = (Matrix *)RL_CALLOC(mesh->boneCount, sizeof(Matrix));
+                                for (int j = 0; j < mesh->boneCount; j++) mesh->boneMatrices[j] = MatrixIdentity();
+                            }
+                        }
+
+                        meshIndex++;
+                    }
+
+                    offset += RMDL_CHUNK_HEADER_SIZE + chunkSize;
+                }
+
+                // Check all meshes have been loaded properly
+                for (int i = 0; i < model.meshCount; i++)
+                {
+                    if (model.meshes[i].vertices == NULL)
+                    {
+                        TRACELOG(LOG_WARNING, "MODEL: [%s] rMDL mesh data could not be loaded", fileName);
+                        UnloadModel(model);
+                        model = (Model){ 0 };
+                        break;
+                    }
+                }
+
+                if (model.meshCount > 0) TRACELOG(LOG_INFO, "MODEL: [%s] rMDL model loaded successfully: %i meshes / %i materials", fileName, model.meshCount, model.materialCount);
+            }
+        }
+        else TRACELOG(LOG_WARNING, "MODEL: [%s] rMDL file not valid", fileName);
+
+        UnmapFileData(mapping);
+    }
+
+    return model;
+}
+
+// Load rMDL animation data
+static ModelAnimation *LoadModelAnimationsRMDL(const char *fileName, int *animCount)
+{
+    ModelAnimation *animations = NULL;
+    int count = 0;
+
+    FileMapping mapping = MapFileData(fileName);
+
+    if (mapping.data != NULL)
+    {
+        const unsigned char *fileData = mapping.data;
+        int fileHeader[4] = { 0 };      // Version, chunks count, reserved
+
+        if ((mapping.size >= RMDL_HEADER_SIZE) && (memcmp(fileData, "rMDL", 4) == 0))
+        {
+            memcpy(fileHeader, fileData, RMDL_HEADER_SIZE);
+            if ((fileHeader[1] == RMDL_FILE_VERSION) && (fileHeader[2] > 0) && (fileHeader[2] <= mapping.size/RMDL_CHUNK_HEADER_SIZE))
+            {
+                animations = (ModelAnimation *)RL_CALLOC(fileHeader[2], sizeof(ModelAnimation));
+                long long offset = RMDL_HEADER_SIZE;
+
+                for (int c = 0; c < fileHeader[2]; c++)
+                {
+                    int chunkSize = GetRMDLChunkSize(mapping, offset);
+                    if (chunkSize < 0)
+                    {
+                        TRACELOG(LOG_WARNING, "MODEL: [%s] rMDL file data corrupted", fileName);
+                        break;
+                    }
+
+                    const unsigned char *chunk = fileData + offset + RMDL_CHUNK_HEADER_SIZE;
+                    int chunkOffset = 0;
+
+                    if (memcmp(fileData + offset, "ANIM", 4) == 0)
+                    {
+                        int animInfo[4] = { 0 };    // Bones count, frames count, reserved
+                        LoadRMDLData(chunk, chunkSize, &chunkOffset, animInfo, sizeof(animInfo));
+
+                        if ((animInfo[0] > 0) && (animInfo[0] <= chunkSize) && (animInfo[1] > 0) && (animInfo[1] <= chunkSize) &&
+                            ((size_t)animInfo[1] <= ((size_t)chunkSize/sizeof(Transform))/(size_t)animInfo[0]))
+                        {
+                            ModelAnimation *anim = &animations[count];
+                            anim->boneCount = animInfo[0];
+                            anim->frameCount = animInfo[1];
+                            LoadRMDLData(chunk, chunkSize, &chunkOffset, anim->name, sizeof(anim->name));
+                            anim->name[sizeof(anim->name) - 1] = '\0';
+                            anim->bones = (BoneInfo *)RL_CALLOC(anim->boneCount, sizeof(BoneInfo));
+                            LoadRMDLData(chunk, chunkSize, &chunkOffset, anim->bones, anim->boneCount*sizeof(BoneInfo));
+
+                            // NOTE: Frame poses are stored contiguously, no padding between frames
+                            anim->framePoses = (Transform **)RL_CALLOC(anim->frameCount, sizeof(Transform *));
+                            const unsigned char *poses = chunk + chunkOffset;
+                            bool valid = ((size_t)anim->frameCount*anim->boneCount*sizeof(Transform) <= (size_t)(chunkSize - chunkOffset));
+
+                            for (int f = 0; f < anim->frameCount; f++)
+                            {
+                                anim->framePoses[f] = (Transform *)RL_CALLOC(anim->boneCount, sizeof(Transform));
+                                if (valid) memcpy(anim->framePoses[f], poses + f*anim->boneCount*sizeof(Transform), anim->boneCount*sizeof(Transform));
+                            }
+
+                            count++;
+                        }
+                    }
+
+                    offset += RMDL_CHUNK_HEADER_SIZE + chunkSize;
+                }
+            }
+        }
+        else TRACELOG(LOG_WARNING, "MODEL: [%s] rMDL file not valid", fileName);
+
+        UnmapFileData(mapping);
+    }
+
+    if (count == 0)
+    {
+        RL_FREE(animations);
+        animations = NULL;
+    }
+
+    *animCount = count;
+    return animations;
+}
+
+// Get rMDL chunk data size at provided file offset, -1 if chunk is not valid
+static int GetRMDLChunkSize(FileMapping mapping, long long offset)
+{
+    int chunkSize = -1;
+
+    if ((offset + RMDL_CHUNK_HEADER_SIZE) <= mapping.size)
+    {
+        long long size = 0;
+        memcpy(&size, mapping.data + offset + 8, sizeof(long long));
+
+        if ((size >= 0) && (size <= 0x7fffffff) && ((offset + RMDL_CHUNK_HEADER_SIZE + size) <= mapping.size)) chunkSize = (int)size;
+    }
+
+    return chunkSize;
+}
+
+// Load data from rMDL chunk into provided buffer, chunk offset is moved to next aligned position
+// NOTE: Chunk offset is never moved beyond chunk size
+static bool LoadRMDLData(const unsigned char *chunk, int chunkSize, int *chunkOffset, void *data, size_t dataSize)
+{
+    bool result = false;
+
+    if ((*chunkOffset >= 0) && (*chunkOffset <= chunkSize) && (dataSize <= (size_t)(chunkSize - *chunkOffset)))
+    {
+        memcpy(data, chunk + *chunkOffset, dataSize);
+
+        long long nextOffset = *chunkOffset + RMDL_ALIGN((long long)dataSize);
+        *chunkOffset = (nextOffset < chunkSize)? (int)nextOffset : chunkSize;
+        result = true;
+    }
+
+    return result;
+}
+
+// Load array of elements from rMDL chunk, memory must be freed with RL_FREE(), NULL if data is not valid
+// NOTE: Elements count is checked against remaining chunk data before computing array size, to avoid overflows
+static void *LoadRMDLArray(const unsigned char *chunk, int chunkSize, int *chunkOffset, int count, int elementSize)
+{
+    void *data = NULL;
+
+    if ((count > 0) && (elementSize > 0) && (*chunkOffset >= 0) && (*chunkOffset <= chunkSize) &&
+        (count <= ((chunkSize - *chunkOffset)/elementSize)))
+    {
+        size_t dataSize = (size_t)count*elementSize;
+
+        data = RL_MALLOC(dataSize);
+        LoadRMDLData(chunk, chunkSize, chunkOffset, data, dataSize);
+    }
+
+    return data;
+}
+
+// Write rMDL file header, data is not written if buffer is NULL
+static void WriteRMDLHeader(unsigned char *fileData, int chunkCount)
+{
+    if (fileData != NULL)
+    {
+        int fileHeader[4] = { 0, RMDL_FILE_VERSION, chunkCount, 0 };
+        memcpy(fileData, fileHeader, RMDL_HEADER_SIZE);
+        memcpy(fileData, "rMDL", 4);
+    }
+}
+
+// Write rMDL chunk header, chunk size includes chunk header
+static void WriteRMDLChunkHeader(unsigned char *fileData, int offset, const char *type, int chunkSize)
+{
+    if (fileData != NULL)
+    {
+        long long size = chunkSize - RMDL_CHUNK_HEADER_SIZE;
+        memcpy(fileData + offset, type, 4);
+        memcpy(fileData + offset + 8, &size, sizeof(long long));
+    }
+}
+
+// Write data into rMDL buffer at offset, returns next aligned offset
+// NOTE: Data is not written if buffer or data are NULL, only offset is computed
+static int WriteRMDLData(unsigned char *fileData, int offset, const void *data, int dataSize)
+{
+    if ((fileData != NULL) && (data != NULL) && (dataSize > 0)) memcpy(fileData + offset, data, dataSize);
+
+    return offset + RMDL_ALIGN(dataSize);
+}
+#endif
+
 #endif      // SUPPORT_MODULE_RMODELS
@@ -16,6 +16,16 @@
 *           Selected desired fileformats to be supported for loading. Some of those formats are
 *           supported by default, to remove support, just comment unrequired #define in this module
 *
+*       #define SUPPORT_FONT_KERNING
+*           On TTF/OTF font loading [LoadFontFromMemory()], load glyphs kerning pairs used by text layout
+*           kerning [LoadTextLayoutEx()], fonts without 'kern' table are checked for GPOS kerning on every
+*           glyphs pair (up to FONT_KERNING_MAX_GLYPHS), dynamic fonts query kerning on use
+*
+*       #define SUPPORT_FONT_SDF_EDT
+*           On SDF font data generation [LoadFontData()], compute glyphs distance fields from glyphs
+*           rasterized bitmaps using an euclidean distance transform, a lot faster than computing exact
+*           distances to glyphs outlines [stbtt_GetGlyphSDF()] with similar results
+*
 *       #define SUPPORT_FONT_ATLAS_WHITE_REC
 *           On font atlas image generation [GenImageFontAtlas()], add a 3x3 pixels white rectangle
 *           at the bottom-right corner of the atlas. It can be useful to for shapes drawing, to allow
@@ -27,9 +37,13 @@
 *       #define MAX_TEXTSPLIT_COUNT
 *           TextSplit() function static substrings pointers array (pointing to static buffer)
 *
+*       #define FONT_CACHE_PAGE_SIZE
+*       #define FONT_CACHE_MAX_PAGES
+*           Dynamic fonts [LoadFontDynamic()] default atlas page size and maximum pages, glyphs are
+*           rasterized on first use and least recently used page is reused when all pages are full
+*
 *   DEPENDENCIES:
 *       stb_truetype  - Load TTF file and rasterize characters data
-*       stb_rect_pack - Rectangles packing algorithms, required for font atlas generation
 *
 *
 *   LICENSE: zlib/libpng
@@ -63,7 +77,7 @@
 #if defined(SUPPORT_MODULE_RTEXT)
 
 #include "utils.h"          // Required for: LoadFile*()
-#include "rlgl.h"           // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2 -> Only DrawTextPro()
+#include "rlgl.h"           // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2 -> DrawTextPro(), DrawTextLayout()
 
 #include <stdlib.h>         // Required for: malloc(), free()
 #include <stdio.h>          // Required for: vsprintf()
@@ -72,19 +86,7 @@
 #include <ctype.h>          // Required for: toupper(), tolower() [Used in TextToUpper(), TextToLower()]
 
 #if defined(SUPPORT_FILEFORMAT_TTF) || defined(SUPPORT_FILEFORMAT_BDF)
-    #if defined(__GNUC__) // GCC and Clang
-        #pragma GCC diagnostic push
-        #pragma GCC diagnostic ignored "-Wunused-function"
-    #endif
-
-    #define STB_RECT_PACK_IMPLEMENTATION
-    #include "external/stb_rect_pack.h"     // Required for: ttf/bdf font rectangles packaging
-
     #include <math.h>   // Required for: ttf/bdf font rectangles packaging
-
-    #if defined(__GNUC__) // GCC and Clang
-        #pragma GCC diagnostic pop
-    #endif
 #endif
 
 #if defined(SUPPORT_FILEFORMAT_TTF)
@@ -115,11 +117,103 @@
 #ifndef MAX_TEXTSPLIT_COUNT
     #define MAX_TEXTSPLIT_COUNT                  128        // Maximum number of substrings to split: TextSplit()
 #endif
+#ifndef FONT_CACHE_PAGE_SIZE
+    #define FONT_CACHE_PAGE_SIZE                 512        // Dynamic font atlas page default size (width and height)
+#endif
+#ifndef FONT_CACHE_MAX_PAGES
+    #define FONT_CACHE_MAX_PAGES                   4        // Dynamic font atlas default maximum pages, LRU page is reused after that
+#endif
+#ifndef FONT_KERNING_MAX_GLYPHS
+    #define FONT_KERNING_MAX_GLYPHS              256        // Maximum glyphs to look for kerning pairs on fonts without 'kern' table (GPOS)
+#endif
+#ifndef FONT_SDF_SUPERSAMPLING
+    #define FONT_SDF_SUPERSAMPLING                 2        // SDF glyph generation bitmap supersampling factor [SUPPORT_FONT_SDF_EDT]
+#endif
+#ifndef FONT_MSDF_CUBIC_SPLITS
+    #define FONT_MSDF_CUBIC_SPLITS                 4        // MSDF glyph generation, quadratic curves used to approximate a cubic curve (CFF fonts)
+#endif
+#ifndef FONT_MSDF_CELL_SIZE
+    #define FONT_MSDF_CELL_SIZE                    8        // MSDF glyph generation, pixels cell size for nearest edges lookup
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// Skyline rectangles packer node, defines a horizontal segment of the skyline
+typedef struct SkylineNode {
+    int x;                      // Segment start position
+    int y;                      // Segment height (top of the rectangles below)
+    int width;                  // Segment width
+} SkylineNode;
+
+// Skyline rectangles packer (bottom-left heuristic)
+typedef struct SkylinePacker {
+    int width;                  // Packing area width
+    int height;                 // Packing area height
+    int nodeCount;              // Skyline nodes count
+    SkylineNode *nodes;         // Skyline nodes (capacity: width)
+} SkylinePacker;
+
+// Rectangle to pack, required for sorting
+typedef struct PackingRect {
+    int width;                  // Rectangle width (including padding)
+    int height;                 // Rectangle height (including padding)
+    int index;                  // Rectangle index in provided array
+} PackingRect;
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// MSDF glyph outline edge, line or quadratic bezier curve (pixels space)
+typedef struct MsdfEdge {
+    Vector2 p0;                 // Edge start point
+    Vector2 p1;                 // Edge control point (quadratic curve only)
+    Vector2 p2;                 // Edge end point
+    bool curve;                 // Edge is a quadratic curve
+    int color;                  // Edge color channels mask (1: red, 2: green, 4: blue)
+    Rectangle bounds;           // Edge bounding box (including control point)
+} MsdfEdge;
+
+// Dynamic font atlas page
+typedef struct GlyphCachePage {
+    Texture2D texture;          // Page texture (VRAM)
+    Image image;                // Page image (RAM copy), GRAY_ALPHA
+    SkylinePacker packer;       // Page glyphs packer
+    int dirtyMinY;              // Page rows modified and pending for upload (start)
+    int dirtyMaxY;              // Page rows modified and pending for upload (end)
+    unsigned int lastUsed;      // Page last use tick, required for LRU reuse
+} GlyphCachePage;
+
+// Dynamic font glyphs cache
+// NOTE: Glyphs are rasterized on first use, Font.glyphs and Font.recs point to cache slots
+struct rGlyphCache {
+    unsigned char *fileData;    // Font file data (copy), required by stb_truetype
+    stbtt_fontinfo fontInfo;    // Font info for glyphs rasterization
+    float scaleFactor;          // Font scale factor for required pixel height
+    int ascent;                 // Font ascent (scaled), glyphs baseline
+
+    int fontSize;               // Font size (pixel height)
+    int padding;                // Glyphs padding on atlas pages
+    int pageSize;               // Atlas pages size
+    int pageCount;              // Atlas pages loaded
+    int maxPages;               // Atlas pages maximum
+    GlyphCachePage *pages;      // Atlas pages
+
+    int slotCount;              // Glyphs slots available (Font.glyphCount)
+    GlyphInfo *glyphs;          // Glyphs info data, shared with Font.glyphs
+    Rectangle *recs;            // Glyphs rectangles on pages, shared with Font.recs
+    int *slotPages;             // Glyphs slots page, -1 for free slots
+    int *freeSlots;             // Free slots stack
+    int freeCount;              // Free slots count
+
+    int *table;                 // Codepoint to slot hash table (slot + 1, 0 for empty)
+    int tableSize;              // Hash table size (power of two)
+
+    unsigned char *bitmap;      // Glyph rasterization scratch buffer
+    int bitmapSize;             // Glyph rasterization scratch buffer size
+
+    unsigned int tick;          // Use counter, increased on every text processed
+    int evictionCount;          // Pages evicted (reused) count
+};
+#endif
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -145,6 +239,37 @@ static Font LoadBMFont(const char *fileName);   // Load a BMFont file (AngelCode
 #if defined(SUPPORT_FILEFORMAT_BDF)
 static GlyphInfo *LoadFontDataBDF(const unsigned char *fileData, int dataSize, int *codepoints, int codepointCount, int *outFontSize);
 #endif
+static void DrawTextGlyph(Font font, int index, Vector2 position, float fontSize, Color tint); // Draw glyph by index in font
+static void InitSkylinePacker(SkylinePacker *packer, int width, int height);    // Init skyline packer (allocates nodes)
+static void ResetSkylinePacker(SkylinePacker *packer);                          // Reset skyline packer to empty area
+static bool PackSkylineRect(SkylinePacker *packer, int width, int height, int *x, int *y); // Pack rectangle, returns false if it does not fit
+static void UnloadSkylinePacker(SkylinePacker *packer);                         // Unload skyline packer nodes
+static int ComparePackingRects(const void *a, const void *b);                   // Compare rectangles to pack, required for sorting
+#if defined(SUPPORT_FILEFORMAT_TTF)
+#if defined(SUPPORT_FONT_KERNING)
+static KerningPair *LoadFontKerning(const unsigned char *fileData, int fontSize, const GlyphInfo *glyphs, int glyphCount, int *kerningCount); // Load kerning pairs for loaded glyphs
+static int CompareKerningPairs(const void *a, const void *b);                  // Compare kerning pairs, required for sorting
+#endif
+#if defined(SUPPORT_FONT_SDF_EDT)
+static unsigned char *LoadGlyphSDF(const stbtt_fontinfo *fontInfo, float scale, int glyph, int padding, unsigned char onEdge, float distScale, int *width, int *height, int *offsetX, int *offsetY); // Load glyph SDF from glyph bitmap distance transform
+static void DistanceTransform(float *grid, int *nearest, int width, int height); // Squared euclidean distance transform (in-place), with nearest feature pixel
+#endif
+static unsigned char *LoadGlyphMSDF(const stbtt_fontinfo *fontInfo, float scale, int glyph, int padding, unsigned char onEdge, float distScale, int *width, int *height, int *offsetX, int *offsetY); // Load glyph MSDF from glyph outline (RGBA)
+static void ColorMsdfContour(MsdfEdge *edges, int edgeCount, int *corners);     // Assign edges colors to contour, switching colors on corners
+static int GetMsdfCellEdges(const MsdfEdge *edges, int edgeCount, Rectangle cell, int *cellEdges); // Get edges that could be nearest to cell pixels for any channel
+static Vector2 GetMsdfEdgePoint(const MsdfEdge *edge, float t);                 // Get edge point at curve parameter
+static void GetMsdfEdgeDistance(const MsdfEdge *edge, Vector2 point, float *distance, float *orthogonality, float *param); // Get signed distance from point to edge
+static float GetMsdfPseudoDistance(const MsdfEdge *edge, Vector2 point, float distance, float param); // Get signed pseudo-distance from point to edge (extended on ends)
+static int SolveCubic(double a, double b, double c, double d, double *roots);  // Solve cubic equation (a*x^3 + b*x^2 + c*x + d = 0), returns roots count
+
+static int GetGlyphCacheIndex(rGlyphCache *cache, int codepoint);              // Get glyph slot for codepoint, rasterized on first use
+static bool LoadGlyphCacheSlot(rGlyphCache *cache, int slot, int codepoint);   // Rasterize codepoint glyph into slot
+static int AddGlyphCachePage(rGlyphCache *cache);                              // Add a new atlas page to cache, returns page index
+static int GetGlyphCacheLruPage(rGlyphCache *cache);                          // Get least recently used atlas page
+static void EvictGlyphCachePage(rGlyphCache *cache, int page);                 // Evict all glyphs from atlas page to reuse it
+static void UpdateGlyphCache(rGlyphCache *cache);                              // Upload modified atlas pages rows to GPU
+static void UnloadGlyphCache(rGlyphCache *cache);                              // Unload glyphs cache data and atlas pages
+#endif
 static int textLineSpacing = 2;                 // Text vertical line spacing in pixels (between lines)
 
 #if defined(SUPPORT_DEFAULT_FONT)
@@ -383,16 +508,16 @@ Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepoi
 {
     Font font = { 0 };
 
-    // Loading file to memory
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    // Mapping file to memory (no copy if supported)
+    FileMapping mapping = MapFileData(fileName);
 
-    if (fileData != NULL)
+    if (mapping.data != NULL)
     {
         // Loading font from memory data
-        font = LoadFontFromMemory(GetFileExtension(fileName), fileData, dataSize, fontSize, codepoints, codepointCount);
+        if (mapping.size <= 2147483647) font = LoadFontFromMemory(GetFileExtension(fileName), mapping.data, (int)mapping.size, fontSize, codepoints, codepointCount);
+        else TRACELOG(LOG_WARNING, "FONT: [%s] File is bigger than 2147483647 bytes", fileName);
 
-        UnloadFileData(fileData);
+        UnmapFileData(mapping);
     }
 
     return font;
@@ -540,6 +665,9 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
         TextIsEqual(fileExtLower, ".otf"))
     {
         font.glyphs = LoadFontData(fileData, dataSize, font.baseSize, codepoints, font.glyphCount, FONT_DEFAULT);
+    #if defined(SUPPORT_FONT_KERNING)
+        if (font.glyphs != NULL) font.kerning = LoadFontKerning(fileData, font.baseSize, font.glyphs, font.glyphCount, &font.kerningCount);
+    #endif
     }
     else
 #endif
@@ -559,7 +687,7 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
     {
         font.glyphPadding = FONT_TTF_DEFAULT_CHARS_PADDING;
 
-        Image atlas = GenImageFontAtlas(font.glyphs, &font.recs, font.glyphCount, font.baseSize, font.glyphPadding, 0);
+        Image atlas = GenImageFontAtlas(font.glyphs, &font.recs, font.glyphCount, font.baseSize, font.glyphPadding, 1);
         if (isGpuReady) font.texture = LoadTextureFromImage(atlas);
 
         // Update glyphs[i].image to use alpha, required to be used on ImageDrawText()
@@ -571,7 +699,7 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
 
         UnloadImage(atlas);
 
-        TRACELOG(LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs)", font.baseSize, font.glyphCount);
+        TRACELOG(LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs | %i kerning pairs)", font.baseSize, font.glyphCount, font.kerningCount);
     }
     else font = GetFontDefault();
 #else
@@ -581,6 +709,128 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
     return font;
 }
 
+// Load font for on-demand glyphs rasterization into atlas pages (TTF/OTF)
+// NOTE: No glyphs are rasterized on loading, every codepoint is rasterized and packed into
+// an atlas page on first use, when maxPages are full the least recently used page is reused
+// WARNING: Glyphs images are not loaded, ImageText*() functions require a static font
+Font LoadFontDynamic(const char *fileName, int fontSize, int pageSize, int maxPages)
+{
+    Font font = { 0 };
+
+    // Mapping file to memory (no copy if supported)
+    FileMapping mapping = MapFileData(fileName);
+
+    if (mapping.data != NULL)
+    {
+        // Loading font from memory data, font data is copied by the glyphs cache
+        if (mapping.size <= 2147483647) font = LoadFontDynamicFromMemory(GetFileExtension(fileName), mapping.data, (int)mapping.size, fontSize, pageSize, maxPages);
+        else TRACELOG(LOG_WARNING, "FONT: [%s] File is bigger than 2147483647 bytes", fileName);
+
+        UnmapFileData(mapping);
+    }
+
+    return font;
+}
+
+// Load dynamic font from memory buffer, fileType refers to extension: i.e. ".ttf"
+// NOTE: Font data is copied, it is required for glyphs rasterization until font is unloaded
+Font LoadFontDynamicFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int pageSize, int maxPages)
+{
+    Font font = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    char fileExtLower[16] = { 0 };
+    strncpy(fileExtLower, TextToLower(fileType), 16 - 1);
+
+    if ((fileData != NULL) && (dataSize > 0) &&
+        (TextIsEqual(fileExtLower, ".ttf") || TextIsEqual(fileExtLower, ".otf")))
+    {
+        if (fontSize <= 0) fontSize = FONT_TTF_DEFAULT_SIZE;
+        if (pageSize <= 0) pageSize = FONT_CACHE_PAGE_SIZE;
+        if (maxPages <= 0) maxPages = FONT_CACHE_MAX_PAGES;
+
+        rGlyphCache *cache = (rGlyphCache *)RL_CALLOC(1, sizeof(rGlyphCache));
+        cache->fileData = (unsigned char *)RL_MALLOC(dataSize);
+        memcpy(cache->fileData, fileData, dataSize);
+
+        if (stbtt_InitFont(&cache->fontInfo, cache->fileData, 0))
+        {
+            // Calculate font basic metrics
+            // NOTE: ascent is equivalent to font baseline
+            int ascent = 0, descent = 0, lineGap = 0;
+            stbtt_GetFontVMetrics(&cache->fontInfo, &ascent, &descent, &lineGap);
+
+            cache->scaleFactor = stbtt_ScaleForPixelHeight(&cache->fontInfo, (float)fontSize);
+            cache->ascent = (int)((float)ascent*cache->scaleFactor);
+            cache->fontSize = fontSize;
+            cache->padding = FONT_TTF_DEFAULT_CHARS_PADDING;
+
+            // Atlas pages must fit any font glyph, considering font bounding box and padding
+            int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+            stbtt_GetFontBoundingBox(&cache->fontInfo, &x0, &y0, &x1, &y1);
+            int glyphMaxSize = (int)ceilf((float)(((x1 - x0) > (y1 - y0))? (x1 - x0) : (y1 - y0))*cache->scaleFactor) + 2*cache->padding;
+            if (glyphMaxSize < (fontSize + 2*cache->padding)) glyphMaxSize = fontSize + 2*cache->padding;
+            if (pageSize < glyphMaxSize)
+            {
+                TRACELOG(LOG_INFO, "FONT: Dynamic font atlas page size increased to fit glyphs: %i -> %i", pageSize, glyphMaxSize);
+                pageSize = glyphMaxSize;
+            }
+
+            cache->pageSize = pageSize;
+            cache->maxPages = maxPages;
+            cache->pages = (GlyphCachePage *)RL_CALLOC(maxPages, sizeof(GlyphCachePage));
+
+            // Glyphs slots estimated from pages capacity, considering glyphs average width of half font size
+            int cellWidth = fontSize/2 + 2*cache->padding;
+            int cellHeight = fontSize + 2*cache->padding;
+            cache->slotCount = (pageSize/cellWidth)*(pageSize/cellHeight)*maxPages;
+            if (cache->slotCount < 128) cache->slotCount = 128;
+
+            cache->glyphs = (GlyphInfo *)RL_CALLOC(cache->slotCount, sizeof(GlyphInfo));
+            cache->recs = (Rectangle *)RL_CALLOC(cache->slotCount, sizeof(Rectangle));
+            cache->slotPages = (int *)RL_MALLOC(cache->slotCount*sizeof(int));
+            cache->freeSlots = (int *)RL_MALLOC(cache->slotCount*sizeof(int));
+
+            // NOTE: Slot 0 is reserved for fallback glyph '?', it is always available
+            for (int i = 0; i < cache->slotCount; i++) cache->slotPages[i] = -1;
+            for (int i = cache->slotCount - 1; i > 0; i--) cache->freeSlots[cache->freeCount++] = i;
+
+            cache->tableSize = 1;
+            while (cache->tableSize < 2*cache->slotCount) cache->tableSize <<= 1;
+            cache->table = (int *)RL_CALLOC(cache->tableSize, sizeof(int));
+
+            AddGlyphCachePage(cache);
+            LoadGlyphCacheSlot(cache, 0, 63);
+            UpdateGlyphCache(cache);
+
+            font.baseSize = fontSize;
+            font.glyphCount = cache->slotCount;
+            font.glyphPadding = cache->padding;
+            font.texture = cache->pages[0].texture;
+            font.recs = cache->recs;
+            font.glyphs = cache->glyphs;
+            font.cache = cache;
+
+            TRACELOG(LOG_INFO, "FONT: Dynamic font loaded successfully (%i pixel size | %i glyph slots | %ix%i pages, max %i)", fontSize, cache->slotCount, pageSize, pageSize, maxPages);
+        }
+        else
+        {
+            TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data");
+
+            RL_FREE(cache->fileData);
+            RL_FREE(cache);
+        }
+    }
+    else TRACELOG(LOG_WARNING, "FONT: Dynamic font requires TTF/OTF font data");
+#else
+    TRACELOG(LOG_WARNING, "FONT: Dynamic font requires TTF support (SUPPORT_FILEFORMAT_TTF)");
+#endif
+
+    if (font.cache == NULL) font = GetFontDefault();
+
+    return font;
+}
+
 // Check if a font is valid (font data loaded)
 // WARNING: GPU texture not checked
 bool IsFontValid(Font font)
@@ -594,7 +844,7 @@ bool IsFontValid(Font font)
 }
 
 // Load font data for further use
-// NOTE: Requires TTF font memory data and can generate SDF data
+// NOTE: Requires TTF font memory data and can generate SDF and MSDF data
 GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int type)
 {
     // NOTE: Using some SDF generation default values,
@@ -608,6 +858,9 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
 #ifndef FONT_SDF_PIXEL_DIST_SCALE
     #define FONT_SDF_PIXEL_DIST_SCALE     64.0f     // SDF font generation pixel distance scale
 #endif
+#ifndef FONT_MSDF_PIXEL_DIST_SCALE
+    #define FONT_MSDF_PIXEL_DIST_SCALE    32.0f     // MSDF font generation pixel distance scale
+#endif
 #ifndef FONT_BITMAP_ALPHA_THRESHOLD
     #define FONT_BITMAP_ALPHA_THRESHOLD     80      // Bitmap (B&W) font generation alpha threshold
 #endif
@@ -667,14 +920,25 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
                     switch (type)
                     {
                         case FONT_DEFAULT:
-                        case FONT_BITMAP: chars[i].image.data = stbtt_GetCodepointBitmap(&fontInfo, scaleFactor, scaleFactor, ch, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY); break;
-                        case FONT_SDF: if (ch != 32) chars[i].image.data = stbtt_GetCodepointSDF(&fontInfo, scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY); break;
+                        case FONT_BITMAP: chars[i].image.data = stbtt_GetGlyphBitmap(&fontInfo, scaleFactor, scaleFactor, index, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY); break;
+                        case FONT_SDF:
+                        {
+                            if (ch != 32)
+                            {
+                            #if defined(SUPPORT_FONT_SDF_EDT)
+                                chars[i].image.data = LoadGlyphSDF(&fontInfo, scaleFactor, index, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
+                            #else
+                                chars[i].image.data = stbtt_GetGlyphSDF(&fontInfo, scaleFactor, index, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
+                            #endif
+                            }
+                        } break;
+                        case FONT_MSDF: if (ch != 32) chars[i].image.data = LoadGlyphMSDF(&fontInfo, scaleFactor, index, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_MSDF_PIXEL_DIST_SCALE, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY); break;
                         default: break;
                     }
 
                     if (chars[i].image.data != NULL)    // Glyph data has been found in the font
                     {
-                        stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
+                        stbtt_GetGlyphHMetrics(&fontInfo, index, &chars[i].advanceX, NULL);
                         chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
 
                         if (chh > fontSize) TRACELOG(LOG_WARNING, "FONT: Character [0x%08x] size is bigger than expected font size", ch);
@@ -683,7 +947,7 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
                         chars[i].image.width = chw;
                         chars[i].image.height = chh;
                         chars[i].image.mipmaps = 1;
-                        chars[i].image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+                        chars[i].image.format = (type == FONT_MSDF)? PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 : PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
 
                         chars[i].offsetY += (int)((float)ascent*scaleFactor);
                     }
@@ -692,15 +956,15 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
                     // it could be further required for atlas packing
                     if (ch == 32)
                     {
-                        stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
+                        stbtt_GetGlyphHMetrics(&fontInfo, index, &chars[i].advanceX, NULL);
                         chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
 
                         Image imSpace = {
-                            .data = RL_CALLOC(chars[i].advanceX*fontSize, 2),
+                            .data = RL_CALLOC(chars[i].advanceX*fontSize, (type == FONT_MSDF)? 4 : 2),
                             .width = chars[i].advanceX,
                             .height = fontSize,
                             .mipmaps = 1,
-                            .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+                            .format = (type == FONT_MSDF)? PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 : PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
                         };
 
                         chars[i].image = imSpace;
@@ -722,6 +986,9 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
                     // TODO: Use some fallback glyph for codepoints not found in the font
                 }
             }
+
+            TRACELOG(LOG_INFO, "FONT: Glyphs data generated (%i glyphs | %s)", codepointCount,
+                (type == FONT_SDF)? "SDF" : ((type == FONT_MSDF)? "MSDF" : ((type == FONT_BITMAP)? "BITMAP" : "DEFAULT")));
         }
         else TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data");
 
@@ -732,6 +999,81 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
     return chars;
 }
 
+// Pack rectangles into atlas pages, using skyline algorithm (bottom-left)
+// NOTE: Rectangles width and height must be provided, position is computed considering padding around them,
+// if pages is NULL all rectangles are packed into a single page and 0 is returned if some of them do not fit,
+// otherwise pages are added as required and page -1 is set for rectangles bigger than page
+int PackRectangles(Rectangle *recs, int *pages, int count, int pageWidth, int pageHeight, int padding, float *efficiency)
+{
+    int pageCount = 0;
+    float packedArea = 0.0f;
+
+    if (efficiency != NULL) *efficiency = 0.0f;
+    if ((recs == NULL) || (count <= 0) || (pageWidth <= 0) || (pageHeight <= 0)) return pageCount;
+
+    // Bigger rectangles are packed first, it gives a lot better results
+    PackingRect *sorted = (PackingRect *)RL_MALLOC(count*sizeof(PackingRect));
+    for (int i = 0; i < count; i++) sorted[i] = (PackingRect){ (int)recs[i].width + 2*padding, (int)recs[i].height + 2*padding, i };
+    qsort(sorted, count, sizeof(PackingRect), ComparePackingRects);
+
+    int maxPages = (pages == NULL)? 1 : count;
+    SkylinePacker *packers = (SkylinePacker *)RL_CALLOC(maxPages, sizeof(SkylinePacker));
+    bool packed = true;
+
+    for (int i = 0; i < count; i++)
+    {
+        int index = sorted[i].index;
+        int page = -1;
+        int x = 0, y = 0;
+
+        if ((sorted[i].width == 0) || (sorted[i].height == 0)) page = 0;    // Empty rectangles do not require space
+        else
+        {
+            // Rectangle is packed into first page with space available, a new page is added otherwise
+            for (int p = 0; p < pageCount; p++)
+            {
+                if (PackSkylineRect(&packers[p], sorted[i].width, sorted[i].height, &x, &y)) { page = p; break; }
+            }
+
+            if ((page == -1) && (pageCount < maxPages) && (sorted[i].width <= pageWidth) && (sorted[i].height <= pageHeight))
+            {
+                InitSkylinePacker(&packers[pageCount], pageWidth, pageHeight);
+                PackSkylineRect(&packers[pageCount], sorted[i].width, sorted[i].height, &x, &y);
+                page = pageCount;
+                pageCount++;
+            }
+        }
+
+        if (page >= 0)
+        {
+            recs[index].x = (float)(x + padding);
+            recs[index].y = (float)(y + padding);
+            packedArea += recs[index].width*recs[index].height;
+        }
+        else
+        {
+            recs[index].x = 0;
+            recs[index].y = 0;
+            packed = false;
+
+            if (pages != NULL) TRACELOG(LOG_WARNING, "FONT: Rectangle (%i) is bigger than atlas page, not packed", index);
+        }
+
+        if (pages != NULL) pages[index] = page;
+    }
+
+    for (int p = 0; p < pageCount; p++) UnloadSkylinePacker(&packers[p]);
+    RL_FREE(packers);
+    RL_FREE(sorted);
+
+    if ((pageCount == 0) && packed) pageCount = 1;    // Only empty rectangles provided
+    if ((pages == NULL) && !packed) pageCount = 0;
+
+    if ((efficiency != NULL) && (pageCount > 0)) *efficiency = packedArea/((float)pageCount*pageWidth*pageHeight);
+
+    return pageCount;
+}
+
 // Generate image font atlas using chars info
 // NOTE: Packing method: 0-Default, 1-Skyline
 #if defined(SUPPORT_FILEFORMAT_TTF) || defined(SUPPORT_FILEFORMAT_BDF)
@@ -796,8 +1138,46 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
     }
 #endif
 
-    atlas.data = (unsigned char *)RL_CALLOC(1, atlas.width*atlas.height);   // Create a bitmap to store characters (8 bpp)
-    atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+    if (packMethod == 1)
+    {
+        // Skyline packing: smallest power-of-two atlas fitting all glyphs is used,
+        // starting from glyphs total area, atlas width is equal or twice the height
+        int reservedHeight = 0;
+    #if defined(SUPPORT_FONT_ATLAS_WHITE_REC)
+        reservedHeight = 3;     // Bottom rows are reserved for white rectangle
+    #endif
+        int glyphsArea = 0;
+        int sizeLog = 0;
+        float efficiency = 0.0f;
+
+        for (int i = 0; i < glyphCount; i++)
+        {
+            recs[i] = (Rectangle){ 0, 0, (float)glyphs[i].image.width, (float)glyphs[i].image.height };
+            glyphsArea += (glyphs[i].image.width + 2*padding)*(glyphs[i].image.height + 2*padding);
+        }
+
+        while ((sizeLog < 28) && ((1 << sizeLog) < glyphsArea)) sizeLog++;
+
+        for (; sizeLog < 28; sizeLog++)
+        {
+            atlas.width = 1 << ((sizeLog + 1)/2);
+            atlas.height = 1 << (sizeLog/2);
+
+            if (PackRectangles(recs, NULL, glyphCount, atlas.width, atlas.height - reservedHeight, padding, &efficiency) > 0) break;
+        }
+
+        TRACELOGD("FONT: Atlas glyphs packed (%i x %i | %.1f%% efficiency)", atlas.width, atlas.height, efficiency*100.0f);
+    }
+
+    // NOTE: MSDF glyphs (FONT_MSDF) are RGBA, atlas keeps glyphs channels
+    int bytesPerPixel = 1;
+    for (int i = 0; i < glyphCount; i++)
+    {
+        if (glyphs[i].image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) { bytesPerPixel = 4; break; }
+    }
+
+    atlas.data = (unsigned char *)RL_CALLOC(bytesPerPixel, atlas.width*atlas.height);   // Create a bitmap to store characters (8 bpp or 32 bpp)
+    atlas.format = (bytesPerPixel == 4)? PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 : PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
     atlas.mipmaps = 1;
 
     // DEBUG: We can see padding in the generated image setting a gray background...
@@ -839,10 +1219,8 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
             // Copy pixel data from glyph image to atlas
             for (int y = 0; y < glyphs[i].image.height; y++)
             {
-                for (int x = 0; x < glyphs[i].image.width; x++)
-                {
-                    ((unsigned char *)atlas.data)[(offsetY + y)*atlas.width + (offsetX + x)] = ((unsigned char *)glyphs[i].image.data)[y*glyphs[i].image.width + x];
-                }
+                memcpy((unsigned char *)atlas.data + ((offsetY + y)*atlas.width + offsetX)*bytesPerPixel,
+                    (unsigned char *)glyphs[i].image.data + y*glyphs[i].image.width*bytesPerPixel, glyphs[i].image.width*bytesPerPixel);
             }
 
             // Fill chars rectangles in atlas info
@@ -855,50 +1233,17 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
             offsetX += (glyphs[i].image.width + 2*padding);
         }
     }
-    else if (packMethod == 1)  // Use Skyline rect packing algorithm (stb_pack_rect)
+    else if (packMethod == 1)  // Use Skyline rect packing algorithm, glyphs rectangles already packed
     {
-        stbrp_context *context = (stbrp_context *)RL_MALLOC(sizeof(*context));
-        stbrp_node *nodes = (stbrp_node *)RL_MALLOC(glyphCount*sizeof(*nodes));
-
-        stbrp_init_target(context, atlas.width, atlas.height, nodes, glyphCount);
-        stbrp_rect *rects = (stbrp_rect *)RL_MALLOC(glyphCount*sizeof(stbrp_rect));
-
-        // Fill rectangles for packaging
-        for (int i = 0; i < glyphCount; i++)
-        {
-            rects[i].id = i;
-            rects[i].w = glyphs[i].image.width + 2*padding;
-            rects[i].h = glyphs[i].image.height + 2*padding;
-        }
-
-        // Package rectangles into atlas
-        stbrp_pack_rects(context, rects, glyphCount);
-
         for (int i = 0; i < glyphCount; i++)
         {
-            // It returns char rectangles in atlas
-            recs[i].x = rects[i].x + (float)padding;
-            recs[i].y = rects[i].y + (float)padding;
-            recs[i].width = (float)glyphs[i].image.width;
-            recs[i].height = (float)glyphs[i].image.height;
-
-            if (rects[i].was_packed)
+            // Copy pixel data from glyph image to atlas
+            for (int y = 0; y < glyphs[i].image.height; y++)
             {
-                // Copy pixel data from fc.data to atlas
-                for (int y = 0; y < glyphs[i].image.height; y++)
-                {
-                    for (int x = 0; x < glyphs[i].image.width; x++)
-                    {
-                        ((unsigned char *)atlas.data)[(rects[i].y + padding + y)*atlas.width + (rects[i].x + padding + x)] = ((unsigned char *)glyphs[i].image.data)[y*glyphs[i].image.width + x];
-                    }
-                }
+                memcpy((unsigned char *)atlas.data + (((int)recs[i].y + y)*atlas.width + (int)recs[i].x)*bytesPerPixel,
+                    (unsigned char *)glyphs[i].image.data + y*glyphs[i].image.width*bytesPerPixel, glyphs[i].image.width*bytesPerPixel);
             }
-            else TRACELOG(LOG_WARNING, "FONT: Failed to package character (%i)", i);
         }
-
-        RL_FREE(rects);
-        RL_FREE(nodes);
-        RL_FREE(context);
     }
 
 #if defined(SUPPORT_FONT_ATLAS_WHITE_REC)
@@ -907,25 +1252,26 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
     // shapes and text can be backed into a single draw call: SetShapesTexture()
     for (int i = 0, k = atlas.width*atlas.height - 1; i < 3; i++)
     {
-        ((unsigned char *)atlas.data)[k - 0] = 255;
-        ((unsigned char *)atlas.data)[k - 1] = 255;
-        ((unsigned char *)atlas.data)[k - 2] = 255;
+        memset((unsigned char *)atlas.data + (k - 2)*bytesPerPixel, 255, 3*bytesPerPixel);
         k -= atlas.width;
     }
 #endif
 
-    // Convert image data from GRAYSCALE to GRAY_ALPHA
-    unsigned char *dataGrayAlpha = (unsigned char *)RL_MALLOC(atlas.width*atlas.height*sizeof(unsigned char)*2); // Two channels
-
-    for (int i = 0, k = 0; i < atlas.width*atlas.height; i++, k += 2)
+    if (bytesPerPixel == 1)
     {
-        dataGrayAlpha[k] = 255;
-        dataGrayAlpha[k + 1] = ((unsigned char *)atlas.data)[i];
-    }
+        // Convert image data from GRAYSCALE to GRAY_ALPHA
+        unsigned char *dataGrayAlpha = (unsigned char *)RL_MALLOC(atlas.width*atlas.height*sizeof(unsigned char)*2); // Two channels
+
+        for (int i = 0, k = 0; i < atlas.width*atlas.height; i++, k += 2)
+        {
+            dataGrayAlpha[k] = 255;
+            dataGrayAlpha[k + 1] = ((unsigned char *)atlas.data)[i];
+        }
 
-    RL_FREE(atlas.data);
-    atlas.data = dataGrayAlpha;
-    atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+        RL_FREE(atlas.data);
+        atlas.data = dataGrayAlpha;
+        atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+    }
 
     *glyphRecs = recs;
 
@@ -950,9 +1296,17 @@ void UnloadFont(Font font)
     // NOTE: Make sure font is not default font (fallback)
     if (font.texture.id != GetFontDefault().texture.id)
     {
-        UnloadFontData(font.glyphs, font.glyphCount);
-        if (isGpuReady) UnloadTexture(font.texture);
-        RL_FREE(font.recs);
+#if defined(SUPPORT_FILEFORMAT_TTF)
+        // NOTE: Dynamic font glyphs, recs and atlas pages are owned by the glyphs cache
+        if (font.cache != NULL) UnloadGlyphCache(font.cache);
+        else
+#endif
+        {
+            UnloadFontData(font.glyphs, font.glyphCount);
+            if (isGpuReady) UnloadTexture(font.texture);
+            RL_FREE(font.recs);
+            RL_FREE(font.kerning);
+        }
 
         TRACELOGD("FONT: Unloaded font data from RAM and VRAM");
     }
@@ -969,6 +1323,12 @@ bool ExportFontAsCode(Font font, const char *fileName)
 
     #define MAX_FONT_DATA_SIZE      1024*1024       // 1 MB
 
+    if (font.cache != NULL)
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] Dynamic font can not be exported as code", fileName);
+        return success;
+    }
+
     // Get file name from path
     char fileNamePascal[256] = { 0 };
     strncpy(fileNamePascal, TextToPascal(GetFileNameWithoutExt(fileName)), 256 - 1);
@@ -1112,6 +1472,28 @@ bool ExportFontAsCode(Font font, const char *fileName)
     return success;
 }
 
+// Get dynamic font cache stats: glyphs cached, atlas pages in use and pages evicted
+// NOTE: Atlas pages VRAM usage: pageCount*pageSize*pageSize*2 bytes (GRAY_ALPHA)
+void GetFontDynamicStats(Font font, int *glyphCount, int *pageCount, int *evictionCount)
+{
+    int glyphs = 0;
+    int pages = 0;
+    int evictions = 0;
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if (font.cache != NULL)
+    {
+        glyphs = font.cache->slotCount - font.cache->freeCount;
+        pages = font.cache->pageCount;
+        evictions = font.cache->evictionCount;
+    }
+#endif
+
+    if (glyphCount != NULL) *glyphCount = glyphs;
+    if (pageCount != NULL) *pageCount = pages;
+    if (evictionCount != NULL) *evictionCount = evictions;
+}
+
 // Draw current FPS
 // NOTE: Uses default font
 void DrawFPS(int posX, int posY)
@@ -1151,6 +1533,23 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
 
     int size = TextLength(text);    // Total size in bytes of the text, scanned by codepoints in loop
 
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if (font.cache != NULL)
+    {
+        // Dynamic font: rasterize missing glyphs first, modified atlas pages are uploaded once
+        font.cache->tick++;
+
+        for (int i = 0; i < size;)
+        {
+            int codepointByteCount = 0;
+            GetGlyphCacheIndex(font.cache, GetCodepointNext(&text[i], &codepointByteCount));
+            i += codepointByteCount;
+        }
+
+        UpdateGlyphCache(font.cache);
+    }
+#endif
+
     float textOffsetY = 0;          // Offset between lines (on linebreak '\n')
     float textOffsetX = 0.0f;       // Offset X to next character to draw
 
@@ -1173,7 +1572,7 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
         {
             if ((codepoint != ' ') && (codepoint != '\t'))
             {
-                DrawTextCodepoint(font, codepoint, (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
+                DrawTextGlyph(font, index, (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
             }
 
             if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
@@ -1204,22 +1603,8 @@ void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSiz
     // Character index position in sprite font
     // NOTE: In case a codepoint is not available in the font, index returned points to '?'
     int index = GetGlyphIndex(font, codepoint);
-    float scaleFactor = fontSize/font.baseSize;     // Character quad scaling factor
-
-    // Character destination rectangle on screen
-    // NOTE: We consider glyphPadding on drawing
-    Rectangle dstRec = { position.x + font.glyphs[index].offsetX*scaleFactor - (float)font.glyphPadding*scaleFactor,
-                      position.y + font.glyphs[index].offsetY*scaleFactor - (float)font.glyphPadding*scaleFactor,
-                      (font.recs[index].width + 2.0f*font.glyphPadding)*scaleFactor,
-                      (font.recs[index].height + 2.0f*font.glyphPadding)*scaleFactor };
-
-    // Character source rectangle from font texture atlas
-    // NOTE: We consider chars padding when drawing, it could be required for outline/glow shader effects
-    Rectangle srcRec = { font.recs[index].x - (float)font.glyphPadding, font.recs[index].y - (float)font.glyphPadding,
-                         font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
 
-    // Draw the character texture on the screen
-    DrawTexturePro(font.texture, srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
+    DrawTextGlyph(font, index, position, fontSize, tint);
 }
 
 // Draw multiple character (codepoints)
@@ -1230,6 +1615,16 @@ void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Ve
 
     float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
 
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if (font.cache != NULL)
+    {
+        // Dynamic font: rasterize missing glyphs first, modified atlas pages are uploaded once
+        font.cache->tick++;
+        for (int i = 0; i < codepointCount; i++) GetGlyphCacheIndex(font.cache, codepoints[i]);
+        UpdateGlyphCache(font.cache);
+    }
+#endif
+
     for (int i = 0; i < codepointCount; i++)
     {
         int index = GetGlyphIndex(font, codepoints[i]);
@@ -1244,7 +1639,7 @@ void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Ve
         {
             if ((codepoints[i] != ' ') && (codepoints[i] != '\t'))
             {
-                DrawTextCodepoint(font, codepoints[i], (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
+                DrawTextGlyph(font, index, (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
             }
 
             if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
@@ -1253,80 +1648,359 @@ void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Ve
     }
 }
 
-// Set vertical line spacing when drawing with line-breaks
-void SetTextLineSpacing(int spacing)
+// Load text layout: decode text and compute glyphs quads once
+// NOTE: Layout follows DrawTextEx() rules, font must be kept loaded while layout is in use
+TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing)
 {
-    textLineSpacing = spacing;
+    return LoadTextLayoutEx(font, text, fontSize, spacing, 0.0f, false);
 }
 
-// Measure string width for default font
-int MeasureText(const char *text, int fontSize)
+// Load text layout with words wrapping (wrapWidth > 0) and font kerning
+// NOTE: Words longer than wrapWidth are broken at characters, spaces at wrapping points are kept at line end
+TextLayout LoadTextLayoutEx(Font font, const char *text, float fontSize, float spacing, float wrapWidth, bool kerning)
 {
-    Vector2 textSize = { 0.0f, 0.0f };
+    TextLayout layout = { 0 };
 
-    // Check if default font has been loaded
-    if (GetFontDefault().texture.id != 0)
-    {
-        int defaultFontSize = 10;   // Default Font chars height in pixel
-        if (fontSize < defaultFontSize) fontSize = defaultFontSize;
-        int spacing = fontSize/defaultFontSize;
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
 
-        textSize = MeasureTextEx(GetFontDefault(), text, (float)fontSize, (float)spacing);
-    }
+    layout.font = font;
+    layout.fontSize = fontSize;
+    layout.spacing = spacing;
+    layout.wrapWidth = wrapWidth;
+    layout.kerning = kerning;
 
-    return (int)textSize.x;
+    UpdateTextLayout(&layout, text, 0);
+
+    return layout;
 }
 
-// Measure string size for Font
-Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing)
+// Update text layout for text changed from textStart (bytes)
+// NOTE: Text before textStart must be unchanged, lines before the changed one are kept
+// and layout is computed again from there (from the line the changed word started on
+// and the previous one if wrapping, they could change), lines first character is not kerned
+void UpdateTextLayout(TextLayout *layout, const char *text, int textStart)
 {
-    Vector2 textSize = { 0 };
-
-    if ((isGpuReady && (font.texture.id == 0)) || 
-        (text == NULL) || (text[0] == '\0')) return textSize; // Security check
-
-    int size = TextLength(text);    // Get size in bytes of text
-    int tempByteCounter = 0;        // Used to count longer text line num chars
-    int byteCounter = 0;
+    Font font = layout->font;
+    int size = ((text != NULL) && (font.glyphs != NULL))? TextLength(text) : 0;
 
-    float textWidth = 0.0f;
-    float tempTextWidth = 0.0f;     // Used to count longer text line width
+    // Look for the line to restart layout from
+    int line = 0;
+    while ((line < (layout->lineCount - 1)) && (layout->lines[line + 1].textStart <= textStart)) line++;
 
-    float textHeight = fontSize;
-    float scaleFactor = fontSize/(float)font.baseSize;
+    if (layout->wrapWidth > 0.0f)
+    {
+        // Lines starting in the middle of a word (broken at characters) depend on the line the word started on
+        while ((line > 0) && (layout->lines[line].textStart <= size))
+        {
+            char separator = text[layout->lines[line].textStart - 1];
+            if ((separator == ' ') || (separator == '\t') || (separator == '\n')) break;
+            line--;
+        }
 
-    int letter = 0;                 // Current character
-    int index = 0;                  // Index position in sprite font
+        if (line > 0) line--;
+    }
 
-    for (int i = 0; i < size;)
+    int position = 0;           // Text position (bytes) to layout from
+    if ((line < layout->lineCount) && (layout->lines[line].textStart <= size))
     {
-        byteCounter++;
+        position = layout->lines[line].textStart;
+        layout->glyphCount = layout->lines[line].glyphStart;
+        layout->lineCount = line;
+    }
+    else
+    {
+        layout->glyphCount = 0;
+        layout->lineCount = 0;
+    }
 
+    // NOTE: Text size in bytes is an upper bound for glyphs and lines count
+    layout->codepoints = (int *)RL_REALLOC(layout->codepoints, (size + 1)*sizeof(int));
+    layout->recs = (Rectangle *)RL_REALLOC(layout->recs, (size + 1)*sizeof(Rectangle));
+    layout->texcoords = (Rectangle *)RL_REALLOC(layout->texcoords, (size + 1)*sizeof(Rectangle));
+    layout->lines = (TextLine *)RL_REALLOC(layout->lines, (size + 1)*sizeof(TextLine));
+
+    float scaleFactor = layout->fontSize/font.baseSize;     // Character quad scaling factor
+    float padding = (float)font.glyphPadding;
+    float lineHeight = layout->fontSize + textLineSpacing;  // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
+
+    TextLine current = { position, 0, layout->glyphCount, 0, 0.0f, layout->lineCount*lineHeight };
+    float textOffsetX = 0.0f;   // Offset X to next character
+    float lineEndX = 0.0f;      // Line width up to last character (excluding spacing)
+    float wordEndX = 0.0f;      // Line width up to last non-space character
+    int wrapPosition = -1;      // Next word start position, available for wrapping
+    int wrapGlyph = 0;          // Next word first glyph quad
+    float wrapWidth = 0.0f;     // Line width if wrapped at next word start
+    float wrapOffsetX = 0.0f;   // Next word start offset X
+    float wrapKerning = 0.0f;   // Next word first character kerning, removed if wrapped
+    int previous = 0;           // Previous codepoint, required for kerning (reset on line break)
+
+    for (int i = position; i < size;)
+    {
         int codepointByteCount = 0;
-        letter = GetCodepointNext(&text[i], &codepointByteCount);
-        index = GetGlyphIndex(font, letter);
-
-        i += codepointByteCount;
+        int codepoint = GetCodepointNext(&text[i], &codepointByteCount);
+        int index = GetGlyphIndex(font, codepoint);
 
-        if (letter != '\n')
+        if (codepoint == '\n')
         {
-            if (font.glyphs[index].advanceX > 0) textWidth += font.glyphs[index].advanceX;
-            else textWidth += (font.recs[index].width + font.glyphs[index].offsetX);
+            current.textLength = i + codepointByteCount - current.textStart;
+            current.glyphCount = layout->glyphCount - current.glyphStart;
+            current.width = lineEndX;
+            layout->lines[layout->lineCount++] = current;
+
+            current = (TextLine){ i + codepointByteCount, 0, layout->glyphCount, 0, 0.0f, layout->lineCount*lineHeight };
+            textOffsetX = lineEndX = wordEndX = 0.0f;
+            wrapPosition = -1;
+            previous = 0;
         }
         else
         {
-            if (tempTextWidth < textWidth) tempTextWidth = textWidth;
-            byteCounter = 0;
-            textWidth = 0;
+            bool space = ((codepoint == ' ') || (codepoint == '\t'));
+            float kerningAdvance = (layout->kerning && (previous != 0))? GetGlyphKerning(font, previous, codepoint)*scaleFactor : 0.0f;
+            float advance = ((font.glyphs[index].advanceX == 0)? (float)font.recs[index].width : (float)font.glyphs[index].advanceX)*scaleFactor;
 
-            // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
-            textHeight += (fontSize + textLineSpacing);
-        }
-
-        if (tempByteCounter < byteCounter) tempByteCounter = byteCounter;
-    }
+            // Wrap line if character does not fit, at last word start or at current character
+            // NOTE: Word moved to new line could still not fit, then it is also broken at current character
+            while ((layout->wrapWidth > 0.0f) && !space && (i > current.textStart) && ((textOffsetX + kerningAdvance + advance) > layout->wrapWidth))
+            {
+                int breakPosition = (wrapPosition > current.textStart)? wrapPosition : i;
+                int breakGlyph = (wrapPosition > current.textStart)? wrapGlyph : layout->glyphCount;
+                float breakOffsetX = (wrapPosition > current.textStart)? (wrapOffsetX + wrapKerning) : textOffsetX;
 
-    if (tempTextWidth < textWidth) tempTextWidth = textWidth;
+                current.textLength = breakPosition - current.textStart;
+                current.glyphCount = breakGlyph - current.glyphStart;
+                current.width = (wrapPosition > current.textStart)? wrapWidth : lineEndX;
+                layout->lines[layout->lineCount++] = current;
+
+                // Move already placed word glyphs to new line
+                for (int g = breakGlyph; g < layout->glyphCount; g++)
+                {
+                    layout->recs[g].x -= breakOffsetX;
+                    layout->recs[g].y += lineHeight;
+                }
+
+                current = (TextLine){ breakPosition, 0, breakGlyph, 0, 0.0f, layout->lineCount*lineHeight };
+                textOffsetX -= breakOffsetX;
+                lineEndX = ((lineEndX - breakOffsetX) > 0.0f)? (lineEndX - breakOffsetX) : 0.0f;
+                wordEndX = lineEndX;
+                wrapPosition = -1;
+
+                // Current character starts the new line, not kerned with previous line last character
+                if (breakPosition == i)
+                {
+                    previous = 0;
+                    kerningAdvance = 0.0f;
+                }
+            }
+
+            if (i == wrapPosition) wrapKerning = kerningAdvance;
+            textOffsetX += kerningAdvance;
+
+            if (!space)
+            {
+                Rectangle rec = font.recs[index];
+
+                // Glyph quad and texture coordinates, considering glyphPadding (same as DrawTextCodepoint())
+                layout->codepoints[layout->glyphCount] = codepoint;
+                layout->recs[layout->glyphCount] = (Rectangle){ textOffsetX + (font.glyphs[index].offsetX - padding)*scaleFactor,
+                    current.offsetY + (font.glyphs[index].offsetY - padding)*scaleFactor,
+                    (rec.width + 2.0f*padding)*scaleFactor, (rec.height + 2.0f*padding)*scaleFactor };
+
+                if (font.texture.id > 0)
+                {
+                    layout->texcoords[layout->glyphCount] = (Rectangle){ (rec.x - padding)/font.texture.width, (rec.y - padding)/font.texture.height,
+                        (rec.width + 2.0f*padding)/font.texture.width, (rec.height + 2.0f*padding)/font.texture.height };
+                }
+                else layout->texcoords[layout->glyphCount] = (Rectangle){ 0 };
+
+                layout->glyphCount++;
+            }
+
+            lineEndX = textOffsetX + advance;
+            textOffsetX += (advance + layout->spacing);
+
+            if (!space) wordEndX = lineEndX;
+            else
+            {
+                wrapPosition = i + codepointByteCount;
+                wrapGlyph = layout->glyphCount;
+                wrapWidth = wordEndX;
+                wrapOffsetX = textOffsetX;
+                wrapKerning = 0.0f;
+            }
+
+            previous = codepoint;
+        }
+
+        i += codepointByteCount;
+    }
+
+    // Close last line, empty text has no lines
+    if (size > 0)
+    {
+        current.textLength = size - current.textStart;
+        current.glyphCount = layout->glyphCount - current.glyphStart;
+        current.width = lineEndX;
+        layout->lines[layout->lineCount++] = current;
+    }
+
+    layout->size = (Vector2){ 0 };
+    for (int l = 0; l < layout->lineCount; l++)
+    {
+        if (layout->lines[l].width > layout->size.x) layout->size.x = layout->lines[l].width;
+    }
+    if (layout->lineCount > 0) layout->size.y = layout->lineCount*lineHeight - textLineSpacing;
+}
+
+// Unload text layout data
+void UnloadTextLayout(TextLayout layout)
+{
+    RL_FREE(layout.codepoints);
+    RL_FREE(layout.recs);
+    RL_FREE(layout.texcoords);
+    RL_FREE(layout.lines);
+}
+
+// Draw text layout, glyphs quads are copied to render batch
+// NOTE: No glyphs lookup or quads computation required, only one texture change per layout
+void DrawTextLayout(TextLayout layout, Vector2 position, Color tint)
+{
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if (layout.font.cache != NULL)
+    {
+        // Dynamic font: glyphs could have been evicted and placed on a different
+        // atlas page since layout was loaded, they are looked up on drawing
+        // NOTE: Missing glyphs are rasterized first, modified atlas pages are uploaded once
+        rGlyphCache *cache = layout.font.cache;
+        cache->tick++;
+
+        for (int i = 0; i < layout.glyphCount; i++) GetGlyphCacheIndex(cache, layout.codepoints[i]);
+
+        UpdateGlyphCache(cache);
+
+        for (int i = 0; i < layout.glyphCount; i++)
+        {
+            int index = GetGlyphCacheIndex(cache, layout.codepoints[i]);
+            if (cache->slotPages[index] < 0) continue;      // Glyph not available (fallback glyph could not be packed)
+
+            Rectangle rec = cache->recs[index];
+            Rectangle srcRec = { rec.x - cache->padding, rec.y - cache->padding, rec.width + 2.0f*cache->padding, rec.height + 2.0f*cache->padding };
+            Rectangle dstRec = { position.x + layout.recs[i].x, position.y + layout.recs[i].y, layout.recs[i].width, layout.recs[i].height };
+
+            DrawTexturePro(cache->pages[cache->slotPages[index]].texture, srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
+        }
+    }
+    else
+#endif
+    if ((layout.glyphCount > 0) && (layout.font.texture.id > 0))
+    {
+        rlSetTexture(layout.font.texture.id);
+        rlBegin(RL_QUADS);
+
+            rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+            rlNormal3f(0.0f, 0.0f, 1.0f);               // Normal vector pointing towards viewer
+
+            for (int i = 0; i < layout.glyphCount; i++)
+            {
+                Rectangle rec = layout.recs[i];
+                Rectangle texcoord = layout.texcoords[i];
+                float x = position.x + rec.x;
+                float y = position.y + rec.y;
+
+                // Top-left, bottom-left, bottom-right and top-right corners (same as DrawTexturePro())
+                rlTexCoord2f(texcoord.x, texcoord.y);
+                rlVertex2f(x, y);
+                rlTexCoord2f(texcoord.x, texcoord.y + texcoord.height);
+                rlVertex2f(x, y + rec.height);
+                rlTexCoord2f(texcoord.x + texcoord.width, texcoord.y + texcoord.height);
+                rlVertex2f(x + rec.width, y + rec.height);
+                rlTexCoord2f(texcoord.x + texcoord.width, texcoord.y);
+                rlVertex2f(x + rec.width, y);
+            }
+
+        rlEnd();
+        rlSetTexture(0);
+    }
+}
+
+// Set vertical line spacing when drawing with line-breaks
+void SetTextLineSpacing(int spacing)
+{
+    textLineSpacing = spacing;
+}
+
+// Measure string width for default font
+int MeasureText(const char *text, int fontSize)
+{
+    Vector2 textSize = { 0.0f, 0.0f };
+
+    // Check if default font has been loaded
+    if (GetFontDefault().texture.id != 0)
+    {
+        int defaultFontSize = 10;   // Default Font chars height in pixel
+        if (fontSize < defaultFontSize) fontSize = defaultFontSize;
+        int spacing = fontSize/defaultFontSize;
+
+        textSize = MeasureTextEx(GetFontDefault(), text, (float)fontSize, (float)spacing);
+    }
+
+    return (int)textSize.x;
+}
+
+// Measure string size for Font
+Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing)
+{
+    Vector2 textSize = { 0 };
+
+    if ((isGpuReady && (font.texture.id == 0)) || 
+        (text == NULL) || (text[0] == '\0')) return textSize; // Security check
+
+    int size = TextLength(text);    // Get size in bytes of text
+    int tempByteCounter = 0;        // Used to count longer text line num chars
+    int byteCounter = 0;
+
+    float textWidth = 0.0f;
+    float tempTextWidth = 0.0f;     // Used to count longer text line width
+
+    float textHeight = fontSize;
+    float scaleFactor = fontSize/(float)font.baseSize;
+
+    int letter = 0;                 // Current character
+    int index = 0;                  // Index position in sprite font
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    // NOTE: Dynamic font glyphs rasterized for measuring are uploaded on drawing
+    if (font.cache != NULL) font.cache->tick++;
+#endif
+
+    for (int i = 0; i < size;)
+    {
+        byteCounter++;
+
+        int codepointByteCount = 0;
+        letter = GetCodepointNext(&text[i], &codepointByteCount);
+        index = GetGlyphIndex(font, letter);
+
+        i += codepointByteCount;
+
+        if (letter != '\n')
+        {
+            if (font.glyphs[index].advanceX > 0) textWidth += font.glyphs[index].advanceX;
+            else textWidth += (font.recs[index].width + font.glyphs[index].offsetX);
+        }
+        else
+        {
+            if (tempTextWidth < textWidth) tempTextWidth = textWidth;
+            byteCounter = 0;
+            textWidth = 0;
+
+            // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
+            textHeight += (fontSize + textLineSpacing);
+        }
+
+        if (tempByteCounter < byteCounter) tempByteCounter = byteCounter;
+    }
+
+    if (tempTextWidth < textWidth) tempTextWidth = textWidth;
 
     textSize.x = tempTextWidth*scaleFactor + (float)((tempByteCounter - 1)*spacing);
     textSize.y = textHeight;
@@ -1340,6 +2014,11 @@ int GetGlyphIndex(Font font, int codepoint)
 {
     int index = 0;
 
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    // Dynamic font: glyph is rasterized into cache on first use
+    if (font.cache != NULL) return GetGlyphCacheIndex(font.cache, codepoint);
+#endif
+
 #define SUPPORT_UNORDERED_CHARSET
 #if defined(SUPPORT_UNORDERED_CHARSET)
     int fallbackIndex = 0;      // Get index of fallback glyph '?'
@@ -1386,6 +2065,42 @@ Rectangle GetGlyphAtlasRec(Font font, int codepoint)
     return rec;
 }
 
+// Get kerning advance adjustment between two codepoints, in pixels at font base size
+// NOTE: Kerning pairs are loaded with TTF/OTF fonts (SUPPORT_FONT_KERNING), dynamic fonts query font data directly
+float GetGlyphKerning(Font font, int codepoint, int nextCodepoint)
+{
+    float advance = 0.0f;
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if (font.cache != NULL)
+    {
+        advance = (float)stbtt_GetCodepointKernAdvance(&font.cache->fontInfo, codepoint, nextCodepoint)*font.cache->scaleFactor;
+    }
+    else
+#endif
+    {
+        // Binary search on kerning pairs, sorted by first and second characters
+        int low = 0;
+        int high = font.kerningCount - 1;
+
+        while (low <= high)
+        {
+            int mid = (low + high)/2;
+            KerningPair pair = font.kerning[mid];
+
+            if ((pair.first == codepoint) && (pair.second == nextCodepoint))
+            {
+                advance = pair.advance;
+                break;
+            }
+            else if ((pair.first < codepoint) || ((pair.first == codepoint) && (pair.second < nextCodepoint))) low = mid + 1;
+            else high = mid - 1;
+        }
+    }
+
+    return advance;
+}
+
 //----------------------------------------------------------------------------------
 // Text strings management functions
 //----------------------------------------------------------------------------------
@@ -2135,6 +2850,40 @@ int GetCodepointPrevious(const char *text, int *codepointSize)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+// Draw glyph by index in font
+// NOTE: Glyph index must be valid, it is already resolved by callers
+static void DrawTextGlyph(Font font, int index, Vector2 position, float fontSize, Color tint)
+{
+    float scaleFactor = fontSize/font.baseSize;     // Character quad scaling factor
+
+    // Character destination rectangle on screen
+    // NOTE: We consider glyphPadding on drawing
+    Rectangle dstRec = { position.x + font.glyphs[index].offsetX*scaleFactor - (float)font.glyphPadding*scaleFactor,
+                      position.y + font.glyphs[index].offsetY*scaleFactor - (float)font.glyphPadding*scaleFactor,
+                      (font.recs[index].width + 2.0f*font.glyphPadding)*scaleFactor,
+                      (font.recs[index].height + 2.0f*font.glyphPadding)*scaleFactor };
+
+    // Character source rectangle from font texture atlas
+    // NOTE: We consider chars padding when drawing, it could be required for outline/glow shader effects
+    Rectangle srcRec = { font.recs[index].x - (float)font.glyphPadding, font.recs[index].y - (float)font.glyphPadding,
+                         font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
+
+    Texture2D texture = font.texture;
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if (font.cache != NULL)
+    {
+        // Dynamic font: glyph could be on any atlas page, make sure it has been uploaded
+        UpdateGlyphCache(font.cache);
+        if (font.cache->slotPages[index] < 0) return;     // Glyph not available (fallback glyph could not be packed)
+        texture = font.cache->pages[font.cache->slotPages[index]].texture;
+    }
+#endif
+
+    // Draw the character texture on the screen
+    DrawTexturePro(texture, srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
+}
+
 #if defined(SUPPORT_FILEFORMAT_FNT) || defined(SUPPORT_FILEFORMAT_BDF)
 // Read a line from memory
 // REQUIRES: memcpy()
@@ -2570,4 +3319,1170 @@ static GlyphInfo *LoadFontDataBDF(const unsigned char *fileData, int dataSize, i
 }
 #endif      // SUPPORT_FILEFORMAT_BDF
 
+// Init skyline packer for an empty area
+static void InitSkylinePacker(SkylinePacker *packer, int width, int height)
+{
+    packer->width = width;
+    packer->height = height;
+
+    // NOTE: Nodes cover the area width without overlapping, one extra node is required on insertion
+    packer->nodes = (SkylineNode *)RL_MALLOC((width + 1)*sizeof(SkylineNode));
+
+    ResetSkylinePacker(packer);
+}
+
+// Reset skyline packer to empty area
+static void ResetSkylinePacker(SkylinePacker *packer)
+{
+    packer->nodeCount = 1;
+    packer->nodes[0] = (SkylineNode){ 0, 0, packer->width };
+}
+
+// Pack rectangle using skyline bottom-left heuristic, returns false if it does not fit
+// NOTE: Rectangle is placed on the lowest position available, ties resolved by narrower segment
+static bool PackSkylineRect(SkylinePacker *packer, int width, int height, int *x, int *y)
+{
+    int bestIndex = -1;
+    int bestY = 0;
+    int bestWidth = 0;
+
+    for (int i = 0; i < packer->nodeCount; i++)
+    {
+        if ((packer->nodes[i].x + width) > packer->width) break;     // Nodes are sorted by x
+
+        // Rectangle rests on the highest segment it spans
+        int top = 0;
+        for (int j = i, remaining = width; remaining > 0; j++)
+        {
+            if (packer->nodes[j].y > top) top = packer->nodes[j].y;
+            remaining -= packer->nodes[j].width;
+        }
+
+        if ((top + height) > packer->height) continue;
+
+        if ((bestIndex == -1) || (top < bestY) || ((top == bestY) && (packer->nodes[i].width < bestWidth)))
+        {
+            bestIndex = i;
+            bestY = top;
+            bestWidth = packer->nodes[i].width;
+        }
+    }
+
+    if (bestIndex == -1) return false;
+
+    *x = packer->nodes[bestIndex].x;
+    *y = bestY;
+
+    // Insert new skyline segment on top of the rectangle
+    for (int i = packer->nodeCount; i > bestIndex; i--) packer->nodes[i] = packer->nodes[i - 1];
+    packer->nodes[bestIndex] = (SkylineNode){ *x, bestY + height, width };
+    packer->nodeCount++;
+
+    // Shrink or remove the segments covered by the new one
+    for (int i = bestIndex + 1; i < packer->nodeCount;)
+    {
+        int end = packer->nodes[i - 1].x + packer->nodes[i - 1].width;
+        if (packer->nodes[i].x >= end) break;
+
+        int shrink = end - packer->nodes[i].x;
+        packer->nodes[i].x += shrink;
+        packer->nodes[i].width -= shrink;
+
+        if (packer->nodes[i].width > 0) break;
+
+        for (int j = i; j < (packer->nodeCount - 1); j++) packer->nodes[j] = packer->nodes[j + 1];
+        packer->nodeCount--;
+    }
+
+    // Merge contiguous segments at the same height
+    for (int i = 0; i < (packer->nodeCount - 1);)
+    {
+        if (packer->nodes[i].y == packer->nodes[i + 1].y)
+        {
+            packer->nodes[i].width += packer->nodes[i + 1].width;
+            for (int j = i + 1; j < (packer->nodeCount - 1); j++) packer->nodes[j] = packer->nodes[j + 1];
+            packer->nodeCount--;
+        }
+        else i++;
+    }
+
+    return true;
+}
+
+// Unload skyline packer nodes
+static void UnloadSkylinePacker(SkylinePacker *packer)
+{
+    RL_FREE(packer->nodes);
+    packer->nodes = NULL;
+    packer->nodeCount = 0;
+}
+
+// Compare rectangles to pack, required for sorting
+// NOTE: Rectangles are sorted by height and width (descending), keeping provided order on ties
+static int ComparePackingRects(const void *a, const void *b)
+{
+    const PackingRect *rectA = (const PackingRect *)a;
+    const PackingRect *rectB = (const PackingRect *)b;
+
+    if (rectA->height != rectB->height) return rectB->height - rectA->height;
+    if (rectA->width != rectB->width) return rectB->width - rectA->width;
+
+    return rectA->index - rectB->index;
+}
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+#if defined(SUPPORT_FONT_KERNING)
+// Load kerning pairs for loaded glyphs, scaled to font size
+// NOTE: Kerning pairs are read from 'kern' table if available, otherwise all glyphs pairs are
+// checked for GPOS kerning (only up to FONT_KERNING_MAX_GLYPHS glyphs)
+static KerningPair *LoadFontKerning(const unsigned char *fileData, int fontSize, const GlyphInfo *glyphs, int glyphCount, int *kerningCount)
+{
+    KerningPair *pairs = NULL;
+    int count = 0;
+
+    stbtt_fontinfo fontInfo = { 0 };
+
+    if (stbtt_InitFont(&fontInfo, (unsigned char *)fileData, 0))
+    {
+        float scaleFactor = stbtt_ScaleForPixelHeight(&fontInfo, (float)fontSize);
+        int tableLength = stbtt_GetKerningTableLength(&fontInfo);
+
+        if (tableLength > 0)
+        {
+            // Map font glyphs indices to loaded glyphs
+            int *glyphMap = (int *)RL_MALLOC(fontInfo.numGlyphs*sizeof(int));
+            for (int i = 0; i < fontInfo.numGlyphs; i++) glyphMap[i] = -1;
+
+            for (int i = 0; i < glyphCount; i++)
+            {
+                int index = stbtt_FindGlyphIndex(&fontInfo, glyphs[i].value);
+                if (index > 0) glyphMap[index] = i;
+            }
+
+            stbtt_kerningentry *table = (stbtt_kerningentry *)RL_MALLOC(tableLength*sizeof(stbtt_kerningentry));
+            tableLength = stbtt_GetKerningTable(&fontInfo, table, tableLength);
+            pairs = (KerningPair *)RL_MALLOC(tableLength*sizeof(KerningPair));
+
+            for (int i = 0; i < tableLength; i++)
+            {
+                if ((table[i].glyph1 < fontInfo.numGlyphs) && (table[i].glyph2 < fontInfo.numGlyphs) &&
+                    (glyphMap[table[i].glyph1] >= 0) && (glyphMap[table[i].glyph2] >= 0) && (table[i].advance != 0))
+                {
+                    pairs[count].first = glyphs[glyphMap[table[i].glyph1]].value;
+                    pairs[count].second = glyphs[glyphMap[table[i].glyph2]].value;
+                    pairs[count].advance = (float)table[i].advance*scaleFactor;
+                    count++;
+                }
+            }
+
+            RL_FREE(table);
+            RL_FREE(glyphMap);
+        }
+        else if (glyphCount <= FONT_KERNING_MAX_GLYPHS)
+        {
+            int *indices = (int *)RL_MALLOC(glyphCount*sizeof(int));
+            for (int i = 0; i < glyphCount; i++) indices[i] = stbtt_FindGlyphIndex(&fontInfo, glyphs[i].value);
+
+            pairs = (KerningPair *)RL_MALLOC(glyphCount*glyphCount*sizeof(KerningPair));
+
+            for (int i = 0; i < glyphCount; i++)
+            {
+                if (indices[i] == 0) continue;
+
+                for (int j = 0; j < glyphCount; j++)
+                {
+                    int advance = (indices[j] > 0)? stbtt_GetGlyphKernAdvance(&fontInfo, indices[i], indices[j]) : 0;
+
+                    if (advance != 0) pairs[count++] = (KerningPair){ glyphs[i].value, glyphs[j].value, (float)advance*scaleFactor };
+                }
+            }
+
+            RL_FREE(indices);
+        }
+        else TRACELOG(LOG_INFO, "FONT: Kerning pairs not loaded, too many glyphs to check for GPOS kerning (max: %i)", FONT_KERNING_MAX_GLYPHS);
+    }
+
+    if (count > 0)
+    {
+        pairs = (KerningPair *)RL_REALLOC(pairs, count*sizeof(KerningPair));
+        qsort(pairs, count, sizeof(KerningPair), CompareKerningPairs);
+    }
+    else
+    {
+        RL_FREE(pairs);
+        pairs = NULL;
+    }
+
+    *kerningCount = count;
+
+    return pairs;
+}
+
+// Compare kerning pairs, by first and second characters
+static int CompareKerningPairs(const void *a, const void *b)
+{
+    const KerningPair *pairA = (const KerningPair *)a;
+    const KerningPair *pairB = (const KerningPair *)b;
+
+    if (pairA->first != pairB->first) return (pairA->first < pairB->first)? -1 : 1;
+    if (pairA->second != pairB->second) return (pairA->second < pairB->second)? -1 : 1;
+
+    return 0;
+}
+#endif      // SUPPORT_FONT_KERNING
+
+#if defined(SUPPORT_FONT_SDF_EDT)
+// Load glyph SDF from glyph anti-aliased bitmap, using euclidean distance transform
+// NOTE: Output matches stbtt_GetGlyphSDF() layout and values, edges position is estimated from pixels
+// coverage, generation cost only depends on glyph size (not on glyph outline complexity)
+static unsigned char *LoadGlyphSDF(const stbtt_fontinfo *fontInfo, float scale, int glyph, int padding, unsigned char onEdge, float distScale, int *width, int *height, int *offsetX, int *offsetY)
+{
+    const int ss = FONT_SDF_SUPERSAMPLING;
+    unsigned char *sdf = NULL;
+
+    int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+    stbtt_GetGlyphBitmapBox(fontInfo, glyph, scale, scale, &x0, &y0, &x1, &y1);
+    if ((x0 == x1) || (y0 == y1)) return sdf;
+
+    *width = x1 - x0 + 2*padding;
+    *height = y1 - y0 + 2*padding;
+    *offsetX = x0 - padding;
+    *offsetY = y0 - padding;
+
+    // Rasterize glyph at supersampled scale, aligned to SDF pixels grid
+    int hiWidth = (*width)*ss;
+    int hiHeight = (*height)*ss;
+    int hiCount = hiWidth*hiHeight;
+    unsigned char *bitmap = (unsigned char *)RL_CALLOC(hiCount, 1);
+
+    int hx0 = 0, hy0 = 0, hx1 = 0, hy1 = 0;
+    stbtt_GetGlyphBitmapBox(fontInfo, glyph, scale*ss, scale*ss, &hx0, &hy0, &hx1, &hy1);
+
+    int ox = hx0 - (*offsetX)*ss;
+    int oy = hy0 - (*offsetY)*ss;
+    int rasterWidth = ((hx1 - hx0) < (hiWidth - ox))? (hx1 - hx0) : (hiWidth - ox);
+    int rasterHeight = ((hy1 - hy0) < (hiHeight - oy))? (hy1 - hy0) : (hiHeight - oy);
+
+    stbtt_MakeGlyphBitmap(fontInfo, bitmap + oy*hiWidth + ox, rasterWidth, rasterHeight, hiWidth, scale*ss, scale*ss, glyph);
+
+    // Squared distances from empty pixels to nearest covered pixel and from fully covered pixels to nearest
+    // not fully covered pixel, nearest pixel coverage is used to estimate edge position inside it
+    float *distInside = (float *)RL_MALLOC(hiCount*sizeof(float));
+    float *distOutside = (float *)RL_MALLOC(hiCount*sizeof(float));
+    int *nearestInside = (int *)RL_MALLOC(hiCount*sizeof(int));
+    int *nearestOutside = (int *)RL_MALLOC(hiCount*sizeof(int));
+
+    for (int i = 0; i < hiCount; i++)
+    {
+        distInside[i] = (bitmap[i] > 0)? 0.0f : 1e20f;
+        distOutside[i] = (bitmap[i] < 255)? 0.0f : 1e20f;
+    }
+
+    DistanceTransform(distInside, nearestInside, hiWidth, hiHeight);
+    DistanceTransform(distOutside, nearestOutside, hiWidth, hiHeight);
+
+    // Signed distance at SDF pixels (positive inside), averaged from supersampled pixels block
+    sdf = (unsigned char *)RL_MALLOC((*width)*(*height));
+    float blockScale = distScale/(float)(ss*ss*ss);
+
+    for (int y = 0; y < *height; y++)
+    {
+        for (int x = 0; x < *width; x++)
+        {
+            float dist = 0.0f;
+
+            for (int j = 0; j < ss; j++)
+            {
+                int k = (y*ss + j)*hiWidth + x*ss;
+
+                for (int i = 0; i < ss; i++, k++)
+                {
+                    if (bitmap[k] == 0) dist -= sqrtf(distInside[k]) + 0.5f - (float)bitmap[nearestInside[k]]/255.0f;
+                    else if (bitmap[k] == 255) dist += sqrtf(distOutside[k]) - 0.5f + (float)bitmap[nearestOutside[k]]/255.0f;
+                    else dist += (float)bitmap[k]/255.0f - 0.5f;
+                }
+            }
+
+            float value = (float)onEdge + dist*blockScale;
+            sdf[y*(*width) + x] = (value < 0.0f)? 0 : ((value > 255.0f)? 255 : (unsigned char)value);
+        }
+    }
+
+    RL_FREE(bitmap);
+    RL_FREE(distInside);
+    RL_FREE(distOutside);
+    RL_FREE(nearestInside);
+    RL_FREE(nearestOutside);
+
+    return sdf;
+}
+
+// Squared euclidean distance transform (in-place), separable columns and rows passes
+// NOTE: Grid values must be 0 for feature pixels and a big value otherwise,
+// nearest feature pixel index is returned for every pixel
+// REF: Felzenszwalb, Huttenlocher - Distance Transforms of Sampled Functions
+static void DistanceTransform(float *grid, int *nearest, int width, int height)
+{
+    int maxSize = (width > height)? width : height;
+
+    float *f = (float *)RL_MALLOC(maxSize*sizeof(float));
+    float *z = (float *)RL_MALLOC((maxSize + 1)*sizeof(float));
+    int *n = (int *)RL_MALLOC(maxSize*sizeof(int));
+    int *v = (int *)RL_MALLOC(maxSize*sizeof(int));
+
+    for (int i = 0; i < width*height; i++) nearest[i] = i;
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        int lineCount = (pass == 0)? width : height;
+        int length = (pass == 0)? height : width;
+        int stride = (pass == 0)? width : 1;
+
+        for (int line = 0; line < lineCount; line++)
+        {
+            int base = (pass == 0)? line : line*width;
+
+            for (int q = 0; q < length; q++)
+            {
+                f[q] = grid[base + q*stride];
+                n[q] = nearest[base + q*stride];
+            }
+
+            // Lower envelope of parabolas rooted at every sample
+            int k = 0;
+            v[0] = 0;
+            z[0] = -1e20f;
+            z[1] = 1e20f;
+
+            for (int q = 1; q < length; q++)
+            {
+                float s = ((f[q] + (float)(q*q)) - (f[v[k]] + (float)(v[k]*v[k])))/(float)(2*q - 2*v[k]);
+
+                while ((k > 0) && (s <= z[k]))
+                {
+                    k--;
+                    s = ((f[q] + (float)(q*q)) - (f[v[k]] + (float)(v[k]*v[k])))/(float)(2*q - 2*v[k]);
+                }
+
+                k++;
+                v[k] = q;
+                z[k] = s;
+                z[k + 1] = 1e20f;
+            }
+
+            k = 0;
+            for (int q = 0; q < length; q++)
+            {
+                while (z[k + 1] < (float)q) k++;
+
+                grid[base + q*stride] = (float)((q - v[k])*(q - v[k])) + f[v[k]];
+                nearest[base + q*stride] = n[v[k]];
+            }
+        }
+    }
+
+    RL_FREE(f);
+    RL_FREE(z);
+    RL_FREE(n);
+    RL_FREE(v);
+}
+#endif
+
+// Load glyph multi-channel SDF (MSDF) from glyph outline
+// NOTE: RGB channels store signed pseudo-distances to differently colored edges, their median
+// keeps sharp corners when upscaled; alpha channel stores true signed distance (same as FONT_SDF)
+// REF: Chlumsky - Shape Decomposition for Multi-channel Distance Fields
+static unsigned char *LoadGlyphMSDF(const stbtt_fontinfo *fontInfo, float scale, int glyph, int padding, unsigned char onEdge, float distScale, int *width, int *height, int *offsetX, int *offsetY)
+{
+    unsigned char *msdf = NULL;
+
+    int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+    stbtt_GetGlyphBitmapBox(fontInfo, glyph, scale, scale, &x0, &y0, &x1, &y1);
+    if ((x0 == x1) || (y0 == y1)) return msdf;
+
+    stbtt_vertex *vertices = NULL;
+    int vertexCount = stbtt_GetGlyphShape(fontInfo, glyph, &vertices);
+    if (vertexCount == 0) return msdf;
+
+    *width = x1 - x0 + 2*padding;
+    *height = y1 - y0 + 2*padding;
+    *offsetX = x0 - padding;
+    *offsetY = y0 - padding;
+
+    // Convert glyph outline into edges in MSDF pixels space (y-down)
+    // NOTE: Cubic curves (CFF fonts) are approximated by multiple quadratic curves
+    MsdfEdge *edges = (MsdfEdge *)RL_MALLOC(vertexCount*FONT_MSDF_CUBIC_SPLITS*sizeof(MsdfEdge));
+    int *contours = (int *)RL_MALLOC((vertexCount + 1)*sizeof(int));   // Contours first edge index
+    int edgeCount = 0;
+    int contourCount = 0;
+    Vector2 last = { 0 };
+
+    for (int i = 0; i < vertexCount; i++)
+    {
+        Vector2 point = { vertices[i].x*scale - *offsetX, -vertices[i].y*scale - *offsetY };
+        Vector2 control = { vertices[i].cx*scale - *offsetX, -vertices[i].cy*scale - *offsetY };
+
+        switch (vertices[i].type)
+        {
+            case STBTT_vmove: contours[contourCount++] = edgeCount; break;
+            case STBTT_vline:
+            {
+                if ((point.x != last.x) || (point.y != last.y)) edges[edgeCount++] = (MsdfEdge){ last, point, point, false, 7, { 0, 0, 0, 0 } };
+            } break;
+            case STBTT_vcurve:
+            {
+                if ((point.x != last.x) || (point.y != last.y) || (control.x != last.x) || (control.y != last.y)) edges[edgeCount++] = (MsdfEdge){ last, control, point, true, 7, { 0, 0, 0, 0 } };
+            } break;
+            case STBTT_vcubic:
+            {
+                Vector2 control1 = { vertices[i].cx1*scale - *offsetX, -vertices[i].cy1*scale - *offsetY };
+
+                for (int k = 0; k < FONT_MSDF_CUBIC_SPLITS; k++)
+                {
+                    // Sub-curve end points and tangents (scaled to sub-curve), approximated by quadratic curve
+                    float t[2] = { (float)k/FONT_MSDF_CUBIC_SPLITS, (float)(k + 1)/FONT_MSDF_CUBIC_SPLITS };
+                    Vector2 q[2] = { 0 };
+                    Vector2 dq[2] = { 0 };
+
+                    for (int j = 0; j < 2; j++)
+                    {
+                        float u = 1.0f - t[j];
+                        q[j].x = u*u*u*last.x + 3*u*u*t[j]*control.x + 3*u*t[j]*t[j]*control1.x + t[j]*t[j]*t[j]*point.x;
+                        q[j].y = u*u*u*last.y + 3*u*u*t[j]*control.y + 3*u*t[j]*t[j]*control1.y + t[j]*t[j]*t[j]*point.y;
+                        dq[j].x = (3*u*u*(control.x - last.x) + 6*u*t[j]*(control1.x - control.x) + 3*t[j]*t[j]*(point.x - control1.x))/FONT_MSDF_CUBIC_SPLITS;
+                        dq[j].y = (3*u*u*(control.y - last.y) + 6*u*t[j]*(control1.y - control.y) + 3*t[j]*t[j]*(point.y - control1.y))/FONT_MSDF_CUBIC_SPLITS;
+                    }
+
+                    // Quadratic control point from sub-curve cubic control points (c0 = q0 + dq0/3, c1 = q1 - dq1/3): (3*(c0 + c1) - q0 - q1)/4
+                    Vector2 mid = {
+                        (3.0f*((q[0].x + dq[0].x/3.0f) + (q[1].x - dq[1].x/3.0f)) - q[0].x - q[1].x)/4.0f,
+                        (3.0f*((q[0].y + dq[0].y/3.0f) + (q[1].y - dq[1].y/3.0f)) - q[0].y - q[1].y)/4.0f
+                    };
+
+                    if ((q[0].x != q[1].x) || (q[0].y != q[1].y)) edges[edgeCount++] = (MsdfEdge){ q[0], mid, q[1], true, 7, { 0, 0, 0, 0 } };
+                }
+            } break;
+            default: break;
+        }
+
+        last = point;
+    }
+
+    contours[contourCount] = edgeCount;
+    stbtt_FreeShape(fontInfo, vertices);
+
+    for (int e = 0; e < edgeCount; e++)
+    {
+        float minX = fminf(fminf(edges[e].p0.x, edges[e].p1.x), edges[e].p2.x);
+        float minY = fminf(fminf(edges[e].p0.y, edges[e].p1.y), edges[e].p2.y);
+        edges[e].bounds = (Rectangle){ minX, minY, fmaxf(fmaxf(edges[e].p0.x, edges[e].p1.x), edges[e].p2.x) - minX, fmaxf(fmaxf(edges[e].p0.y, edges[e].p1.y), edges[e].p2.y) - minY };
+    }
+
+    // Assign edges colors, every contour independently
+    int *corners = (int *)RL_MALLOC((edgeCount + 1)*sizeof(int));
+    for (int c = 0; c < contourCount; c++) ColorMsdfContour(edges + contours[c], contours[c + 1] - contours[c], corners);
+    RL_FREE(corners);
+
+    msdf = (unsigned char *)RL_MALLOC((*width)*(*height)*4);
+    float *crossings = (float *)RL_MALLOC(2*edgeCount*sizeof(float));   // Row crossings position
+    int *windings = (int *)RL_MALLOC(2*edgeCount*sizeof(int));          // Row crossings direction
+    int previous[4] = { -1, -1, -1, -1 };      // Previous pixel nearest edges
+
+    // Candidate edges for pixels cells on current cells row
+    int cellCountX = (*width + FONT_MSDF_CELL_SIZE - 1)/FONT_MSDF_CELL_SIZE;
+    int *cellEdges = (int *)RL_MALLOC(cellCountX*edgeCount*sizeof(int));
+    int *cellEdgeCounts = (int *)RL_MALLOC(cellCountX*sizeof(int));
+
+    for (int y = 0; y < *height; y++)
+    {
+        if ((y%FONT_MSDF_CELL_SIZE) == 0)
+        {
+            for (int cx = 0; cx < cellCountX; cx++)
+            {
+                Rectangle cell = { (float)(cx*FONT_MSDF_CELL_SIZE), (float)y, (float)FONT_MSDF_CELL_SIZE, (float)FONT_MSDF_CELL_SIZE };
+                cellEdgeCounts[cx] = GetMsdfCellEdges(edges, edgeCount, cell, cellEdges + cx*edgeCount);
+            }
+        }
+
+        // Outline crossings along row center, required for non-zero fill rule
+        // NOTE: Distances sign depends on contours orientation, fill rule gives real inside/outside
+        int crossingCount = 0;
+        float centerY = y + 0.5f;
+
+        for (int e = 0; e < edgeCount; e++)
+        {
+            const MsdfEdge *edge = &edges[e];
+
+            // Curve is split in y-monotonic parts at its extremum, every part crosses the row at most once
+            // NOTE: Crossings use half-open rule on y, rows passing through vertices are counted once
+            float extremum = edge->p0.y - 2.0f*edge->p1.y + edge->p2.y;
+            extremum = (edge->curve && (extremum != 0.0f))? (edge->p0.y - edge->p1.y)/extremum : 1.0f;
+            float parts[3] = { 0.0f, ((extremum > 0.0f) && (extremum < 1.0f))? extremum : 1.0f, 1.0f };
+
+            for (int k = 0; k < 2; k++)
+            {
+                if (parts[k] == parts[k + 1]) continue;
+
+                float ya = GetMsdfEdgePoint(edge, parts[k]).y;
+                float yb = GetMsdfEdgePoint(edge, parts[k + 1]).y;
+
+                if ((ya > centerY) != (yb > centerY))
+                {
+                    float t = (centerY - edge->p0.y)/(edge->p2.y - edge->p0.y);
+
+                    if (edge->curve)
+                    {
+                        double roots[3] = { 0 };
+                        int rootCount = SolveCubic(0.0, edge->p0.y - 2.0*edge->p1.y + edge->p2.y, 2.0*(edge->p1.y - edge->p0.y), edge->p0.y - centerY, roots);
+                        t = 0.5f*(parts[k] + parts[k + 1]);
+
+                        for (int i = 0; i < rootCount; i++)
+                        {
+                            if ((roots[i] >= parts[k] - 1e-4) && (roots[i] <= parts[k + 1] + 1e-4)) t = (float)roots[i];
+                        }
+                    }
+
+                    crossings[crossingCount] = GetMsdfEdgePoint(edge, t).x;
+                    windings[crossingCount] = (yb > ya)? 1 : -1;
+                    crossingCount++;
+                }
+            }
+        }
+
+        for (int x = 0; x < *width; x++)
+        {
+            Vector2 point = { x + 0.5f, centerY };
+
+            // Nearest edge for every channel (considering edges of that color) and for true distance
+            float minDistance[4] = { 1e20f, 1e20f, 1e20f, 1e20f };
+            float minOrthogonality[4] = { 0 };
+            float minParam[4] = { 0 };
+            int nearest[4] = { -1, -1, -1, -1 };
+            float limits[8] = { 1e30f, 1e30f, 1e30f, 1e30f, 1e30f, 1e30f, 1e30f, 1e30f }; // Squared distance limit by edge color
+
+            // NOTE: Previous pixel nearest edges are checked first, most edges are skipped after that
+            int *candidates = cellEdges + (x/FONT_MSDF_CELL_SIZE)*edgeCount;
+
+            for (int n = -4; n < cellEdgeCounts[x/FONT_MSDF_CELL_SIZE]; n++)
+            {
+                int e = (n < 0)? previous[n + 4] : candidates[n];
+                if (e < 0) continue;
+
+                // Skip edges farther than current nearest edges for edge channels (bounding box distance)
+                float dx = fmaxf(fmaxf(edges[e].bounds.x - point.x, point.x - edges[e].bounds.x - edges[e].bounds.width), 0.0f);
+                float dy = fmaxf(fmaxf(edges[e].bounds.y - point.y, point.y - edges[e].bounds.y - edges[e].bounds.height), 0.0f);
+                if ((dx*dx + dy*dy) > limits[edges[e].color]) continue;
+
+                float distance = 0.0f, orthogonality = 0.0f, param = 0.0f;
+                GetMsdfEdgeDistance(&edges[e], point, &distance, &orthogonality, &param);
+
+                // NOTE: On equal distances (edges joints), edge most perpendicular to point direction is nearest
+                bool updated = false;
+
+                for (int c = 0; c < 4; c++)
+                {
+                    if (((c == 3) || (edges[e].color & (1 << c))) &&
+                        ((fabsf(distance) < fabsf(minDistance[c])) || ((fabsf(distance) == fabsf(minDistance[c])) && (orthogonality < minOrthogonality[c]))))
+                    {
+                        minDistance[c] = distance;
+                        minOrthogonality[c] = orthogonality;
+                        minParam[c] = param;
+                        nearest[c] = e;
+                        updated = true;
+                    }
+                }
+
+                for (int m = 0; (m < 8) && updated; m++)
+                {
+                    float limit = fabsf(minDistance[3]);
+                    for (int c = 0; c < 3; c++) if ((m & (1 << c)) && (fabsf(minDistance[c]) > limit)) limit = fabsf(minDistance[c]);
+                    limits[m] = limit*limit;
+                }
+            }
+
+            for (int c = 0; c < 4; c++) previous[c] = nearest[c];
+
+            float channels[4] = { 0 };
+            for (int c = 0; c < 3; c++) channels[c] = (nearest[c] >= 0)? GetMsdfPseudoDistance(&edges[nearest[c]], point, minDistance[c], minParam[c]) : minDistance[3];
+            channels[3] = minDistance[3];
+
+            // Inside points (non-zero winding) must have negative distances (y-flipped outline),
+            // distances are negated on wrong side (reversed or overlapping contours)
+            int winding = 0;
+            for (int i = 0; i < crossingCount; i++) if (crossings[i] > point.x) winding += windings[i];
+
+            if ((winding != 0) != (channels[3] < 0.0f)) for (int c = 0; c < 4; c++) channels[c] = -channels[c];
+
+            // Channels median must be on the same side of the outline than the point,
+            // on wrong side (channels clash), true distance is used for all channels
+            float median = fmaxf(fminf(channels[0], channels[1]), fminf(fmaxf(channels[0], channels[1]), channels[2]));
+            if ((median < 0.0f) != (channels[3] < 0.0f)) channels[0] = channels[1] = channels[2] = channels[3];
+
+            // NOTE: Outline is y-flipped, distances inside glyph (on the right of edges) are negative
+            for (int c = 0; c < 4; c++)
+            {
+                float value = (float)onEdge - channels[c]*distScale;
+                msdf[(y*(*width) + x)*4 + c] = (value < 0.0f)? 0 : ((value > 255.0f)? 255 : (unsigned char)value);
+            }
+        }
+    }
+
+    RL_FREE(edges);
+    RL_FREE(contours);
+    RL_FREE(crossings);
+    RL_FREE(windings);
+    RL_FREE(cellEdges);
+    RL_FREE(cellEdgeCounts);
+
+    return msdf;
+}
+
+// Assign edges colors to contour, switching colors on corners
+// NOTE: Edges meeting at a corner must share only one channel, smooth contours are white (all channels)
+static void ColorMsdfContour(MsdfEdge *edges, int edgeCount, int *corners)
+{
+    const int colors[3] = { 6, 5, 3 };    // Cyan, magenta, yellow
+    int cornerCount = 0;
+
+    for (int i = 0; i < edgeCount; i++)
+    {
+        // Direction at previous edge end and current edge start
+        const MsdfEdge *prev = &edges[(i + edgeCount - 1)%edgeCount];
+        Vector2 a = { prev->p2.x - prev->p1.x, prev->p2.y - prev->p1.y };
+        Vector2 b = { edges[i].p1.x - edges[i].p0.x, edges[i].p1.y - edges[i].p0.y };
+        if (!prev->curve || ((a.x == 0.0f) && (a.y == 0.0f))) a = (Vector2){ prev->p2.x - prev->p0.x, prev->p2.y - prev->p0.y };
+        if (!edges[i].curve || ((b.x == 0.0f) && (b.y == 0.0f))) b = (Vector2){ edges[i].p2.x - edges[i].p0.x, edges[i].p2.y - edges[i].p0.y };
+
+        float lengths = sqrtf(a.x*a.x + a.y*a.y)*sqrtf(b.x*b.x + b.y*b.y);
+        float dot = (a.x*b.x + a.y*b.y)/lengths;
+        float cross = (a.x*b.y - a.y*b.x)/lengths;
+
+        // Corner when direction changes more than ~8 degrees (sin(3 rad))
+        if ((dot <= 0.0f) || (fabsf(cross) > 0.1411f)) corners[cornerCount++] = i;
+    }
+
+    if (cornerCount == 0) for (int i = 0; i < edgeCount; i++) edges[i].color = 7;
+    else if (cornerCount == 1)
+    {
+        // Teardrop shape, edges are split in three parts around corner
+        const int teardrop[3] = { 5, 7, 3 };
+
+        for (int i = 0; i < edgeCount; i++)
+        {
+            int part = (edgeCount >= 3)? (int)(3.0f + 2.875f*i/(edgeCount - 1) - 1.4375f + 0.5f) - 3 : 0;
+            edges[(corners[0] + i)%edgeCount].color = teardrop[1 + part];
+        }
+    }
+    else
+    {
+        // Color switches on every corner, last spline color must be different from first one
+        int spline = 0;
+        int color = 0;
+
+        for (int i = 0; i < edgeCount; i++)
+        {
+            int index = (corners[0] + i)%edgeCount;
+
+            if ((spline + 1 < cornerCount) && (corners[spline + 1] == index))
+            {
+                spline++;
+                color = (color + 1)%3;
+                if ((spline == cornerCount - 1) && (color == 0)) color = 1;
+            }
+
+            edges[index].color = colors[color];
+        }
+    }
+}
+
+// Get edges that could be nearest to cell pixels for any channel, returns edges count
+// NOTE: For every channel, nearest edge is not farther than any point of any edge of that channel,
+// so edges bounding boxes farther than that (for the farthest cell corner) can be skipped
+static int GetMsdfCellEdges(const MsdfEdge *edges, int edgeCount, Rectangle cell, int *cellEdges)
+{
+    float bounds[4] = { 1e30f, 1e30f, 1e30f, 1e30f };   // Channels nearest edge maximum squared distance
+
+    for (int e = 0; e < edgeCount; e++)
+    {
+        float dx = fmaxf(fabsf(edges[e].p0.x - cell.x), fabsf(edges[e].p0.x - cell.x - cell.width));
+        float dy = fmaxf(fabsf(edges[e].p0.y - cell.y), fabsf(edges[e].p0.y - cell.y - cell.height));
+        float distance = dx*dx + dy*dy;
+
+        for (int c = 0; c < 4; c++)
+        {
+            if (((c == 3) || (edges[e].color & (1 << c))) && (distance < bounds[c])) bounds[c] = distance;
+        }
+    }
+
+    float bound = bounds[3];
+    for (int c = 0; c < 3; c++) if ((bounds[c] < 1e30f) && (bounds[c] > bound)) bound = bounds[c];
+
+    int count = 0;
+
+    for (int e = 0; e < edgeCount; e++)
+    {
+        float dx = fmaxf(fmaxf(edges[e].bounds.x - cell.x - cell.width, cell.x - edges[e].bounds.x - edges[e].bounds.width), 0.0f);
+        float dy = fmaxf(fmaxf(edges[e].bounds.y - cell.y - cell.height, cell.y - edges[e].bounds.y - edges[e].bounds.height), 0.0f);
+
+        if ((dx*dx + dy*dy) <= bound) cellEdges[count++] = e;
+    }
+
+    return count;
+}
+
+// Get edge point at curve parameter
+static Vector2 GetMsdfEdgePoint(const MsdfEdge *edge, float t)
+{
+    Vector2 point = { edge->p0.x + t*(edge->p2.x - edge->p0.x), edge->p0.y + t*(edge->p2.y - edge->p0.y) };
+
+    if (edge->curve)
+    {
+        point.x = (1.0f - t)*(1.0f - t)*edge->p0.x + 2.0f*(1.0f - t)*t*edge->p1.x + t*t*edge->p2.x;
+        point.y = (1.0f - t)*(1.0f - t)*edge->p0.y + 2.0f*(1.0f - t)*t*edge->p1.y + t*t*edge->p2.y;
+    }
+
+    return point;
+}
+
+// Get signed distance from point to edge
+// NOTE: Orthogonality is used to decide nearest edge on same distance (0 when nearest point is inside edge),
+// param is edge curve parameter of nearest point, out of [0..1] when nearest point is an edge end
+static void GetMsdfEdgeDistance(const MsdfEdge *edge, Vector2 point, float *distance, float *orthogonality, float *param)
+{
+    if (!edge->curve)
+    {
+        Vector2 aq = { point.x - edge->p0.x, point.y - edge->p0.y };
+        Vector2 ab = { edge->p2.x - edge->p0.x, edge->p2.y - edge->p0.y };
+        float abLength = sqrtf(ab.x*ab.x + ab.y*ab.y);
+        float t = (aq.x*ab.x + aq.y*ab.y)/(abLength*abLength);
+
+        Vector2 eq = (t > 0.5f)? (Vector2){ edge->p2.x - point.x, edge->p2.y - point.y } : (Vector2){ edge->p0.x - point.x, edge->p0.y - point.y };
+        float endDistance = sqrtf(eq.x*eq.x + eq.y*eq.y);
+        float cross = aq.x*ab.y - aq.y*ab.x;
+
+        *param = t;
+
+        if ((t > 0.0f) && (t < 1.0f) && (fabsf(cross/abLength) < endDistance))
+        {
+            *distance = cross/abLength;
+            *orthogonality = 0.0f;
+        }
+        else
+        {
+            *distance = (cross > 0.0f)? endDistance : -endDistance;
+            *orthogonality = (endDistance > 0.0f)? fabsf((ab.x*eq.x + ab.y*eq.y)/(abLength*endDistance)) : 0.0f;
+        }
+    }
+    else
+    {
+        Vector2 qa = { edge->p0.x - point.x, edge->p0.y - point.y };
+        Vector2 ab = { edge->p1.x - edge->p0.x, edge->p1.y - edge->p0.y };
+        Vector2 br = { edge->p2.x - edge->p1.x - ab.x, edge->p2.y - edge->p1.y - ab.y };
+        Vector2 startDir = ab;
+        Vector2 endDir = { edge->p2.x - edge->p1.x, edge->p2.y - edge->p1.y };
+        Vector2 eq = { edge->p2.x - point.x, edge->p2.y - point.y };
+        if ((startDir.x == 0.0f) && (startDir.y == 0.0f)) startDir = (Vector2){ edge->p2.x - edge->p0.x, edge->p2.y - edge->p0.y };
+        if ((endDir.x == 0.0f) && (endDir.y == 0.0f)) endDir = (Vector2){ edge->p2.x - edge->p0.x, edge->p2.y - edge->p0.y };
+
+        // Nearest point candidates: curve ends and roots of curve derivative dot product with point direction
+        float minDistance = sqrtf(qa.x*qa.x + qa.y*qa.y);
+        if ((startDir.x*qa.y - startDir.y*qa.x) <= 0.0f) minDistance = -minDistance;
+        float t = -(qa.x*startDir.x + qa.y*startDir.y)/(startDir.x*startDir.x + startDir.y*startDir.y);
+
+        float endDistance = sqrtf(eq.x*eq.x + eq.y*eq.y);
+        if (endDistance < fabsf(minDistance))
+        {
+            minDistance = ((endDir.x*eq.y - endDir.y*eq.x) > 0.0f)? endDistance : -endDistance;
+            t = ((point.x - edge->p1.x)*endDir.x + (point.y - edge->p1.y)*endDir.y)/(endDir.x*endDir.x + endDir.y*endDir.y);
+        }
+
+        double roots[3] = { 0 };
+        int rootCount = SolveCubic(br.x*br.x + br.y*br.y, 3.0*(ab.x*br.x + ab.y*br.y),
+            2.0*(ab.x*ab.x + ab.y*ab.y) + (qa.x*br.x + qa.y*br.y), qa.x*ab.x + qa.y*ab.y, roots);
+
+        for (int i = 0; i < rootCount; i++)
+        {
+            if ((roots[i] > 0.0) && (roots[i] < 1.0))
+            {
+                float r = (float)roots[i];
+                Vector2 qe = { qa.x + 2.0f*r*ab.x + r*r*br.x, qa.y + 2.0f*r*ab.y + r*r*br.y };
+                Vector2 dir = { ab.x + r*br.x, ab.y + r*br.y };
+                float qeDistance = sqrtf(qe.x*qe.x + qe.y*qe.y);
+
+                if (qeDistance <= fabsf(minDistance))
+                {
+                    minDistance = ((dir.x*qe.y - dir.y*qe.x) > 0.0f)? qeDistance : -qeDistance;
+                    t = r;
+                }
+            }
+        }
+
+        *distance = minDistance;
+        *param = t;
+
+        if ((t >= 0.0f) && (t <= 1.0f)) *orthogonality = 0.0f;
+        else
+        {
+            Vector2 dir = (t < 0.5f)? startDir : endDir;
+            Vector2 end = (t < 0.5f)? qa : eq;
+            float lengths = sqrtf(dir.x*dir.x + dir.y*dir.y)*sqrtf(end.x*end.x + end.y*end.y);
+            *orthogonality = (lengths > 0.0f)? fabsf((dir.x*end.x + dir.y*end.y)/lengths) : 0.0f;
+        }
+    }
+}
+
+// Get signed pseudo-distance from point to edge
+// NOTE: Beyond edge ends, distance to edge ends tangent lines is used (if nearer)
+static float GetMsdfPseudoDistance(const MsdfEdge *edge, Vector2 point, float distance, float param)
+{
+    if ((param < 0.0f) || (param > 1.0f))
+    {
+        Vector2 end = (param < 0.0f)? edge->p0 : edge->p2;
+        Vector2 dir = { edge->p2.x - edge->p0.x, edge->p2.y - edge->p0.y };
+
+        if (edge->curve)
+        {
+            Vector2 tangent = (param < 0.0f)? (Vector2){ edge->p1.x - edge->p0.x, edge->p1.y - edge->p0.y } : (Vector2){ edge->p2.x - edge->p1.x, edge->p2.y - edge->p1.y };
+            if ((tangent.x != 0.0f) || (tangent.y != 0.0f)) dir = tangent;
+        }
+
+        float length = sqrtf(dir.x*dir.x + dir.y*dir.y);
+        Vector2 eq = { point.x - end.x, point.y - end.y };
+        float ts = (eq.x*dir.x + eq.y*dir.y)/length;
+
+        if ((param < 0.0f)? (ts < 0.0f) : (ts > 0.0f))
+        {
+            float pseudoDistance = (eq.x*dir.y - eq.y*dir.x)/length;
+            if (fabsf(pseudoDistance) <= fabsf(distance)) distance = pseudoDistance;
+        }
+    }
+
+    return distance;
+}
+
+// Solve cubic equation (a*x^3 + b*x^2 + c*x + d = 0), returns real roots count
+// NOTE: Degenerated cases (a or a and b near zero) are solved as quadratic or linear equations
+static int SolveCubic(double a, double b, double c, double d, double *roots)
+{
+    if ((a != 0.0) && (fabs(b/a) < 1e6))
+    {
+        // Normalized cubic, trigonometric or Cardano solution
+        double nb = b/a, nc = c/a, nd = d/a;
+        double q = (nb*nb - 3.0*nc)/9.0;
+        double r = (nb*(2.0*nb*nb - 9.0*nc) + 27.0*nd)/54.0;
+        double q3 = q*q*q;
+        nb /= 3.0;
+
+        if (r*r < q3)
+        {
+            double t = r/sqrt(q3);
+            if (t < -1.0) t = -1.0;
+            if (t > 1.0) t = 1.0;
+            t = acos(t)/3.0;
+            q = -2.0*sqrt(q);
+
+            // NOTE: cos(t ± 2*PI/3) = -0.5*cos(t) ∓ sqrt(3)/2*sin(t)
+            double ct = cos(t);
+            double st = sin(t)*0.8660254037844386;
+            roots[0] = q*ct - nb;
+            roots[1] = q*(-0.5*ct - st) - nb;
+            roots[2] = q*(-0.5*ct + st) - nb;
+            return 3;
+        }
+
+        double u = ((r < 0.0)? 1.0 : -1.0)*cbrt(fabs(r) + sqrt(r*r - q3));
+        double v = (u == 0.0)? 0.0 : q/u;
+        roots[0] = (u + v) - nb;
+
+        if ((u == v) || (fabs(u - v) < 1e-12*fabs(u + v)))
+        {
+            roots[1] = -0.5*(u + v) - nb;
+            return 2;
+        }
+
+        return 1;
+    }
+
+    if ((b == 0.0) || (fabs(c) > 1e12*fabs(b)))
+    {
+        if (c == 0.0) return 0;
+        roots[0] = -d/c;
+        return 1;
+    }
+
+    double discriminant = c*c - 4.0*b*d;
+
+    if (discriminant > 0.0)
+    {
+        discriminant = sqrt(discriminant);
+        roots[0] = (-c + discriminant)/(2.0*b);
+        roots[1] = (-c - discriminant)/(2.0*b);
+        return 2;
+    }
+    else if (discriminant == 0.0)
+    {
+        roots[0] = -c/(2.0*b);
+        return 1;
+    }
+
+    return 0;
+}
+
+// Get glyph slot for codepoint, glyph is rasterized into an atlas page on first use
+// NOTE: If codepoint is not found in the font it fallbacks to '?' (slot 0)
+static int GetGlyphCacheIndex(rGlyphCache *cache, int codepoint)
+{
+    unsigned int mask = (unsigned int)cache->tableSize - 1;
+    unsigned int hash = ((unsigned int)codepoint*2654435761u) & mask;
+
+    while (cache->table[hash] != 0)
+    {
+        int slot = cache->table[hash] - 1;
+
+        if (cache->glyphs[slot].value == codepoint)
+        {
+            if (cache->slotPages[slot] >= 0) cache->pages[cache->slotPages[slot]].lastUsed = cache->tick;
+            return slot;
+        }
+
+        hash = (hash + 1) & mask;
+    }
+
+    // Glyph not cached yet, check it is available in the font
+    if (stbtt_FindGlyphIndex(&cache->fontInfo, codepoint) == 0) return 0;
+
+    // All slots in use, reuse least recently used page slots
+    if (cache->freeCount == 0) EvictGlyphCachePage(cache, GetGlyphCacheLruPage(cache));
+    if (cache->freeCount == 0) return 0;
+
+    int slot = cache->freeSlots[--cache->freeCount];
+
+    if (!LoadGlyphCacheSlot(cache, slot, codepoint))
+    {
+        cache->freeSlots[cache->freeCount++] = slot;
+        slot = 0;
+    }
+
+    return slot;
+}
+
+// Rasterize codepoint glyph into cache slot, packing it into an atlas page
+// NOTE: Glyph metrics match LoadFontData() ones, glyphs without pixels (i.e. space) are not packed
+static bool LoadGlyphCacheSlot(rGlyphCache *cache, int slot, int codepoint)
+{
+    int index = stbtt_FindGlyphIndex(&cache->fontInfo, codepoint);  // NOTE: 0 is .notdef glyph
+
+    int advanceX = 0;
+    int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+    stbtt_GetGlyphHMetrics(&cache->fontInfo, index, &advanceX, NULL);
+    stbtt_GetGlyphBitmapBox(&cache->fontInfo, index, cache->scaleFactor, cache->scaleFactor, &x0, &y0, &x1, &y1);
+
+    int width = x1 - x0;
+    int height = y1 - y0;
+    int page = 0;
+    Rectangle rec = { 0 };
+
+    if ((width > 0) && (height > 0))
+    {
+        int packWidth = width + 2*cache->padding;
+        int packHeight = height + 2*cache->padding;
+        int x = 0, y = 0;
+
+        if ((packWidth > cache->pageSize) || (packHeight > cache->pageSize))
+        {
+            TRACELOG(LOG_WARNING, "FONT: Character [0x%08x] size is bigger than dynamic font atlas page", codepoint);
+            return false;
+        }
+
+        // Look for free space on loaded pages, add a new page or reuse least recently used one
+        page = -1;
+        for (int i = 0; i < cache->pageCount; i++)
+        {
+            if (PackSkylineRect(&cache->pages[i].packer, packWidth, packHeight, &x, &y)) { page = i; break; }
+        }
+
+        if (page == -1)
+        {
+            if (cache->pageCount < cache->maxPages) page = AddGlyphCachePage(cache);
+            else
+            {
+                page = GetGlyphCacheLruPage(cache);
+                EvictGlyphCachePage(cache, page);
+            }
+
+            if (!PackSkylineRect(&cache->pages[page].packer, packWidth, packHeight, &x, &y)) return false;
+        }
+
+        // Rasterize glyph and copy it to page alpha channel (gray channel is always white)
+        if (cache->bitmapSize < width*height)
+        {
+            RL_FREE(cache->bitmap);
+            cache->bitmapSize = width*height;
+            cache->bitmap = (unsigned char *)RL_MALLOC(cache->bitmapSize);
+        }
+
+        stbtt_MakeGlyphBitmap(&cache->fontInfo, cache->bitmap, width, height, width, cache->scaleFactor, cache->scaleFactor, index);
+
+        GlyphCachePage *target = &cache->pages[page];
+        unsigned char *pixels = (unsigned char *)target->image.data;
+
+        for (int j = 0; j < height; j++)
+        {
+            unsigned char *row = pixels + ((y + cache->padding + j)*cache->pageSize + x + cache->padding)*2;
+            for (int i = 0; i < width; i++) row[i*2 + 1] = cache->bitmap[j*width + i];
+        }
+
+        if (y < target->dirtyMinY) target->dirtyMinY = y;
+        if ((y + packHeight) > target->dirtyMaxY) target->dirtyMaxY = y + packHeight;
+
+        rec = (Rectangle){ (float)(x + cache->padding), (float)(y + cache->padding), (float)width, (float)height };
+    }
+
+    cache->glyphs[slot] = (GlyphInfo){ codepoint, x0, y0, (int)((float)advanceX*cache->scaleFactor), { 0 } };
+    if (rec.width > 0) cache->glyphs[slot].offsetY += cache->ascent;
+    cache->recs[slot] = rec;
+    cache->slotPages[slot] = page;
+    cache->pages[page].lastUsed = cache->tick;
+
+    unsigned int mask = (unsigned int)cache->tableSize - 1;
+    unsigned int hash = ((unsigned int)codepoint*2654435761u) & mask;
+    while (cache->table[hash] != 0) hash = (hash + 1) & mask;
+    cache->table[hash] = slot + 1;
+
+    return true;
+}
+
+// Add a new atlas page to cache, returns page index
+static int AddGlyphCachePage(rGlyphCache *cache)
+{
+    int page = cache->pageCount;
+    GlyphCachePage *target = &cache->pages[page];
+
+    target->image.data = RL_MALLOC(cache->pageSize*cache->pageSize*2);
+    target->image.width = cache->pageSize;
+    target->image.height = cache->pageSize;
+    target->image.mipmaps = 1;
+    target->image.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+
+    unsigned char *pixels = (unsigned char *)target->image.data;
+    for (int i = 0; i < cache->pageSize*cache->pageSize; i++) { pixels[i*2] = 255; pixels[i*2 + 1] = 0; }
+
+    if (isGpuReady) target->texture = LoadTextureFromImage(target->image);
+
+    InitSkylinePacker(&target->packer, cache->pageSize, cache->pageSize);
+    target->dirtyMinY = cache->pageSize;
+    target->dirtyMaxY = 0;
+    target->lastUsed = cache->tick;
+
+    cache->pageCount++;
+
+    TRACELOGD("FONT: Dynamic font atlas page %i loaded (%ix%i)", page, cache->pageSize, cache->pageSize);
+
+    return page;
+}
+
+// Get least recently used atlas page
+static int GetGlyphCacheLruPage(rGlyphCache *cache)
+{
+    int page = 0;
+
+    for (int i = 1; i < cache->pageCount; i++)
+    {
+        if (cache->pages[i].lastUsed < cache->pages[page].lastUsed) page = i;
+    }
+
+    if (cache->pages[page].lastUsed == cache->tick) TRACELOG(LOG_WARNING, "FONT: Dynamic font atlas pages full with text in use, consider bigger pageSize or maxPages");
+
+    return page;
+}
+
+// Evict all glyphs from atlas page to reuse it
+static void EvictGlyphCachePage(rGlyphCache *cache, int page)
+{
+    // Draw pending render batch, it could reference glyphs on the page to be cleared
+    if (isGpuReady) rlDrawRenderBatchActive();
+
+    bool fallbackEvicted = false;
+
+    for (int i = 0; i < cache->slotCount; i++)
+    {
+        if (cache->slotPages[i] == page)
+        {
+            if (i == 0) fallbackEvicted = true;
+            else cache->freeSlots[cache->freeCount++] = i;
+
+            cache->slotPages[i] = -1;
+            cache->glyphs[i] = (GlyphInfo){ 0 };
+            cache->recs[i] = (Rectangle){ 0 };
+        }
+    }
+
+    // Clear page image, rows are uploaded again when new glyphs are packed
+    GlyphCachePage *target = &cache->pages[page];
+    unsigned char *pixels = (unsigned char *)target->image.data;
+    for (int i = 0; i < cache->pageSize*cache->pageSize; i++) pixels[i*2 + 1] = 0;
+    ResetSkylinePacker(&target->packer);
+
+    // Rebuild codepoints hash table with remaining glyphs
+    unsigned int mask = (unsigned int)cache->tableSize - 1;
+    memset(cache->table, 0, cache->tableSize*sizeof(int));
+
+    for (int i = 0; i < cache->slotCount; i++)
+    {
+        if (cache->slotPages[i] >= 0)
+        {
+            unsigned int hash = ((unsigned int)cache->glyphs[i].value*2654435761u) & mask;
+            while (cache->table[hash] != 0) hash = (hash + 1) & mask;
+            cache->table[hash] = i + 1;
+        }
+    }
+
+    cache->evictionCount++;
+
+    TRACELOGD("FONT: Dynamic font atlas page %i evicted for reuse", page);
+
+    if (fallbackEvicted) LoadGlyphCacheSlot(cache, 0, 63);
+}
+
+// Upload modified atlas pages rows to GPU
+static void UpdateGlyphCache(rGlyphCache *cache)
+{
+    for (int i = 0; i < cache->pageCount; i++)
+    {
+        GlyphCachePage *target = &cache->pages[i];
+
+        if (target->dirtyMaxY > target->dirtyMinY)
+        {
+            // NOTE: Full width rows are uploaded, page image data is contiguous for them
+            Rectangle rec = { 0.0f, (float)target->dirtyMinY, (float)cache->pageSize, (float)(target->dirtyMaxY - target->dirtyMinY) };
+            if (isGpuReady) UpdateTextureRec(target->texture, rec, (unsigned char *)target->image.data + target->dirtyMinY*cache->pageSize*2);
+
+            target->dirtyMinY = cache->pageSize;
+            target->dirtyMaxY = 0;
+        }
+    }
+}
+
+// Unload glyphs cache data and atlas pages
+static void UnloadGlyphCache(rGlyphCache *cache)
+{
+    for (int i = 0; i < cache->pageCount; i++)
+    {
+        if (isGpuReady) UnloadTexture(cache->pages[i].texture);
+        UnloadImage(cache->pages[i].image);
+        UnloadSkylinePacker(&cache->pages[i].packer);
+    }
+
+    RL_FREE(cache->pages);
+    RL_FREE(cache->glyphs);
+    RL_FREE(cache->recs);
+    RL_FREE(cache->slotPages);
+    RL_FREE(cache->freeSlots);
+    RL_FREE(cache->table);
+    RL_FREE(cache->bitmap);
+    RL_FREE(cache->fileData);
+    RL_FREE(cache);
+}
+#endif      // SUPPORT_FILEFORMAT_TTF
+
 #endif      // SUPPORT_MODULE_RTEXT
@@ -280,16 +280,16 @@ Image LoadImage(const char *fileName)
     #define STBI_REQUIRED
 #endif
 
-    // Loading file to memory
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    // Mapping file to memory (no copy if supported)
+    FileMapping mapping = MapFileData(fileName);
 
     // Loading image from memory data
-    if (fileData != NULL)
+    if (mapping.data != NULL)
     {
-        image = LoadImageFromMemory(GetFileExtension(fileName), fileData, dataSize);
+        if (mapping.size <= 2147483647) image = LoadImageFromMemory(GetFileExtension(fileName), mapping.data, (int)mapping.size);
+        else TRACELOG(LOG_WARNING, "IMAGE: [%s] File is bigger than 2147483647 bytes", fileName);
 
-        UnloadFileData(fileData);
+        UnmapFileData(mapping);
     }
 
     return image;
@@ -300,18 +300,17 @@ Image LoadImageRaw(const char *fileName, int width, int height, int format, int
 {
     Image image = { 0 };
 
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    FileMapping mapping = MapFileData(fileName);
 
-    if (fileData != NULL)
+    if (mapping.data != NULL)
     {
-        unsigned char *dataPtr = fileData;
+        const unsigned char *dataPtr = mapping.data;
         int size = GetPixelDataSize(width, height, format);
 
-        if (size <= dataSize)   // Security check
+        if (size <= mapping.size)   // Security check
         {
             // Offset file data to expected raw image by header size
-            if ((headerSize > 0) && ((headerSize + size) <= dataSize)) dataPtr += headerSize;
+            if ((headerSize > 0) && (((long long)headerSize + size) <= mapping.size)) dataPtr += headerSize;
 
             image.data = RL_MALLOC(size);      // Allocate required memory in bytes
             memcpy(image.data, dataPtr, size); // Copy required data to image
@@ -321,7 +320,7 @@ Image LoadImageRaw(const char *fileName, int width, int height, int format, int
             image.format = format;
         }
 
-        UnloadFileData(fileData);
+        UnmapFileData(mapping);
     }
 
     return image;
@@ -340,20 +339,24 @@ Image LoadImageAnim(const char *fileName, int *frames)
 #if defined(SUPPORT_FILEFORMAT_GIF)
     if (IsFileExtension(fileName, ".gif"))
     {
-        int dataSize = 0;
-        unsigned char *fileData = LoadFileData(fileName, &dataSize);
+        FileMapping mapping = MapFileData(fileName);
 
-        if (fileData != NULL)
+        if (mapping.data != NULL)
         {
-            int comp = 0;
-            int *delays = NULL;
-            image.data = stbi_load_gif_from_memory(fileData, dataSize, &delays, &image.width, &image.height, &frameCount, &comp, 4);
+            if (mapping.size <= 2147483647)
+            {
+                int comp = 0;
+                int *delays = NULL;
+                image.data = stbi_load_gif_from_memory(mapping.data, (int)mapping.size, &delays, &image.width, &image.height, &frameCount, &comp, 4);
 
-            image.mipmaps = 1;
-            image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+                image.mipmaps = 1;
+                image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
 
-            UnloadFileData(fileData);
-            RL_FREE(delays);        // NOTE: Frames delays are discarded
+                RL_FREE(delays);        // NOTE: Frames delays are discarded
+            }
+            else TRACELOG(LOG_WARNING, "IMAGE: [%s] File is bigger than 2147483647 bytes", fileName);
+
+            UnmapFileData(mapping);
         }
     }
 #else
@@ -7,6 +7,15 @@
 *           Show TraceLog() output messages
 *           NOTE: By default LOG_DEBUG traces not shown
 *
+*       #define SUPPORT_FILE_MAPPING
+*           Map files into memory on MapFileData() (POSIX mmap), no file data copy is required
+*           NOTE: Not supported platforms fallback to LoadFileData()
+*
+*       #define SUPPORT_PACK_FILES
+*           Pack files can be mounted with MountPack(), entries are resolved by LoadFileData(),
+*           LoadFileText(), MapFileData() and FileExists() before accessing the file system
+*           NOTE: Compressed entries require SUPPORT_COMPRESSION_API (DEFLATE, sinfl)
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -49,6 +58,18 @@
 #include <stdarg.h>                     // Required for: va_list, va_start(), va_end()
 #include <string.h>                     // Required for: strcpy(), strcat()
 
+#if defined(SUPPORT_PACK_FILES) && defined(SUPPORT_COMPRESSION_API)
+    #include "external/sinfl.h"         // Required for: sinflate(), implementation in rcore module
+#endif
+
+#if defined(SUPPORT_FILE_MAPPING) && !defined(_WIN32) && !defined(PLATFORM_ANDROID) && !defined(PLATFORM_WEB)
+    #define FILEIO_MAPPING_POSIX
+    #include <sys/mman.h>               // Required for: mmap(), munmap()
+    #include <sys/stat.h>               // Required for: fstat()
+    #include <fcntl.h>                  // Required for: open()
+    #include <unistd.h>                 // Required for: close()
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -56,6 +77,53 @@
     #define MAX_TRACELOG_MSG_LENGTH     256         // Max length of one trace-log message
 #endif
 
+// File mapping types
+#define FILE_MAPPING_LOADED             0           // File data loaded into memory (LoadFileData())
+#define FILE_MAPPING_MAPPED             1           // File data memory-mapped (mmap())
+#define FILE_MAPPING_CUSTOM             2           // File data mapped by custom callback
+#define FILE_MAPPING_PACK               3           // File data view into a mounted pack (not owned)
+
+#ifndef MAX_MOUNTED_PACKS
+    #define MAX_MOUNTED_PACKS           8           // Maximum number of pack files mounted at the same time
+#endif
+
+// Pack file format
+//   [header]   magic "rPAK" (4 bytes), version (4 bytes), entry count (4 bytes), reserved (4 bytes), index offset (8 bytes)
+//   [data]     entries data, every entry data aligned to PACK_DATA_ALIGNMENT
+//   [index]    for every entry: offset (8 bytes), stored size (8 bytes), size (8 bytes), flags (4 bytes),
+//              path length (4 bytes), path (path length bytes, '/' separators, no '\0')
+// NOTE: All values are stored little-endian
+#define PACK_FORMAT_VERSION             100         // Pack file format version
+#define PACK_HEADER_SIZE                24          // Pack file header size in bytes
+#define PACK_INDEX_ENTRY_SIZE           32          // Pack index entry size in bytes (path not included)
+#define PACK_DATA_ALIGNMENT             16          // Pack entries data alignment in bytes
+
+#define PACK_ENTRY_DEFLATE              1           // Pack entry flag: data compressed (DEFLATE)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+#if defined(SUPPORT_PACK_FILES)
+// Pack entry
+typedef struct PackEntry {
+    unsigned long long offset;      // Entry data offset in pack file
+    unsigned long long storedSize;  // Entry data size in pack file (compressed size if compressed)
+    unsigned long long size;        // Entry data size
+    unsigned int flags;             // Entry flags (PACK_ENTRY_DEFLATE)
+    unsigned int hash;              // Entry path hash, used for lookups
+    char *path;                     // Entry path, relative to pack root
+} PackEntry;
+
+// Mounted pack
+typedef struct MountedPack {
+    char *fileName;                 // Pack file name
+    char *mountPath;                // Mount path, files loaded from this path are resolved from pack
+    FileMapping mapping;            // Pack file data mapping
+    PackEntry *entries;             // Pack entries, sorted by path hash
+    int entryCount;                 // Pack entries count
+} MountedPack;
+#endif
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -66,6 +134,8 @@ static LoadFileDataCallback loadFileData = NULL;    // LoadFileData callback fun
 static SaveFileDataCallback saveFileData = NULL;    // SaveFileText callback function pointer
 static LoadFileTextCallback loadFileText = NULL;    // LoadFileText callback function pointer
 static SaveFileTextCallback saveFileText = NULL;    // SaveFileText callback function pointer
+static MapFileDataCallback mapFileData = NULL;      // MapFileData callback function pointer
+static UnmapFileDataCallback unmapFileData = NULL;  // UnmapFileData callback function pointer
 
 //----------------------------------------------------------------------------------
 // Functions to set internal callbacks
@@ -75,12 +145,19 @@ void SetLoadFileDataCallback(LoadFileDataCallback callback) { loadFileData = cal
 void SetSaveFileDataCallback(SaveFileDataCallback callback) { saveFileData = callback; }  // Set custom file data saver
 void SetLoadFileTextCallback(LoadFileTextCallback callback) { loadFileText = callback; }  // Set custom file text loader
 void SetSaveFileTextCallback(SaveFileTextCallback callback) { saveFileText = callback; }  // Set custom file text saver
+void SetMapFileDataCallback(MapFileDataCallback callback) { mapFileData = callback; }     // Set custom file data mapper
+void SetUnmapFileDataCallback(UnmapFileDataCallback callback) { unmapFileData = callback; } // Set custom file data unmapper
 
 #if defined(PLATFORM_ANDROID)
 static AAssetManager *assetManager = NULL;          // Android assets manager pointer
 static const char *internalDataPath = NULL;         // Android internal data path
 #endif
 
+#if defined(SUPPORT_PACK_FILES)
+static MountedPack mountedPacks[MAX_MOUNTED_PACKS] = { 0 };  // Mounted packs, last mounted takes precedence
+static int mountedPackCount = 0;                    // Mounted packs count
+#endif
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
@@ -94,6 +171,14 @@ static fpos_t android_seek(void *cookie, fpos_t offset, int whence);
 static int android_close(void *cookie);
 #endif
 
+#if defined(SUPPORT_PACK_FILES)
+static unsigned int GetPackPathHash(const char *path);                                  // Get pack path hash (FNV-1a, separators unified)
+static const char *GetPackRelativePath(const char *fileName, const char *mountPath);    // Get file path relative to mount path, NULL if not contained
+static int ComparePackEntries(const void *a, const void *b);                            // Compare pack entries by path hash, used by qsort()
+static const PackEntry *FindPackEntry(const char *fileName, const MountedPack **pack);  // Find file entry in mounted packs
+static unsigned char *LoadPackEntryData(const MountedPack *pack, const PackEntry *entry, int extraSize); // Load pack entry data (decompressed)
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utilities
 //----------------------------------------------------------------------------------
@@ -191,6 +276,23 @@ unsigned char *LoadFileData(const char *fileName, int *dataSize)
             data = loadFileData(fileName, dataSize);
             return data;
         }
+#if defined(SUPPORT_PACK_FILES)
+        const MountedPack *pack = NULL;
+        const PackEntry *entry = FindPackEntry(fileName, &pack);
+
+        if (entry != NULL)
+        {
+            if (entry->size > 2147483647) TRACELOG(LOG_WARNING, "FILEIO: [%s] Pack entry is bigger than 2147483647 bytes, use MapFileData()", fileName);
+            else data = LoadPackEntryData(pack, entry, 0);
+
+            if (data != NULL)
+            {
+                *dataSize = (int)entry->size;
+                TRACELOG(LOG_INFO, "FILEIO: [%s] File loaded successfully from pack", fileName);
+                return data;
+            }
+        }
+#endif
 #if defined(SUPPORT_STANDARD_FILEIO)
         FILE *file = fopen(fileName, "rb");
 
@@ -250,6 +352,109 @@ void UnloadFileData(unsigned char *data)
     RL_FREE(data);
 }
 
+// Map file data as read-only view
+// NOTE: File is memory-mapped if supported (no data copy, pages loaded on access and size not limited to INT_MAX),
+// if a custom LoadFileData() callback is set or mapping fails, file data is loaded with LoadFileData()
+FileMapping MapFileData(const char *fileName)
+{
+    FileMapping mapping = { 0 };
+
+    if (fileName == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
+        return mapping;
+    }
+
+    if (mapFileData)
+    {
+        mapping = mapFileData(fileName);
+        mapping.type = FILE_MAPPING_CUSTOM;
+        return mapping;
+    }
+
+#if defined(SUPPORT_PACK_FILES)
+    const MountedPack *pack = NULL;
+    const PackEntry *entry = FindPackEntry(fileName, &pack);
+
+    if (entry != NULL)
+    {
+        if (entry->flags & PACK_ENTRY_DEFLATE)
+        {
+            mapping.data = LoadPackEntryData(pack, entry, 0);
+            mapping.type = FILE_MAPPING_LOADED;
+        }
+        else
+        {
+            // NOTE: Stored entries are a view into pack data, valid while pack is mounted
+            mapping.data = pack->mapping.data + entry->offset;
+            mapping.type = FILE_MAPPING_PACK;
+        }
+
+        if (mapping.data != NULL)
+        {
+            mapping.size = (long long)entry->size;
+            return mapping;
+        }
+    }
+#endif
+
+#if defined(FILEIO_MAPPING_POSIX)
+    if (loadFileData == NULL)
+    {
+        int fd = open(fileName, O_RDONLY);
+
+        if (fd >= 0)
+        {
+            struct stat info = { 0 };
+
+            if ((fstat(fd, &info) == 0) && (info.st_size > 0))
+            {
+                void *data = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+                if (data != MAP_FAILED)
+                {
+                    mapping.data = (const unsigned char *)data;
+                    mapping.size = (long long)info.st_size;
+                    mapping.type = FILE_MAPPING_MAPPED;
+                }
+            }
+
+            // NOTE: Mapping keeps its own reference to the file, descriptor is not required anymore
+            close(fd);
+        }
+
+        if (mapping.data != NULL)
+        {
+            TRACELOG(LOG_INFO, "FILEIO: [%s] File mapped successfully (%lli bytes)", fileName, mapping.size);
+            return mapping;
+        }
+    }
+#endif
+
+    int dataSize = 0;
+    mapping.data = LoadFileData(fileName, &dataSize);
+    mapping.size = dataSize;
+    mapping.type = FILE_MAPPING_LOADED;
+
+    return mapping;
+}
+
+// Unmap file data mapped by MapFileData()
+void UnmapFileData(FileMapping mapping)
+{
+    if (mapping.data == NULL) return;
+
+    switch (mapping.type)
+    {
+        case FILE_MAPPING_CUSTOM: if (unmapFileData) unmapFileData(mapping); break;
+        case FILE_MAPPING_PACK: break;      // Data owned by mounted pack
+#if defined(FILEIO_MAPPING_POSIX)
+        case FILE_MAPPING_MAPPED: munmap((void *)mapping.data, (size_t)mapping.size); break;
+#endif
+        default: UnloadFileData((unsigned char *)mapping.data); break;
+    }
+}
+
 // Save data to file from buffer
 bool SaveFileData(const char *fileName, void *data, int dataSize)
 {
@@ -353,6 +558,23 @@ char *LoadFileText(const char *fileName)
             text = loadFileText(fileName);
             return text;
         }
+#if defined(SUPPORT_PACK_FILES)
+        const MountedPack *pack = NULL;
+        const PackEntry *entry = FindPackEntry(fileName, &pack);
+
+        if ((entry != NULL) && (entry->size < 2147483647))
+        {
+            text = (char *)LoadPackEntryData(pack, entry, 1);
+
+            if (text != NULL)
+            {
+                // Zero-terminate the string
+                text[entry->size] = '\0';
+                TRACELOG(LOG_INFO, "FILEIO: [%s] Text file loaded successfully from pack", fileName);
+                return text;
+            }
+        }
+#endif
 #if defined(SUPPORT_STANDARD_FILEIO)
         FILE *file = fopen(fileName, "rt");
 
@@ -438,6 +660,278 @@ bool SaveFileText(const char *fileName, char *text)
     return success;
 }
 
+// Mount pack file, files loaded from mountPath are resolved from pack entries
+// NOTE: Pack file is mapped with MapFileData(), entries data is read from the mapping on request,
+// mounted packs are only read on lookups, so entries can be loaded from multiple threads at the same time
+bool MountPack(const char *fileName, const char *mountPath)
+{
+    bool result = false;
+
+#if defined(SUPPORT_PACK_FILES)
+    if (mountedPackCount >= MAX_MOUNTED_PACKS)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to mount pack, maximum mounted packs reached (%i)", fileName, MAX_MOUNTED_PACKS);
+        return result;
+    }
+
+    FileMapping mapping = MapFileData(fileName);
+
+    if (mapping.data == NULL) return result;
+
+    unsigned int version = 0;
+    unsigned int entryCount = 0;
+    unsigned long long indexOffset = 0;
+
+    if ((mapping.size >= PACK_HEADER_SIZE) && (memcmp(mapping.data, "rPAK", 4) == 0))
+    {
+        memcpy(&version, mapping.data + 4, 4);
+        memcpy(&entryCount, mapping.data + 8, 4);
+        memcpy(&indexOffset, mapping.data + 16, 8);
+    }
+
+    if ((version != PACK_FORMAT_VERSION) || (indexOffset < PACK_HEADER_SIZE) || (indexOffset > (unsigned long long)mapping.size))
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Pack file not valid", fileName);
+        UnmapFileData(mapping);
+        return result;
+    }
+
+    // Load pack index
+    unsigned long long packSize = (unsigned long long)mapping.size;
+    const unsigned char *indexPtr = mapping.data + indexOffset;
+    const unsigned char *indexEnd = mapping.data + packSize;
+    PackEntry *entries = (PackEntry *)RL_CALLOC((entryCount > 0)? entryCount : 1, sizeof(PackEntry));
+    unsigned int count = 0;
+
+    for (; count < entryCount; count++)
+    {
+        PackEntry *entry = &entries[count];
+        unsigned int pathLength = 0;
+
+        if ((indexEnd - indexPtr) < PACK_INDEX_ENTRY_SIZE) break;
+
+        memcpy(&entry->offset, indexPtr, 8);
+        memcpy(&entry->storedSize, indexPtr + 8, 8);
+        memcpy(&entry->size, indexPtr + 16, 8);
+        memcpy(&entry->flags, indexPtr + 24, 4);
+        memcpy(&pathLength, indexPtr + 28, 4);
+        indexPtr += PACK_INDEX_ENTRY_SIZE;
+
+        // Security check, entry path and data must be contained in pack
+        // NOTE: Uncompressed entries data is read directly from pack, stored size must match data size
+        if (((unsigned long long)(indexEnd - indexPtr) < pathLength) ||
+            ((entry->offset + entry->storedSize) < entry->offset) ||           // Overflow
+            ((entry->offset + entry->storedSize) > packSize) ||
+            (!(entry->flags & PACK_ENTRY_DEFLATE) && (entry->size != entry->storedSize))) break;
+
+        entry->path = (char *)RL_CALLOC(pathLength + 1, sizeof(char));
+        memcpy(entry->path, indexPtr, pathLength);
+        entry->hash = GetPackPathHash(entry->path);
+        indexPtr += pathLength;
+    }
+
+    if (count < entryCount)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Pack file index is corrupted", fileName);
+
+        for (unsigned int i = 0; i < count; i++) RL_FREE(entries[i].path);
+        RL_FREE(entries);
+        UnmapFileData(mapping);
+
+        return result;
+    }
+
+    // Sort entries by path hash for lookups (binary search)
+    qsort(entries, entryCount, sizeof(PackEntry), ComparePackEntries);
+
+    MountedPack *pack = &mountedPacks[mountedPackCount];
+    pack->fileName = (char *)RL_CALLOC(strlen(fileName) + 1, sizeof(char));
+    strcpy(pack->fileName, fileName);
+
+    // Mount path is stored with '/' separators, without './' prefix and trailing separators
+    if (mountPath == NULL) mountPath = "";
+    while ((mountPath[0] == '.') && ((mountPath[1] == '/') || (mountPath[1] == '\\'))) mountPath += 2;
+    if ((mountPath[0] == '.') && (mountPath[1] == '\0')) mountPath += 1;
+
+    int mountPathLength = (int)strlen(mountPath);
+    pack->mountPath = (char *)RL_CALLOC(mountPathLength + 1, sizeof(char));
+    for (int i = 0; i < mountPathLength; i++) pack->mountPath[i] = (mountPath[i] == '\\')? '/' : mountPath[i];
+    while ((mountPathLength > 0) && (pack->mountPath[mountPathLength - 1] == '/')) pack->mountPath[--mountPathLength] = '\0';
+
+    pack->mapping = mapping;
+    pack->entries = entries;
+    pack->entryCount = (int)entryCount;
+    mountedPackCount++;
+
+    TRACELOG(LOG_INFO, "FILEIO: [%s] Pack mounted successfully (%i entries)", fileName, entryCount);
+    result = true;
+#else
+    TRACELOG(LOG_WARNING, "FILEIO: Pack files not supported, SUPPORT_PACK_FILES required");
+#endif
+
+    return result;
+}
+
+// Unmount pack file
+// WARNING: Pack entries views mapped with MapFileData() are not valid anymore
+void UnmountPack(const char *fileName)
+{
+#if defined(SUPPORT_PACK_FILES)
+    for (int i = 0; i < mountedPackCount; i++)
+    {
+        if (strcmp(mountedPacks[i].fileName, fileName) == 0)
+        {
+            MountedPack *pack = &mountedPacks[i];
+
+            for (int e = 0; e < pack->entryCount; e++) RL_FREE(pack->entries[e].path);
+            RL_FREE(pack->entries);
+            RL_FREE(pack->fileName);
+            RL_FREE(pack->mountPath);
+            UnmapFileData(pack->mapping);
+
+            // Keep mounting order for remaining packs
+            for (int k = i; k < (mountedPackCount - 1); k++) mountedPacks[k] = mountedPacks[k + 1];
+            mountedPackCount--;
+            mountedPacks[mountedPackCount] = (MountedPack){ 0 };
+
+            TRACELOG(LOG_INFO, "FILEIO: [%s] Pack unmounted successfully", fileName);
+            return;
+        }
+    }
+
+    TRACELOG(LOG_WARNING, "FILEIO: [%s] Pack is not mounted", fileName);
+#endif
+}
+
+// Export files into pack file, entries named relative to basePath
+// NOTE: Entries are compressed (DEFLATE) if requested and compressed data is smaller than original data
+bool ExportPack(const char *fileName, FilePathList files, const char *basePath, bool compress)
+{
+    bool success = false;
+
+#if defined(SUPPORT_PACK_FILES) && defined(SUPPORT_STANDARD_FILEIO)
+    FILE *packFile = fopen(fileName, "wb");
+
+    if (packFile == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open pack file", fileName);
+        return success;
+    }
+
+    PackEntry *entries = (PackEntry *)RL_CALLOC((files.count > 0)? files.count : 1, sizeof(PackEntry));
+    unsigned char padding[PACK_DATA_ALIGNMENT] = { 0 };
+    unsigned char header[PACK_HEADER_SIZE] = { 0 };
+    unsigned long long offset = PACK_HEADER_SIZE;
+    unsigned int entryCount = 0;
+    int basePathLength = (basePath != NULL)? (int)strlen(basePath) : 0;
+    bool failed = (fwrite(header, 1, PACK_HEADER_SIZE, packFile) != PACK_HEADER_SIZE);
+
+    // Write entries data
+    for (unsigned int i = 0; (i < files.count) && !failed; i++)
+    {
+        if (!IsPathFile(files.paths[i])) continue;
+
+        FileMapping mapping = MapFileData(files.paths[i]);
+
+        if (mapping.data == NULL) continue;
+
+        // Entry path relative to base path, using '/' separators
+        const char *path = files.paths[i];
+        if ((basePathLength > 0) && (strncmp(path, basePath, basePathLength) == 0)) path += basePathLength;
+        while ((path[0] == '.') && ((path[1] == '/') || (path[1] == '\\'))) path += 2;
+        while ((path[0] == '/') || (path[0] == '\\')) path++;
+
+        PackEntry *entry = &entries[entryCount];
+        entry->path = (char *)RL_CALLOC(strlen(path) + 1, sizeof(char));
+        for (int c = 0; path[c] != '\0'; c++) entry->path[c] = (path[c] == '\\')? '/' : path[c];
+
+        const unsigned char *data = mapping.data;
+        unsigned char *compData = NULL;
+        entry->size = (unsigned long long)mapping.size;
+        entry->storedSize = entry->size;
+
+#if defined(SUPPORT_COMPRESSION_API)
+        if (compress && (mapping.size <= 2147483647))
+        {
+            int compDataSize = 0;
+            compData = CompressData(mapping.data, (int)mapping.size, &compDataSize);
+
+            if ((compData != NULL) && (compDataSize < mapping.size))
+            {
+                data = compData;
+                entry->storedSize = (unsigned long long)compDataSize;
+                entry->flags = PACK_ENTRY_DEFLATE;
+            }
+        }
+#endif
+        // Align entry data
+        int paddingSize = (int)((PACK_DATA_ALIGNMENT - offset%PACK_DATA_ALIGNMENT)%PACK_DATA_ALIGNMENT);
+        if (paddingSize > 0) failed |= (fwrite(padding, 1, paddingSize, packFile) != (size_t)paddingSize);
+
+        entry->offset = offset + paddingSize;
+        failed |= (fwrite(data, 1, (size_t)entry->storedSize, packFile) != (size_t)entry->storedSize);
+        offset = entry->offset + entry->storedSize;
+        entryCount++;
+
+        RL_FREE(compData);
+        UnmapFileData(mapping);
+    }
+
+    // Write entries index
+    unsigned long long indexOffset = offset;
+
+    for (unsigned int i = 0; (i < entryCount) && !failed; i++)
+    {
+        unsigned char indexEntry[PACK_INDEX_ENTRY_SIZE] = { 0 };
+        unsigned int pathLength = (unsigned int)strlen(entries[i].path);
+
+        memcpy(indexEntry, &entries[i].offset, 8);
+        memcpy(indexEntry + 8, &entries[i].storedSize, 8);
+        memcpy(indexEntry + 16, &entries[i].size, 8);
+        memcpy(indexEntry + 24, &entries[i].flags, 4);
+        memcpy(indexEntry + 28, &pathLength, 4);
+
+        failed |= (fwrite(indexEntry, 1, PACK_INDEX_ENTRY_SIZE, packFile) != PACK_INDEX_ENTRY_SIZE);
+        failed |= (fwrite(entries[i].path, 1, pathLength, packFile) != pathLength);
+    }
+
+    // Write header, once index offset is known
+    unsigned int version = PACK_FORMAT_VERSION;
+    memcpy(header, "rPAK", 4);
+    memcpy(header + 4, &version, 4);
+    memcpy(header + 8, &entryCount, 4);
+    memcpy(header + 16, &indexOffset, 8);
+
+    if (!failed) failed = (fseek(packFile, 0, SEEK_SET) != 0);
+    if (!failed) failed = (fwrite(header, 1, PACK_HEADER_SIZE, packFile) != PACK_HEADER_SIZE);
+    if (fclose(packFile) != 0) failed = true;
+
+    for (unsigned int i = 0; i < entryCount; i++) RL_FREE(entries[i].path);
+    RL_FREE(entries);
+
+    if (!failed)
+    {
+        TRACELOG(LOG_INFO, "FILEIO: [%s] Pack exported successfully (%i entries)", fileName, entryCount);
+        success = true;
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to write pack file", fileName);
+#else
+    TRACELOG(LOG_WARNING, "FILEIO: Pack files export not supported");
+#endif
+
+    return success;
+}
+
+#if defined(SUPPORT_PACK_FILES)
+// Check if file is available in a mounted pack
+bool IsPackFileEntry(const char *fileName)
+{
+    const MountedPack *pack = NULL;
+
+    return (FindPackEntry(fileName, &pack) != NULL);
+}
+#endif
+
 #if defined(PLATFORM_ANDROID)
 // Initialize asset manager from android app
 void InitAssetManager(AAssetManager *manager, const char *dataPath)
@@ -508,3 +1002,125 @@ static int android_close(void *cookie)
     return 0;
 }
 #endif  // PLATFORM_ANDROID
+
+#if defined(SUPPORT_PACK_FILES)
+// Get pack path hash (FNV-1a), '\' and '/' separators are considered equal
+static unsigned int GetPackPathHash(const char *path)
+{
+    unsigned int hash = 2166136261u;
+
+    for (int i = 0; path[i] != '\0'; i++)
+    {
+        hash ^= (unsigned char)((path[i] == '\\')? '/' : path[i]);
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+// Get file path relative to mount path, NULL if file is not contained in mount path
+static const char *GetPackRelativePath(const char *fileName, const char *mountPath)
+{
+    // Skip current directory prefix
+    while ((fileName[0] == '.') && ((fileName[1] == '/') || (fileName[1] == '\\'))) fileName += 2;
+
+    int i = 0;
+    for (; mountPath[i] != '\0'; i++)
+    {
+        if (((fileName[i] == '\\')? '/' : fileName[i]) != mountPath[i]) return NULL;
+    }
+
+    if (i > 0)
+    {
+        if ((fileName[i] != '/') && (fileName[i] != '\\')) return NULL;
+        while ((fileName[i] == '/') || (fileName[i] == '\\')) i++;
+    }
+
+    return fileName + i;
+}
+
+// Compare pack entries by path hash, used by qsort()
+static int ComparePackEntries(const void *a, const void *b)
+{
+    unsigned int hashA = ((const PackEntry *)a)->hash;
+    unsigned int hashB = ((const PackEntry *)b)->hash;
+
+    return (hashA > hashB) - (hashA < hashB);
+}
+
+// Find file entry in mounted packs, last mounted packs take precedence
+static const PackEntry *FindPackEntry(const char *fileName, const MountedPack **pack)
+{
+    for (int i = mountedPackCount - 1; i >= 0; i--)
+    {
+        const char *path = GetPackRelativePath(fileName, mountedPacks[i].mountPath);
+
+        if ((path == NULL) || (path[0] == '\0')) continue;
+
+        const PackEntry *entries = mountedPacks[i].entries;
+        unsigned int hash = GetPackPathHash(path);
+        int low = 0;
+        int high = mountedPacks[i].entryCount;
+
+        // Binary search first entry with path hash
+        while (low < high)
+        {
+            int mid = (low + high)/2;
+
+            if (entries[mid].hash < hash) low = mid + 1;
+            else high = mid;
+        }
+
+        for (int e = low; (e < mountedPacks[i].entryCount) && (entries[e].hash == hash); e++)
+        {
+            int c = 0;
+            while ((entries[e].path[c] != '\0') && (entries[e].path[c] == ((path[c] == '\\')? '/' : path[c]))) c++;
+
+            if ((entries[e].path[c] == '\0') && (path[c] == '\0'))
+            {
+                *pack = &mountedPacks[i];
+                return &entries[e];
+            }
+        }
+    }
+
+    return NULL;
+}
+
+// Load pack entry data, decompressed if required
+// NOTE: Allocated memory includes extraSize bytes after entry data (i.e. text '\0')
+static unsigned char *LoadPackEntryData(const MountedPack *pack, const PackEntry *entry, int extraSize)
+{
+    unsigned char *data = (unsigned char *)RL_MALLOC((size_t)entry->size + extraSize);
+
+    if (data == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to allocated memory for pack entry", entry->path);
+        return data;
+    }
+
+    const unsigned char *entryData = pack->mapping.data + entry->offset;
+
+    if (entry->flags & PACK_ENTRY_DEFLATE)
+    {
+#if defined(SUPPORT_COMPRESSION_API)
+        // NOTE: Entry size is known, data is decompressed directly into the final buffer
+        int size = (entry->size <= 2147483647)? sinflate(data, (int)entry->size, entryData, (int)entry->storedSize) : -1;
+
+        if (size != (int)entry->size)
+        {
+            TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to decompress pack entry", entry->path);
+            RL_FREE(data);
+            data = NULL;
+        }
+#else
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Compressed pack entries require SUPPORT_COMPRESSION_API", entry->path);
+        RL_FREE(data);
+        data = NULL;
+#endif
+    }
+    else memcpy(data, entryData, (size_t)entry->size);
+
+    return data;
+}
+#endif  // SUPPORT_PACK_FILES
@@ -74,6 +74,10 @@ void InitAssetManager(AAssetManager *manager, const char *dataPath);   // Initia
 FILE *android_fopen(const char *fileName, const char *mode);           // Replacement for fopen() -> Read-only!
 #endif
 
+#if defined(SUPPORT_PACK_FILES)
+bool IsPackFileEntry(const char *fileName);                            // Check if file is available in a mounted pack
+#endif
+
 #if defined(__cplusplus)
 }
 #endif